@@ -14,6 +14,7 @@
 #include <Kokkos_DualView.hpp>
 #include <Kokkos_Macros.hpp>
 #include "config.hpp"
+#include "utils/profiler.hpp"
 
 //----------------------------------------------------------------------------------------
 // type alias that allows code to run with either floats or doubles
@@ -95,6 +96,7 @@ struct MHDCons1D {
 using DevExeSpace = Kokkos::DefaultExecutionSpace;
 using DevMemSpace = Kokkos::DefaultExecutionSpace::memory_space;
 using HostMemSpace = Kokkos::HostSpace;
+using PinnedMemSpace = Kokkos::SharedHostPinnedSpace;     // for fast device-host copies
 using ScratchMemSpace = DevExeSpace::scratch_memory_space;
 using LayoutWrapper = Kokkos::LayoutRight;                // increments last index fastest
 using TeamMember_t = Kokkos::TeamPolicy<>::member_type;   // for Kokkos thread teams
@@ -149,6 +151,32 @@ template <typename T>
 using ScrArray2D = Kokkos::View<T **, LayoutWrapper, ScratchMemSpace,
                                      Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
 
+//----------------------------------------------------------------------------------------
+//! \struct ScrFluxRow
+//! \brief Wraps a scratch array holding fluxes on one row of faces, so that it can be
+//! passed to the Riemann solvers (which index fluxes as flx(m,n,k,j,i)) in place of uflx.
+//! Used by the Hydro and MHD flux kernels with fused_update=true.
+
+struct ScrFluxRow {
+  ScrArray2D<Real> f;
+  KOKKOS_INLINE_FUNCTION
+  Real &operator()(const int m, const int n, const int k, const int j,
+                   const int i) const {
+    return f(n,i);
+  }
+};
+
+// returns uflx component, or wrapper of scratch array with fused update
+template <bool fused_>
+KOKKOS_INLINE_FUNCTION
+auto FluxArray(const DvceArray5D<Real> &flx, const ScrArray2D<Real> &scr) {
+  if constexpr (fused_) {
+    return ScrFluxRow{scr};
+  } else {
+    return flx;
+  }
+}
+
 //----------------------------------------------------------------------------------------
 // struct for storing face-centered (area-averaged) variables, e.g. magnetic field
 /* [using old C-style comments to prevent multi-line-comment warning with -Wall]
@@ -223,7 +251,8 @@ struct DvceEdgeFld4D {
 // These wrappers implement a variety of parallel execution strategies, including
 // 1D-range, and thread teams for use with inner vector threads. Experiments in K-Athena
 // and Parthenon indicate that 1D-range policy is generally faster than multidimensional
-// MD-range policy, so the latter is not used.
+// MD-range policy, so the latter is not used.  Each launch is wrapped in a
+// profiler::KernelScope, which times the kernel only if <profiling>/kernel_timing=true.
 //------------------------------
 // 1D loop using Kokkos 1D Range
 template <typename Function>
@@ -231,6 +260,7 @@ inline void par_for(const std::string &name, DevExeSpace exec_space,
                     const int &il, const int &iu, const Function &function) {
   // compute total number of elements and call Kokkos::parallel_for()
   const int ni = iu - il + 1;
+  profiler::KernelScope<DevExeSpace> kscope(name, exec_space);
   Kokkos::parallel_for(name, Kokkos::RangePolicy<>(exec_space, 0, ni),
   KOKKOS_LAMBDA(const int &idx) {
     // compute i indices of thread and call function
@@ -249,6 +279,7 @@ inline void par_for(const std::string &name, DevExeSpace exec_space,
   const int nj = ju - jl + 1;
   const int ni = iu - il + 1;
   const int nji  = nj * ni;
+  profiler::KernelScope<DevExeSpace> kscope(name, exec_space);
   Kokkos::parallel_for(name, Kokkos::RangePolicy<>(exec_space, 0, nji),
   KOKKOS_LAMBDA(const int &idx) {
     // compute j,i indices of thread and call function
@@ -271,6 +302,7 @@ inline void par_for(const std::string &name, DevExeSpace exec_space,
   const int ni = iu - il + 1;
   const int nkji = nk * nj * ni;
   const int nji  = nj * ni;
+  profiler::KernelScope<DevExeSpace> kscope(name, exec_space);
   Kokkos::parallel_for(name, Kokkos::RangePolicy<>(exec_space, 0, nkji),
   KOKKOS_LAMBDA(const int &idx) {
     // compute k,j,i indices of thread and call function
@@ -298,6 +330,7 @@ inline void par_for(const std::string &name, DevExeSpace exec_space,
   const int nnkji = nn * nk * nj * ni;
   const int nkji  = nk * nj * ni;
   const int nji   = nj * ni;
+  profiler::KernelScope<DevExeSpace> kscope(name, exec_space);
   Kokkos::parallel_for(name, Kokkos::RangePolicy<>(exec_space, 0, nnkji),
   KOKKOS_LAMBDA(const int &idx) {
     // compute n,k,j,i indices of thread and call function
@@ -330,6 +363,7 @@ inline void par_for(const std::string &name, DevExeSpace exec_space,
   const int nnkji  = nn * nk * nj * ni;
   const int nkji   = nk * nj * ni;
   const int nji    = nj * ni;
+  profiler::KernelScope<DevExeSpace> kscope(name, exec_space);
   Kokkos::parallel_for(name, Kokkos::RangePolicy<>(exec_space, 0, nmnkji),
   KOKKOS_LAMBDA(const int &idx) {
     // compute m,n,k,j,i indices of thread and call function
@@ -354,6 +388,7 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
                           const int kl, const int ku, const Function &function) {
   const int nk = ku - kl + 1;
   Kokkos::TeamPolicy<> policy(exec_space, nk, Kokkos::AUTO);
+  profiler::KernelScope<DevExeSpace> kscope(name, exec_space);
   Kokkos::parallel_for(name, policy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size)),
   KOKKOS_LAMBDA(TeamMember_t tmember) {
     const int k = tmember.league_rank() + kl;
@@ -372,6 +407,7 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
   const int nj = ju - jl + 1;
   const int nkj = nk*nj;
   Kokkos::TeamPolicy<> policy(exec_space, nkj, Kokkos::AUTO);
+  profiler::KernelScope<DevExeSpace> kscope(name, exec_space);
   Kokkos::parallel_for(name, policy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size)),
   KOKKOS_LAMBDA(TeamMember_t tmember) {
     const int k = tmember.league_rank()/nj + kl;
@@ -393,6 +429,7 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
   const int nkj  = nk*nj;
   const int nnkj = nn*nk*nj;
   Kokkos::TeamPolicy<> policy(exec_space, nnkj, Kokkos::AUTO);
+  profiler::KernelScope<DevExeSpace> kscope(name, exec_space);
   Kokkos::parallel_for(name, policy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size)),
   KOKKOS_LAMBDA(TeamMember_t tmember) {
     int n = (tmember.league_rank())/nkj;
@@ -420,6 +457,7 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
   const int nnkj  = nn*nk*nj;
   const int nmnkj = nm*nn*nk*nj;
   Kokkos::TeamPolicy<> policy(exec_space, nmnkj, Kokkos::AUTO);
+  profiler::KernelScope<DevExeSpace> kscope(name, exec_space);
   Kokkos::parallel_for(name, policy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size)),
   KOKKOS_LAMBDA(TeamMember_t tmember) {
     int m = (tmember.league_rank())/nnkj;
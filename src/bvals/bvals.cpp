@@ -80,12 +80,22 @@ MeshBoundaryValues::MeshBoundaryValues(MeshBlockPack *pp, ParameterInput *pin, b
   MPI_Comm_dup(MPI_COMM_WORLD, &comm_vars);
   MPI_Comm_dup(MPI_COMM_WORLD, &comm_flux);
 #endif
+
+  // aggregate all buffers exchanged with each rank into one message (if requested), and
+  // use persistent MPI requests rebuilt only when the mesh changes (if requested)
+  aggregate_msgs = pin->GetOrAddBoolean("mesh", "aggregate_msgs", false);
+  persistent_msgs = pin->GetOrAddBoolean("mesh", "persistent_msgs", false);
+  msg_tables = (aggregate_msgs || persistent_msgs);
 }
 
 //----------------------------------------------------------------------------------------
 // MeshBoundaryValues destructor
 
 MeshBoundaryValues::~MeshBoundaryValues() {
+  FreeMessages(msgs_sendvars);
+  FreeMessages(msgs_recvvars);
+  FreeMessages(msgs_sendflux);
+  FreeMessages(msgs_recvflux);
 #if MPI_PARALLEL_ENABLED
   int nnghbr = pmy_pack->pmb->nnghbr;
   for (int n=0; n<nnghbr; ++n) {
@@ -20,6 +20,7 @@ enum class BoundaryFlag {undef=-1,block, reflect, inflow, outflow, diode, user,
                          shear_periodic, vacuum};
 
 #include <algorithm>
+#include <array>
 #include <vector>
 
 #include "athena.hpp"
@@ -99,6 +100,39 @@ struct MeshBoundaryBuffer {
   }
 };
 
+//----------------------------------------------------------------------------------------
+//! \struct MeshBoundaryMessages
+//! \brief table of MPI messages used to communicate boundary buffers when messages are
+//! aggregated by rank and/or use persistent requests.  With aggregation, all buffers
+//! exchanged with the same remote rank are gathered into one contiguous message, ordered
+//! by (local ID, buffer index) of the *receiving* MeshBlock so the sending and receiving
+//! ranks compute identical offsets.  Otherwise each buffer is sent as its own message.
+//! The table (and any persistent requests) is only rebuilt when the neighbors of
+//! MeshBlocks change (after AMR or load balancing).
+
+struct MeshBoundaryMessages {
+  int nghbr_version=-1;          // value of Mesh::nghbr_version when table was built
+  int nvar=0;                    // number of variables when table was built
+  int nentry=0;                  // total number of buffers in all messages
+  DualArray2D<int> entry;        // (m, n, offset, size) of each buffer in data
+  DvceArray1D<Real> data;        // contiguous storage for aggregated messages
+  // (rank, sort key, m, n, size) of each buffer, accumulated before table is built
+  std::vector<std::array<int,5>> pending;
+  // remote rank, tag, size, pointer to data, and completion flag of each message
+  std::vector<int> rank, tag, size, done;
+  std::vector<Real*> ptr;
+#if MPI_PARALLEL_ENABLED
+  std::vector<MPI_Request> req;  // one request per message
+#endif
+
+  bool IsCurrent(int version, int nv) const {
+    return ((version == nghbr_version) && (nv == nvar));
+  }
+  void AddBuffer(int r, int lid, int bufid, int m, int n, int size) {
+    pending.push_back({r, (lid*56 + bufid), m, n, size});
+  }
+};
+
 // Forward declarations
 class MeshBlockPack;
 
@@ -124,6 +158,12 @@ class MeshBoundaryValues {
   MPI_Comm comm_vars, comm_flux;
 #endif
 
+  // with aggregation, all buffers sent to/received from each rank form one MPI message
+  // with persistent messages, MPI requests are created once and restarted every stage
+  bool aggregate_msgs, persistent_msgs;
+  bool msg_tables;   // true if either of the above are used
+  MeshBoundaryMessages msgs_sendvars, msgs_recvvars, msgs_sendflux, msgs_recvflux;
+
   //functions
   virtual void InitSendIndices(MeshBoundaryBuffer &buf,int x,int y,int z,int a,int b)=0;
   virtual void InitRecvIndices(MeshBoundaryBuffer &buf,int x,int y,int z,int a,int b)=0;
@@ -136,6 +176,14 @@ class MeshBoundaryValues {
   TaskStatus ClearFluxRecv();
   TaskStatus ClearFluxSend();
 
+  // functions to build/post/complete messages in tables
+  void BuildMessages(MeshBoundaryMessages &msgs, int version, int nv, bool send,
+                     bool flux);
+  void FreeMessages(MeshBoundaryMessages &msgs);
+  bool StartMessages(MeshBoundaryMessages &msgs, bool send, bool flux);
+  bool TestMessages(MeshBoundaryMessages &msgs, bool flux, bool &bflag);
+  bool ClearMessages(MeshBoundaryMessages &msgs);
+
   // BCs associated with various physics modules
   static void HydroBCs(MeshBlockPack *pp, DualArray2D<Real> uin, DvceArray5D<Real> u0);
   static void BFieldBCs(MeshBlockPack *pp, DualArray2D<Real> bin, DvceFaceFld4D<Real> b0);
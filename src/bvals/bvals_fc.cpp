@@ -189,6 +189,8 @@ TaskStatus MeshBoundaryValuesFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
   int my_rank = global_variable::my_rank;
   auto &nghbr = pmy_pack->pmb->nghbr;
   bool no_errors=true;
+  int version = pmy_pack->pmesh->nghbr_version;
+  bool build_msgs = msg_tables && !(msgs_sendvars.IsCurrent(version, 3));
   for (int m=0; m<nmb; ++m) {
     for (int n=0; n<nnghbr; ++n) {
       if (nghbr.h_view(m,n).gid >= 0) {  // neighbor exists and not a physical boundary
@@ -196,6 +198,8 @@ TaskStatus MeshBoundaryValuesFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
         int dn = nghbr.h_view(m,n).dest;
         int drank = nghbr.h_view(m,n).rank;
         if (drank != my_rank) {
+          // message tables only need to be rebuilt when the mesh changes
+          if (msg_tables && !(build_msgs)) {continue;}
           // create tag using local ID and buffer index of *receiving* MeshBlock
           int lid = nghbr.h_view(m,n).gid - pmy_pack->pmesh->gids_eachrank[drank];
           int tag = CreateBvals_MPI_Tag(lid, dn);
@@ -211,6 +215,11 @@ TaskStatus MeshBoundaryValuesFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
           }
           auto send_ptr = Kokkos::subview(sendbuf[n].vars, m, Kokkos::ALL);
 
+          // with message tables, only record location of buffer in message to drank
+          if (msg_tables) {
+            msgs_sendvars.AddBuffer(drank, lid, dn, m, n, data_size);
+            continue;
+          }
           int ierr = MPI_Isend(send_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
                                comm_vars, &(sendbuf[n].vars_req[m]));
           if (ierr != MPI_SUCCESS) {no_errors=false;}
@@ -218,6 +227,10 @@ TaskStatus MeshBoundaryValuesFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
       }
     }
   }
+  if (msg_tables) {
+    if (build_msgs) {BuildMessages(msgs_sendvars, version, 3, true, false);}
+    if (!(StartMessages(msgs_sendvars, true, false))) {no_errors=false;}
+  }
   // Quit if MPI error detected
   if (!(no_errors)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
@@ -258,6 +271,10 @@ TaskStatus MeshBoundaryValuesFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b,
       }
     }
   }
+  // with message tables, test all messages and scatter any aggregated messages
+  if (msg_tables && !(bflag)) {
+    if (!(TestMessages(msgs_recvvars, false, bflag))) {no_errors=false;}
+  }
   // Quit if MPI error detected
   if (!(no_errors)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
@@ -0,0 +1,258 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file bvals_messages.cpp
+//! \brief functions to build, post, and complete tables of MPI messages used to exchange
+//! boundary buffers (for both CC and FC variables, and their fluxes) when messages are
+//! aggregated by rank and/or use persistent requests.
+//!
+//! Buffers are still packed/unpacked by the usual PackAndSend/RecvAndUnpack kernels.
+//! With aggregation, the send buffers destined for each rank are then gathered on the
+//! device into one contiguous message, and received messages are scattered back into the
+//! recv buffers before unpacking.  This replaces up to (nmb x 56) small messages per rank
+//! with one message per neighboring rank, reducing per-message latency and MPI overhead.
+//! With persistent requests, messages are set up once with MPI_Send_init/MPI_Recv_init
+//! each time the mesh changes, and then simply restarted with MPI_Startall every stage.
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "mesh/mesh.hpp"
+#include "bvals.hpp"
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValues::BuildMessages()
+//! \brief Builds table of messages from list of buffers accumulated with AddBuffer().
+//! Buffers are sorted by rank and then by (local ID, buffer index) of the receiving
+//! MeshBlock.  Any persistent requests from the previous table are freed, and new ones
+//! created if needed.
+
+void MeshBoundaryValues::BuildMessages(MeshBoundaryMessages &msgs, int version, int nv,
+                                       bool send, bool flux) {
+  FreeMessages(msgs);
+  std::sort(msgs.pending.begin(), msgs.pending.end());
+
+  msgs.rank.clear();
+  msgs.tag.clear();
+  msgs.size.clear();
+  msgs.ptr.clear();
+  std::vector<int> msg_offset;
+  msgs.nentry = static_cast<int>(msgs.pending.size());
+  Kokkos::realloc(msgs.entry, std::max(msgs.nentry,1), 4);
+  int offset = 0;
+  for (int e=0; e<msgs.nentry; ++e) {
+    int r = msgs.pending[e][0];
+    int key = msgs.pending[e][1];
+    int m = msgs.pending[e][2];
+    int n = msgs.pending[e][3];
+    int sz = msgs.pending[e][4];
+    msgs.entry.h_view(e,0) = m;
+    msgs.entry.h_view(e,1) = n;
+    msgs.entry.h_view(e,2) = offset;
+    msgs.entry.h_view(e,3) = sz;
+    if (aggregate_msgs) {
+      // one message per rank, a single tag suffices since messages are non-overtaking
+      if (msgs.rank.empty() || (r != msgs.rank.back())) {
+        msgs.rank.push_back(r);
+        msgs.tag.push_back(0);
+        msgs.size.push_back(0);
+        msg_offset.push_back(offset);
+      }
+      msgs.size.back() += sz;
+    } else {
+      // one message per buffer, tagged with local ID and buffer index of *receiver*
+      auto &buf = (send)? sendbuf[n] : recvbuf[n];
+      auto &vars = (flux)? buf.flux : buf.vars;
+      msgs.rank.push_back(r);
+      msgs.tag.push_back(CreateBvals_MPI_Tag(key/56, key%56));
+      msgs.size.push_back(sz);
+      msgs.ptr.push_back(Kokkos::subview(vars, m, Kokkos::ALL).data());
+    }
+    offset += sz;
+  }
+  msgs.entry.template modify<HostMemSpace>();
+  msgs.entry.template sync<DevExeSpace>();
+
+  if (aggregate_msgs) {
+    // storage is only reallocated if messages have grown
+    if (offset > static_cast<int>(msgs.data.extent(0))) {
+      Kokkos::realloc(msgs.data, offset);
+    }
+    for (auto off : msg_offset) {
+      msgs.ptr.push_back(msgs.data.data() + off);
+    }
+  }
+  msgs.done.assign(msgs.rank.size(), 0);
+
+#if MPI_PARALLEL_ENABLED
+  msgs.req.assign(msgs.rank.size(), MPI_REQUEST_NULL);
+  if (persistent_msgs) {
+    MPI_Comm comm = (flux)? comm_flux : comm_vars;
+    bool no_errors=true;
+    for (std::size_t k=0; k<msgs.rank.size(); ++k) {
+      int ierr;
+      if (send) {
+        ierr = MPI_Send_init(msgs.ptr[k], msgs.size[k], MPI_ATHENA_REAL, msgs.rank[k],
+                             msgs.tag[k], comm, &(msgs.req[k]));
+      } else {
+        ierr = MPI_Recv_init(msgs.ptr[k], msgs.size[k], MPI_ATHENA_REAL, msgs.rank[k],
+                             msgs.tag[k], comm, &(msgs.req[k]));
+      }
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+    }
+    if (!(no_errors)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "MPI error in creating persistent requests" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+  }
+#endif
+
+  msgs.pending.clear();
+  msgs.nghbr_version = version;
+  msgs.nvar = nv;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValues::FreeMessages()
+//! \brief Frees any persistent requests stored in table of messages.
+
+void MeshBoundaryValues::FreeMessages(MeshBoundaryMessages &msgs) {
+#if MPI_PARALLEL_ENABLED
+  for (auto &r : msgs.req) {
+    if (r != MPI_REQUEST_NULL) {MPI_Request_free(&r);}
+  }
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool MeshBoundaryValues::StartMessages()
+//! \brief Posts all sends (after gathering send buffers into aggregated messages) or all
+//! receives in table of messages, either by restarting persistent requests or with
+//! non-blocking calls.  Returns false on MPI error.
+
+bool MeshBoundaryValues::StartMessages(MeshBoundaryMessages &msgs, bool send, bool flux) {
+  bool no_errors=true;
+#if MPI_PARALLEL_ENABLED
+  if (msgs.rank.empty()) {return no_errors;}
+
+  if (send && aggregate_msgs) {
+    auto &sbuf = sendbuf;
+    auto &entry = msgs.entry;
+    auto &data = msgs.data;
+    Kokkos::TeamPolicy<> policy(DevExeSpace(), msgs.nentry, Kokkos::AUTO);
+    Kokkos::parallel_for("MsgGather", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+      const int m = entry.d_view(tmember.league_rank(),0);
+      const int n = entry.d_view(tmember.league_rank(),1);
+      const int offset = entry.d_view(tmember.league_rank(),2);
+      const int size = entry.d_view(tmember.league_rank(),3);
+      Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, size), [&](const int i) {
+        if (flux) {
+          data(offset + i) = sbuf[n].flux(m,i);
+        } else {
+          data(offset + i) = sbuf[n].vars(m,i);
+        }
+      });
+    });
+    Kokkos::fence();
+  }
+
+  std::fill(msgs.done.begin(), msgs.done.end(), 0);
+  if (persistent_msgs) {
+    int ierr = MPI_Startall(static_cast<int>(msgs.req.size()), msgs.req.data());
+    if (ierr != MPI_SUCCESS) {no_errors=false;}
+  } else {
+    MPI_Comm comm = (flux)? comm_flux : comm_vars;
+    for (std::size_t k=0; k<msgs.rank.size(); ++k) {
+      int ierr;
+      if (send) {
+        ierr = MPI_Isend(msgs.ptr[k], msgs.size[k], MPI_ATHENA_REAL, msgs.rank[k],
+                         msgs.tag[k], comm, &(msgs.req[k]));
+      } else {
+        ierr = MPI_Irecv(msgs.ptr[k], msgs.size[k], MPI_ATHENA_REAL, msgs.rank[k],
+                         msgs.tag[k], comm, &(msgs.req[k]));
+      }
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+    }
+  }
+#endif
+  return no_errors;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool MeshBoundaryValues::TestMessages()
+//! \brief Tests whether all receives in table of messages have completed (sets bflag if
+//! not).  If so, aggregated messages are scattered into recv buffers so they can be
+//! unpacked as usual.  Returns false on MPI error.
+
+bool MeshBoundaryValues::TestMessages(MeshBoundaryMessages &msgs, bool flux,
+                                      bool &bflag) {
+  bool no_errors=true;
+#if MPI_PARALLEL_ENABLED
+  for (std::size_t k=0; k<msgs.rank.size(); ++k) {
+    if (msgs.done[k]) {continue;}
+    int test;
+    MPI_Status stat;
+    int ierr = MPI_Test(&(msgs.req[k]), &test, &stat);
+    if (ierr != MPI_SUCCESS) {no_errors=false;}
+    if (static_cast<bool>(test)) {
+      msgs.done[k] = 1;
+      // sizes of aggregated messages must match tables built independently on each rank
+      int count;
+      MPI_Get_count(&stat, MPI_ATHENA_REAL, &count);
+      if (aggregate_msgs && (count != msgs.size[k])) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "Aggregated message from rank " << msgs.rank[k]
+                  << " has " << count << " elements, expected " << msgs.size[k]
+                  << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    } else {
+      bflag = true;
+    }
+  }
+  if (bflag || !(aggregate_msgs) || (msgs.nentry == 0)) {return no_errors;}
+
+  auto &rbuf = recvbuf;
+  auto &entry = msgs.entry;
+  auto &data = msgs.data;
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), msgs.nentry, Kokkos::AUTO);
+  Kokkos::parallel_for("MsgScatter", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+    const int m = entry.d_view(tmember.league_rank(),0);
+    const int n = entry.d_view(tmember.league_rank(),1);
+    const int offset = entry.d_view(tmember.league_rank(),2);
+    const int size = entry.d_view(tmember.league_rank(),3);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, size), [&](const int i) {
+      if (flux) {
+        rbuf[n].flux(m,i) = data(offset + i);
+      } else {
+        rbuf[n].vars(m,i) = data(offset + i);
+      }
+    });
+  });
+#endif
+  return no_errors;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool MeshBoundaryValues::ClearMessages()
+//! \brief Waits for all messages in table to complete.  Persistent requests are left
+//! inactive (not freed) so they can be restarted.  Returns false on MPI error.
+
+bool MeshBoundaryValues::ClearMessages(MeshBoundaryMessages &msgs) {
+  bool no_errors=true;
+#if MPI_PARALLEL_ENABLED
+  if (!(msgs.req.empty())) {
+    int ierr = MPI_Waitall(static_cast<int>(msgs.req.size()), msgs.req.data(),
+                           MPI_STATUSES_IGNORE);
+    if (ierr != MPI_SUCCESS) {no_errors=false;}
+  }
+#endif
+  return no_errors;
+}
@@ -36,6 +36,8 @@ TaskStatus MeshBoundaryValues::InitRecv(const int nvars) {
 
   // Initialize communications of variables
   bool no_errors=true;
+  int version = pmy_pack->pmesh->nghbr_version;
+  bool build_msgs = msg_tables && !(msgs_recvvars.IsCurrent(version, nvars));
   for (int m=0; m<nmb; ++m) {
     for (int n=0; n<nnghbr; ++n) {
       if (nghbr.h_view(m,n).gid >= 0) {
@@ -44,6 +46,8 @@ TaskStatus MeshBoundaryValues::InitRecv(const int nvars) {
 
         // post non-blocking receive if neighboring MeshBlock on a different rank
         if (drank != global_variable::my_rank) {
+          // message tables only need to be rebuilt when the mesh changes
+          if (msg_tables && !(build_msgs)) {continue;}
           // create tag using local ID and buffer index of *receiving* MeshBlock
           int tag = CreateBvals_MPI_Tag(m, n);
 
@@ -62,6 +66,11 @@ TaskStatus MeshBoundaryValues::InitRecv(const int nvars) {
           }
           auto recv_ptr = Kokkos::subview(recvbuf[n].vars, m, Kokkos::ALL);
 
+          // with message tables, only record location of buffer in message from drank
+          if (msg_tables) {
+            msgs_recvvars.AddBuffer(drank, m, n, m, n, data_size);
+            continue;
+          }
           // Post non-blocking receive for this buffer on this MeshBlock
           int ierr = MPI_Irecv(recv_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
                                comm_vars, &(recvbuf[n].vars_req[m]));
@@ -70,6 +79,10 @@ TaskStatus MeshBoundaryValues::InitRecv(const int nvars) {
       }
     }
   }
+  if (msg_tables) {
+    if (build_msgs) {BuildMessages(msgs_recvvars, version, nvars, false, false);}
+    if (!(StartMessages(msgs_recvvars, false, false))) {no_errors=false;}
+  }
   // Quit if MPI error detected
   if (!(no_errors)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
@@ -102,6 +115,8 @@ TaskStatus MeshBoundaryValues::ClearRecv() {
       }
     }
   }
+  // wait for messages in tables (if any)
+  if (!(ClearMessages(msgs_recvvars))) {no_errors=false;}
   // Quit if MPI error detected
   if (!(no_errors)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
@@ -134,6 +149,8 @@ TaskStatus MeshBoundaryValues::ClearSend() {
       }
     }
   }
+  // wait for messages in tables (if any)
+  if (!(ClearMessages(msgs_sendvars))) {no_errors=false;}
   // Quit if MPI error detected
   if (!(no_errors)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
@@ -167,6 +184,8 @@ TaskStatus MeshBoundaryValues::ClearFluxRecv() {
       }
     }
   }
+  // wait for messages in tables (if any)
+  if (!(ClearMessages(msgs_recvflux))) {no_errors=false;}
 #endif
   if (no_errors) return TaskStatus::complete;
 
@@ -196,6 +215,8 @@ TaskStatus MeshBoundaryValues::ClearFluxSend() {
       }
     }
   }
+  // wait for messages in tables (if any)
+  if (!(ClearMessages(msgs_sendflux))) {no_errors=false;}
 #endif
   if (no_errors) return TaskStatus::complete;
 
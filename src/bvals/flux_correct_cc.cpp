@@ -157,6 +157,8 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendFluxCC(DvceFaceFld5D<Real> &flx) {
   // Sends only occur to neighbors on FACES at a COARSER level
   Kokkos::fence();
   bool no_errors=true;
+  int version = pmy_pack->pmesh->nghbr_version;
+  bool build_msgs = msg_tables && !(msgs_sendflux.IsCurrent(version, nvar));
   for (int m=0; m<nmb; ++m) {
     for (int n=0; n<nnghbr; ++n) {
       if ( (nghbr.h_view(m,n).gid >=0) &&
@@ -167,6 +169,8 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendFluxCC(DvceFaceFld5D<Real> &flx) {
         int drank = nghbr.h_view(m,n).rank;
 
         if (drank != my_rank) {
+          // message tables only need to be rebuilt when the mesh changes
+          if (msg_tables && !(build_msgs)) {continue;}
           // create tag using local ID and buffer index of *receiving* MeshBlock
           int lid = nghbr.h_view(m,n).gid - pmy_pack->pmesh->gids_eachrank[drank];
           int tag = CreateBvals_MPI_Tag(lid, dn);
@@ -175,6 +179,11 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendFluxCC(DvceFaceFld5D<Real> &flx) {
           int data_size = nvar*(sendbuf[n].iflxc_ndat);
           auto send_ptr = Kokkos::subview(sendbuf[n].flux, m, Kokkos::ALL);
 
+          // with message tables, only record location of buffer in message to drank
+          if (msg_tables) {
+            msgs_sendflux.AddBuffer(drank, lid, dn, m, n, data_size);
+            continue;
+          }
           int ierr = MPI_Isend(send_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
                                comm_flux, &(sendbuf[n].flux_req[m]));
           if (ierr != MPI_SUCCESS) {no_errors=false;}
@@ -182,6 +191,10 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendFluxCC(DvceFaceFld5D<Real> &flx) {
       }
     }
   }
+  if (msg_tables) {
+    if (build_msgs) {BuildMessages(msgs_sendflux, version, nvar, true, true);}
+    if (!(StartMessages(msgs_sendflux, true, true))) {no_errors=false;}
+  }
   // Quit if MPI error detected
   if (!(no_errors)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
@@ -225,6 +238,10 @@ TaskStatus MeshBoundaryValuesCC::RecvAndUnpackFluxCC(DvceFaceFld5D<Real> &flx) {
       }
     }
   }
+  // with message tables, test all messages and scatter any aggregated messages
+  if (msg_tables && !(bflag)) {
+    if (!(TestMessages(msgs_recvflux, true, bflag))) {no_errors=false;}
+  }
   // Quit if MPI error detected
   if (!(no_errors)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
@@ -309,6 +326,8 @@ TaskStatus MeshBoundaryValuesCC::InitFluxRecv(const int nvars) {
 
   // Initialize communications of fluxes
   bool no_errors=true;
+  int version = pmy_pack->pmesh->nghbr_version;
+  bool build_msgs = msg_tables && !(msgs_recvflux.IsCurrent(version, nvars));
   for (int m=0; m<nmb; ++m) {
     for (int n=0; n<nnghbr; ++n) {
       // only post receives for neighbors on FACES at FINER level
@@ -321,6 +340,8 @@ TaskStatus MeshBoundaryValuesCC::InitFluxRecv(const int nvars) {
 
         // post non-blocking receive if neighboring MeshBlock on a different rank
         if (drank != global_variable::my_rank) {
+          // message tables only need to be rebuilt when the mesh changes
+          if (msg_tables && !(build_msgs)) {continue;}
           // create tag using local ID and buffer index of *receiving* MeshBlock
           int tag = CreateBvals_MPI_Tag(m, n);
 
@@ -328,6 +349,11 @@ TaskStatus MeshBoundaryValuesCC::InitFluxRecv(const int nvars) {
           int data_size = nvars*(recvbuf[n].iflxc_ndat);
           auto recv_ptr = Kokkos::subview(recvbuf[n].flux, m, Kokkos::ALL);
 
+          // with message tables, only record location of buffer in message from drank
+          if (msg_tables) {
+            msgs_recvflux.AddBuffer(drank, m, n, m, n, data_size);
+            continue;
+          }
           // Post non-blocking receive for this buffer on this MeshBlock
           int ierr = MPI_Irecv(recv_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
                                comm_flux, &(recvbuf[n].flux_req[m]));
@@ -336,6 +362,10 @@ TaskStatus MeshBoundaryValuesCC::InitFluxRecv(const int nvars) {
       }
     }
   }
+  if (msg_tables) {
+    if (build_msgs) {BuildMessages(msgs_recvflux, version, nvars, false, true);}
+    if (!(StartMessages(msgs_recvflux, false, true))) {no_errors=false;}
+  }
   // Quit if MPI error detected
   if (!(no_errors)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
@@ -19,13 +19,14 @@
 // #define SMALL_NUMBER 1.0e-5
 
 //----------------------------------------------------------------------------------------
-//! \fn void ComputeMetricAndInverse
-//! \brief computes 10 covariant and contravariant components of metric in
-//!  Cartesian Kerr-Schild coordinates
+//! \fn void ComputeNullVector
+//! \brief computes the scalar f and spatial components of the null covector l_i which
+//!  completely determine the Cartesian Kerr-Schild metric, g_nm = f*l_n*l_m + eta_nm
+//!  (with l_0 = 1).  These four numbers are all that is stored in the metric cache.
 
 KOKKOS_INLINE_FUNCTION
-void ComputeMetricAndInverse(Real x, Real y, Real z, bool minkowski, Real a,
-                             Real glower[][4], Real gupper[][4]) {
+void ComputeNullVector(Real x, Real y, Real z, bool minkowski, Real a,
+                       Real &f, Real &l1, Real &l2, Real &l3) {
   // NOTE(@pdmullen): The following commented out floor on z dealt with the metric
   // singularity encountered for small z near the horizon (e.g., see g_00). However, this
   // floor was operating on z even for r_ks > 1.0, where (I believe) the metric should be
@@ -41,17 +42,33 @@ void ComputeMetricAndInverse(Real x, Real y, Real z, bool minkowski, Real a,
   }
   //r = fmax(r, 1.0);  // floor r_ks to 0.5*(r_inner + r_outer)
 
+  // null vector l
+  l1 = (r*x + (a)*y)/( SQR(r) + SQR(a) );
+  l2 = (r*y - (a)*x)/( SQR(r) + SQR(a) );
+  l3 = z/r;
+
+  f = 2.0 * SQR(r)*r / (SQR(SQR(r)) + SQR(a)*SQR(z));
+  if (minkowski) {f=0.0;}
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MetricAndInverseFromNullVector
+//! \brief computes 10 covariant and contravariant components of metric in
+//!  Cartesian Kerr-Schild coordinates given f and l_i from ComputeNullVector()
+
+KOKKOS_INLINE_FUNCTION
+void MetricAndInverseFromNullVector(Real f, Real l1, Real l2, Real l3,
+                                    Real glower[][4], Real gupper[][4]) {
   // Set covariant components
   // null vector l
   Real l_lower[4];
   l_lower[0] = 1.0;
-  l_lower[1] = (r*x + (a)*y)/( SQR(r) + SQR(a) );
-  l_lower[2] = (r*y - (a)*x)/( SQR(r) + SQR(a) );
-  l_lower[3] = z/r;
+  l_lower[1] = l1;
+  l_lower[2] = l2;
+  l_lower[3] = l3;
 
   // g_nm = f*l_n*l_m + eta_nm, where eta_nm is Minkowski metric
-  Real f = 2.0 * SQR(r)*r / (SQR(SQR(r)) + SQR(a)*SQR(z));
-  if (minkowski) {f=0.0;}
   glower[0][0] = f * l_lower[0]*l_lower[0] - 1.0;
   glower[0][1] = f * l_lower[0]*l_lower[1];
   glower[0][2] = f * l_lower[0]*l_lower[2];
@@ -98,6 +115,34 @@ void ComputeMetricAndInverse(Real x, Real y, Real z, bool minkowski, Real a,
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void ComputeMetricAndInverse
+//! \brief computes 10 covariant and contravariant components of metric in
+//!  Cartesian Kerr-Schild coordinates
+
+KOKKOS_INLINE_FUNCTION
+void ComputeMetricAndInverse(Real x, Real y, Real z, bool minkowski, Real a,
+                             Real glower[][4], Real gupper[][4]) {
+  Real f, l1, l2, l3;
+  ComputeNullVector(x, y, z, minkowski, a, f, l1, l2, l3);
+  MetricAndInverseFromNullVector(f, l1, l2, l3, glower, gupper);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void CachedMetricAndInverse
+//! \brief computes 10 covariant and contravariant components of metric from values of
+//!  (f, l_1, l_2, l_3) stored in the metric cache (see Coordinates::SetMetricCache())
+
+KOKKOS_INLINE_FUNCTION
+void CachedMetricAndInverse(const DvceArray5D<Real> &gcache, const int m, const int k,
+                            const int j, const int i,
+                            Real glower[][4], Real gupper[][4]) {
+  MetricAndInverseFromNullVector(gcache(m,0,k,j,i), gcache(m,1,k,j,i), gcache(m,2,k,j,i),
+                                 gcache(m,3,k,j,i), glower, gupper);
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void ComputeADMDecomposition
 //! \brief computes ADM quantities in Cartesian Kerr-Schild coordinates
@@ -269,14 +314,15 @@ void ComputeADMDecomposition(Real x, Real y, Real z, bool minkowski, Real a,
 
 
 //----------------------------------------------------------------------------------------
-//! \fn void ComputeMetricDerivatives
-//! \brief computes derivatives of metric in Cartesian Kerr-Schild coordinates, which are
-//!  used to compute the coordinate source terms in the equations of motion.
+//! \fn void ComputeNullVectorAndDerivatives
+//! \brief computes f and l_i (see ComputeNullVector()) together with their derivatives
+//!  df[d] = df/dx_d and dl[n][d] = dl_n/dx_d in Cartesian Kerr-Schild coordinates
 
 KOKKOS_INLINE_FUNCTION
-void ComputeMetricDerivatives(Real x, Real y, Real z, bool minkowski, Real a,
-                              Real dg_dx1[][4], Real dg_dx2[][4], Real dg_dx3[][4]) {
-  // NOTE(@pdmullen): See comment in ComputeMetricAndInverse
+void ComputeNullVectorAndDerivatives(Real x, Real y, Real z, bool minkowski, Real a,
+                                     Real &f, Real &l1, Real &l2, Real &l3,
+                                     Real df[3], Real dl[][3]) {
+  // NOTE(@pdmullen): See comment in ComputeNullVector
   // if (fabs(z) < (SMALL_NUMBER)) z = (SMALL_NUMBER);
   Real rad = sqrt(SQR(x) + SQR(y) + SQR(z));
   Real r = sqrt((SQR(rad)-SQR(a)+sqrt(SQR(SQR(rad)-SQR(a))+4.0*SQR(a)*SQR(z)))/2.0);
@@ -286,97 +332,95 @@ void ComputeMetricDerivatives(Real x, Real y, Real z, bool minkowski, Real a,
   }
   //r = fmax(r, 1.0);  // floor r_ks to 0.5*(r_inner + r_outer)
 
-  Real llower[4];
-  llower[0] = 1.0;
-  llower[1] = (r*x + a * y)/( SQR(r) + SQR(a) );
-  llower[2] = (r*y - a * x)/( SQR(r) + SQR(a) );
-  llower[3] = z/r;
+  l1 = (r*x + a * y)/( SQR(r) + SQR(a) );
+  l2 = (r*y - a * x)/( SQR(r) + SQR(a) );
+  l3 = z/r;
 
   Real qa = 2.0*SQR(r) - SQR(rad) + SQR(a);
   Real qb = SQR(r) + SQR(a);
   Real qc = 3.0*SQR(a * z)-SQR(r)*SQR(r);
-  Real f = 2.0 * SQR(r)*r / (SQR(SQR(r)) + SQR(a)*SQR(z));
-
-  Real df_dx1 = SQR(f)*x/(2.0*pow(r,3)) * ( ( qc ) )/ qa;
-  Real df_dx2 = SQR(f)*y/(2.0*pow(r,3)) * ( ( qc ) )/ qa;
-  Real df_dx3 = SQR(f)*z/(2.0*pow(r,5)) * ( ( qc * qb ) / qa - 2.0*SQR(a*r));
-  Real dl1_dx1 = x*r * ( SQR(a)*x - 2.0*a*r*y - SQR(r)*x )/( SQR(qb) * qa ) + r/( qb );
-  Real dl1_dx2 = y*r * ( SQR(a)*x - 2.0*a*r*y - SQR(r)*x )/( SQR(qb) * qa ) + a/( qb );
-  Real dl1_dx3 = z/r * ( SQR(a)*x - 2.0*a*r*y - SQR(r)*x )/( (qb) * qa );
-  Real dl2_dx1 = x*r * ( SQR(a)*y + 2.0*a*r*x - SQR(r)*y )/( SQR(qb) * qa ) - a/( qb );
-  Real dl2_dx2 = y*r * ( SQR(a)*y + 2.0*a*r*x - SQR(r)*y )/( SQR(qb) * qa ) + r/( qb );
-  Real dl2_dx3 = z/r * ( SQR(a)*y + 2.0*a*r*x - SQR(r)*y )/( (qb) * qa );
-  Real dl3_dx1 = - x*z/(r*qa);
-  Real dl3_dx2 = - y*z/(r*qa);
-  Real dl3_dx3 = - SQR(z)/(SQR(r)*r) * ( qb )/( qa ) + 1.0/r;
-
-  Real dl0_dx1 = 0.0;
-  Real dl0_dx2 = 0.0;
-  Real dl0_dx3 = 0.0;
+  f = 2.0 * SQR(r)*r / (SQR(SQR(r)) + SQR(a)*SQR(z));
+
+  df[0] = SQR(f)*x/(2.0*pow(r,3)) * ( ( qc ) )/ qa;
+  df[1] = SQR(f)*y/(2.0*pow(r,3)) * ( ( qc ) )/ qa;
+  df[2] = SQR(f)*z/(2.0*pow(r,5)) * ( ( qc * qb ) / qa - 2.0*SQR(a*r));
+  dl[0][0] = x*r * ( SQR(a)*x - 2.0*a*r*y - SQR(r)*x )/( SQR(qb) * qa ) + r/( qb );
+  dl[0][1] = y*r * ( SQR(a)*x - 2.0*a*r*y - SQR(r)*x )/( SQR(qb) * qa ) + a/( qb );
+  dl[0][2] = z/r * ( SQR(a)*x - 2.0*a*r*y - SQR(r)*x )/( (qb) * qa );
+  dl[1][0] = x*r * ( SQR(a)*y + 2.0*a*r*x - SQR(r)*y )/( SQR(qb) * qa ) - a/( qb );
+  dl[1][1] = y*r * ( SQR(a)*y + 2.0*a*r*x - SQR(r)*y )/( SQR(qb) * qa ) + r/( qb );
+  dl[1][2] = z/r * ( SQR(a)*y + 2.0*a*r*x - SQR(r)*y )/( (qb) * qa );
+  dl[2][0] = - x*z/(r*qa);
+  dl[2][1] = - y*z/(r*qa);
+  dl[2][2] = - SQR(z)/(SQR(r)*r) * ( qb )/( qa ) + 1.0/r;
 
   if (minkowski) {
     f = 0.0;
-    df_dx1 = 0.0;
-    df_dx2 = 0.0;
-    df_dx3 = 0.0;
+    df[0] = 0.0;
+    df[1] = 0.0;
+    df[2] = 0.0;
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MetricDerivativesFromNullVector
+//! \brief computes derivatives of metric, dg_nm/dx_d = df/dx_d*l_n*l_m +
+//!  f*dl_n/dx_d*l_m + f*l_n*dl_m/dx_d, from output of ComputeNullVectorAndDerivatives()
+
+KOKKOS_INLINE_FUNCTION
+void MetricDerivativesFromNullVector(Real f, Real l1, Real l2, Real l3,
+                                     const Real df[3], const Real dl[][3],
+                                     Real dg_dx1[][4], Real dg_dx2[][4],
+                                     Real dg_dx3[][4]) {
+  Real llower[4] = {1.0, l1, l2, l3};
+  Real (*dg_dx[3])[4] = {dg_dx1, dg_dx2, dg_dx3};
+  for (int d=0; d<3; ++d) {
+    Real dl_dx[4] = {0.0, dl[0][d], dl[1][d], dl[2][d]};
+    for (int a=0; a<4; ++a) {
+      for (int b=a; b<4; ++b) {
+        dg_dx[d][a][b] = df[d]*llower[a]*llower[b] + f*dl_dx[a]*llower[b]
+                       + f*llower[a]*dl_dx[b];
+        dg_dx[d][b][a] = dg_dx[d][a][b];
+      }
+    }
   }
+  return;
+}
 
-  // Set x-derivatives of covariant components
-  dg_dx1[0][0] = df_dx1*llower[0]*llower[0] + f*dl0_dx1*llower[0] + f*llower[0]*dl0_dx1;
-  dg_dx1[0][1] = df_dx1*llower[0]*llower[1] + f*dl0_dx1*llower[1] + f*llower[0]*dl1_dx1;
-  dg_dx1[0][2] = df_dx1*llower[0]*llower[2] + f*dl0_dx1*llower[2] + f*llower[0]*dl2_dx1;
-  dg_dx1[0][3] = df_dx1*llower[0]*llower[3] + f*dl0_dx1*llower[3] + f*llower[0]*dl3_dx1;
-  dg_dx1[1][0] = dg_dx1[0][1];
-  dg_dx1[1][1] = df_dx1*llower[1]*llower[1] + f*dl1_dx1*llower[1] + f*llower[1]*dl1_dx1;
-  dg_dx1[1][2] = df_dx1*llower[1]*llower[2] + f*dl1_dx1*llower[2] + f*llower[1]*dl2_dx1;
-  dg_dx1[1][3] = df_dx1*llower[1]*llower[3] + f*dl1_dx1*llower[3] + f*llower[1]*dl3_dx1;
-  dg_dx1[2][0] = dg_dx1[0][2];
-  dg_dx1[2][1] = dg_dx1[1][2];
-  dg_dx1[2][2] = df_dx1*llower[2]*llower[2] + f*dl2_dx1*llower[2] + f*llower[2]*dl2_dx1;
-  dg_dx1[2][3] = df_dx1*llower[2]*llower[3] + f*dl2_dx1*llower[3] + f*llower[2]*dl3_dx1;
-  dg_dx1[3][0] = dg_dx1[0][3];
-  dg_dx1[3][1] = dg_dx1[1][3];
-  dg_dx1[3][2] = dg_dx1[2][3];
-  dg_dx1[3][3] = df_dx1*llower[3]*llower[3] + f*dl3_dx1*llower[3] + f*llower[3]*dl3_dx1;
-
-  // Set y-derivatives of covariant components
-  dg_dx2[0][0] = df_dx2*llower[0]*llower[0] + f*dl0_dx2*llower[0] + f*llower[0]*dl0_dx2;
-  dg_dx2[0][1] = df_dx2*llower[0]*llower[1] + f*dl0_dx2*llower[1] + f*llower[0]*dl1_dx2;
-  dg_dx2[0][2] = df_dx2*llower[0]*llower[2] + f*dl0_dx2*llower[2] + f*llower[0]*dl2_dx2;
-  dg_dx2[0][3] = df_dx2*llower[0]*llower[3] + f*dl0_dx2*llower[3] + f*llower[0]*dl3_dx2;
-  dg_dx2[1][0] = dg_dx2[0][1];
-  dg_dx2[1][1] = df_dx2*llower[1]*llower[1] + f*dl1_dx2*llower[1] + f*llower[1]*dl1_dx2;
-  dg_dx2[1][2] = df_dx2*llower[1]*llower[2] + f*dl1_dx2*llower[2] + f*llower[1]*dl2_dx2;
-  dg_dx2[1][3] = df_dx2*llower[1]*llower[3] + f*dl1_dx2*llower[3] + f*llower[1]*dl3_dx2;
-  dg_dx2[2][0] = dg_dx2[0][2];
-  dg_dx2[2][1] = dg_dx2[1][2];
-  dg_dx2[2][2] = df_dx2*llower[2]*llower[2] + f*dl2_dx2*llower[2] + f*llower[2]*dl2_dx2;
-  dg_dx2[2][3] = df_dx2*llower[2]*llower[3] + f*dl2_dx2*llower[3] + f*llower[2]*dl3_dx2;
-  dg_dx2[3][0] = dg_dx2[0][3];
-  dg_dx2[3][1] = dg_dx2[1][3];
-  dg_dx2[3][2] = dg_dx2[2][3];
-  dg_dx2[3][3] = df_dx2*llower[3]*llower[3] + f*dl3_dx2*llower[3] + f*llower[3]*dl3_dx2;
-
-  // Set phi-derivatives of covariant components
-  dg_dx3[0][0] = df_dx3*llower[0]*llower[0] + f*dl0_dx3*llower[0] + f*llower[0]*dl0_dx3;
-  dg_dx3[0][1] = df_dx3*llower[0]*llower[1] + f*dl0_dx3*llower[1] + f*llower[0]*dl1_dx3;
-  dg_dx3[0][2] = df_dx3*llower[0]*llower[2] + f*dl0_dx3*llower[2] + f*llower[0]*dl2_dx3;
-  dg_dx3[0][3] = df_dx3*llower[0]*llower[3] + f*dl0_dx3*llower[3] + f*llower[0]*dl3_dx3;
-  dg_dx3[1][0] = dg_dx3[0][1];
-  dg_dx3[1][1] = df_dx3*llower[1]*llower[1] + f*dl1_dx3*llower[1] + f*llower[1]*dl1_dx3;
-  dg_dx3[1][2] = df_dx3*llower[1]*llower[2] + f*dl1_dx3*llower[2] + f*llower[1]*dl2_dx3;
-  dg_dx3[1][3] = df_dx3*llower[1]*llower[3] + f*dl1_dx3*llower[3] + f*llower[1]*dl3_dx3;
-  dg_dx3[2][0] = dg_dx3[0][2];
-  dg_dx3[2][1] = dg_dx3[1][2];
-  dg_dx3[2][2] = df_dx3*llower[2]*llower[2] + f*dl2_dx3*llower[2] + f*llower[2]*dl2_dx3;
-  dg_dx3[2][3] = df_dx3*llower[2]*llower[3] + f*dl2_dx3*llower[3] + f*llower[2]*dl3_dx3;
-  dg_dx3[3][0] = dg_dx3[0][3];
-  dg_dx3[3][1] = dg_dx3[1][3];
-  dg_dx3[3][2] = dg_dx3[2][3];
-  dg_dx3[3][3] = df_dx3*llower[3]*llower[3] + f*dl3_dx3*llower[3] + f*llower[3]*dl3_dx3;
+//----------------------------------------------------------------------------------------
+//! \fn void ComputeMetricDerivatives
+//! \brief computes derivatives of metric in Cartesian Kerr-Schild coordinates, which are
+//!  used to compute the coordinate source terms in the equations of motion.
 
+KOKKOS_INLINE_FUNCTION
+void ComputeMetricDerivatives(Real x, Real y, Real z, bool minkowski, Real a,
+                              Real dg_dx1[][4], Real dg_dx2[][4], Real dg_dx3[][4]) {
+  Real f, l1, l2, l3, df[3], dl[3][3];
+  ComputeNullVectorAndDerivatives(x, y, z, minkowski, a, f, l1, l2, l3, df, dl);
+  MetricDerivativesFromNullVector(f, l1, l2, l3, df, dl, dg_dx1, dg_dx2, dg_dx3);
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void CachedMetricDerivatives
+//! \brief computes derivatives of metric from values stored in the cell-centered metric
+//!  cache, which holds (f, l_1, l_2, l_3, df/dx_d, dl_1/dx_d, dl_2/dx_d, dl_3/dx_d)
+
+KOKKOS_INLINE_FUNCTION
+void CachedMetricDerivatives(const DvceArray5D<Real> &gcache, const int m, const int k,
+                             const int j, const int i,
+                             Real dg_dx1[][4], Real dg_dx2[][4], Real dg_dx3[][4]) {
+  Real df[3], dl[3][3];
+  for (int d=0; d<3; ++d) {
+    df[d] = gcache(m,4+d,k,j,i);
+    dl[0][d] = gcache(m,7+d,k,j,i);
+    dl[1][d] = gcache(m,10+d,k,j,i);
+    dl[2][d] = gcache(m,13+d,k,j,i);
+  }
+  MetricDerivativesFromNullVector(gcache(m,0,k,j,i), gcache(m,1,k,j,i), gcache(m,2,k,j,i),
+                                  gcache(m,3,k,j,i), df, dl, dg_dx1, dg_dx2, dg_dx3);
+  return;
+}
 
 #endif // COORDINATES_CARTESIAN_KS_HPP_
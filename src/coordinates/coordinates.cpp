@@ -113,6 +113,15 @@ Coordinates::Coordinates(ParameterInput *pin, MeshBlockPack *ppack) :
       }
     }
   }
+
+  // Optionally cache the (stationary) metric at cell centers and faces.  Since this
+  // constructor is called again after every AMR step, cache is rebuilt only then.
+  if (is_general_relativistic) {
+    coord_data.metric_cache = pin->GetOrAddBoolean("coord","metric_cache",false);
+    if (coord_data.metric_cache) {
+      SetMetricCache();
+    }
+  }
 }
 
 //----------------------------------------------------------------------------------------
@@ -129,6 +138,8 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim, const EOS_Data &e
   auto &size = pmy_pack->pmb->mb_size;
   auto &flat = coord_data.is_minkowski;
   auto &spin = coord_data.bh_spin;
+  auto &use_cache = coord_data.metric_cache;
+  auto &gcc = coord_data.gcc;
 
   Real gamma_prime = eos.gamma / (eos.gamma - 1.0);
 
@@ -149,7 +160,11 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim, const EOS_Data &e
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (use_cache) {
+      CachedMetricAndInverse(gcc, m, k, j, i, glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Extract primitives
     const Real &rho  = prim(m,IDN,k,j,i);
@@ -186,7 +201,11 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim, const EOS_Data &e
 
     // compute derivatives of metric.
     Real dg_dx1[4][4], dg_dx2[4][4], dg_dx3[4][4];
-    ComputeMetricDerivatives(x1v, x2v, x3v, flat, spin, dg_dx1, dg_dx2, dg_dx3);
+    if (use_cache) {
+      CachedMetricDerivatives(gcc, m, k, j, i, dg_dx1, dg_dx2, dg_dx3);
+    } else {
+      ComputeMetricDerivatives(x1v, x2v, x3v, flat, spin, dg_dx1, dg_dx2, dg_dx3);
+    }
 
     // Calculate source terms, exploiting symmetries
     Real s_1 = 0.0, s_2 = 0.0, s_3 = 0.0;
@@ -252,6 +271,8 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim,
   auto &size = pmy_pack->pmb->mb_size;
   auto &flat = coord_data.is_minkowski;
   auto &spin = coord_data.bh_spin;
+  auto &use_cache = coord_data.metric_cache;
+  auto &gcc = coord_data.gcc;
 
   Real gamma_prime = eos.gamma / (eos.gamma - 1.0);
 
@@ -272,7 +293,11 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim,
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (use_cache) {
+      CachedMetricAndInverse(gcc, m, k, j, i, glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Extract primitives
     const Real &rho  = prim(m,IDN,k,j,i);
@@ -330,7 +355,11 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim,
 
     // compute derivatives of metric.
     Real dg_dx1[4][4], dg_dx2[4][4], dg_dx3[4][4];
-    ComputeMetricDerivatives(x1v, x2v, x3v, flat, spin, dg_dx1, dg_dx2, dg_dx3);
+    if (use_cache) {
+      CachedMetricDerivatives(gcc, m, k, j, i, dg_dx1, dg_dx2, dg_dx3);
+    } else {
+      ComputeMetricDerivatives(x1v, x2v, x3v, flat, spin, dg_dx1, dg_dx2, dg_dx3);
+    }
 
     // Calculate source terms
     Real s_1 = 0.0, s_2 = 0.0, s_3 = 0.0;
@@ -46,8 +46,18 @@ struct CoordData {
   bool smooth_excision = false;    // flag to specify smooth excision (fastflow)
   Real horizon_factor;             // factor to muliply the horizon factor by (fastflow)
   Real tdamp;                      // damping time (needed for smooth excision)
+
+  // optional cache of stationary metric.  Rather than the 10 independent components of
+  // g_nm and g^nm, only f and l_i (where g_nm = f*l_n*l_m + eta_nm) are stored
+  bool metric_cache = false;       // flag to use cached metric in GR kernels
+  DvceArray5D<Real> gcc;           // f, l_i, df/dx_d, dl_i/dx_d at cell centers
+  DvceFaceFld5D<Real> gfc{"gfc",1,1,1,1,1};  // f, l_i at cell faces
 };
 
+// number of values stored per point in cell-centered and face-centered metric caches
+static constexpr int nmetric_cc = 16;
+static constexpr int nmetric_fc = 4;
+
 //----------------------------------------------------------------------------------------
 //! \class Coordinates
 //! \brief data and functions for coordinates
@@ -75,6 +85,7 @@ class Coordinates {
   void CoordSrcTerms(const DvceArray5D<Real> &w0, const DvceArray5D<Real> &bcc,
                      const EOS_Data &eos, const Real dt, DvceArray5D<Real> &u0);
   void SetExcisionMasks(DvceArray4D<bool> &floor, DvceArray4D<bool> &flux);
+  void SetMetricCache();
 
   void UpdateExcisionMasks();
 
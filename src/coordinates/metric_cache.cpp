@@ -0,0 +1,109 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file metric_cache.cpp
+//! \brief fills optional cache of stationary Cartesian Kerr-Schild metric at cell centers
+//! and faces.  Since the metric is g_nm = f*l_n*l_m + eta_nm, only f and the three
+//! spatial components l_i are stored (rather than 20 components of g_nm and g^nm), plus
+//! their 12 spatial derivatives at cell centers for the coordinate source terms.  The
+//! cache is filled when the Coordinates object is constructed, which happens again after
+//! every AMR step, so it is rebuilt only when the MeshBlocks change.
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "coordinates.hpp"
+#include "cartesian_ks.hpp"
+#include "cell_locations.hpp"
+
+//----------------------------------------------------------------------------------------
+//! \fn void Coordinates::SetMetricCache()
+//  \brief Allocates and fills metric cache at cell centers and faces (including ghost
+//  zones).  Cell-centered values are stored at gcc(m,n,k,j,i) with n=0..15 ordered as
+//  (f, l_1, l_2, l_3, df/dx_d, dl_1/dx_d, dl_2/dx_d, dl_3/dx_d) for d=1..3.  Face values
+//  are stored at gfc.x?f(m,n,k,j,i) with n=0..3 ordered as (f, l_1, l_2, l_3).
+
+void Coordinates::SetMetricCache() {
+  // capture variables for kernel
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is; int js = indcs.js; int ks = indcs.ks;
+  int &ng = indcs.ng;
+  int n1 = indcs.nx1 + 2*ng;
+  int n2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng) : 1;
+  int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng) : 1;
+  int nmb = pmy_pack->nmb_thispack;
+  auto &size = pmy_pack->pmb->mb_size;
+  auto &flat = coord_data.is_minkowski;
+  auto &spin = coord_data.bh_spin;
+
+  Kokkos::realloc(coord_data.gcc, nmb, nmetric_cc, n3, n2, n1);
+  Kokkos::realloc(coord_data.gfc.x1f, nmb, nmetric_fc, n3, n2, n1+1);
+  Kokkos::realloc(coord_data.gfc.x2f, nmb, nmetric_fc, n3, n2+1, n1);
+  Kokkos::realloc(coord_data.gfc.x3f, nmb, nmetric_fc, n3+1, n2, n1);
+  auto gcc = coord_data.gcc;
+  auto gx1f = coord_data.gfc.x1f;
+  auto gx2f = coord_data.gfc.x2f;
+  auto gx3f = coord_data.gfc.x3f;
+
+  // cell centers
+  par_for("metric_cache_cc", DevExeSpace(), 0, nmb-1, 0, (n3-1), 0, (n2-1), 0, (n1-1),
+  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    Real &x1min = size.d_view(m).x1min;
+    Real &x1max = size.d_view(m).x1max;
+    Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+
+    Real &x2min = size.d_view(m).x2min;
+    Real &x2max = size.d_view(m).x2max;
+    Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+
+    Real &x3min = size.d_view(m).x3min;
+    Real &x3max = size.d_view(m).x3max;
+    Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+
+    Real f, l1, l2, l3, df[3], dl[3][3];
+    ComputeNullVectorAndDerivatives(x1v, x2v, x3v, flat, spin, f, l1, l2, l3, df, dl);
+    gcc(m,0,k,j,i) = f;
+    gcc(m,1,k,j,i) = l1;
+    gcc(m,2,k,j,i) = l2;
+    gcc(m,3,k,j,i) = l3;
+    for (int d=0; d<3; ++d) {
+      gcc(m,4+d,k,j,i) = df[d];
+      gcc(m,7+d,k,j,i) = dl[0][d];
+      gcc(m,10+d,k,j,i) = dl[1][d];
+      gcc(m,13+d,k,j,i) = dl[2][d];
+    }
+  });
+
+  // x1-faces
+  par_for("metric_cache_x1f", DevExeSpace(), 0, nmb-1, 0, (n3-1), 0, (n2-1), 0, n1,
+  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    Real x1f = LeftEdgeX  (i-is, indcs.nx1, size.d_view(m).x1min, size.d_view(m).x1max);
+    Real x2v = CellCenterX(j-js, indcs.nx2, size.d_view(m).x2min, size.d_view(m).x2max);
+    Real x3v = CellCenterX(k-ks, indcs.nx3, size.d_view(m).x3min, size.d_view(m).x3max);
+    ComputeNullVector(x1f, x2v, x3v, flat, spin, gx1f(m,0,k,j,i), gx1f(m,1,k,j,i),
+                      gx1f(m,2,k,j,i), gx1f(m,3,k,j,i));
+  });
+
+  // x2-faces
+  par_for("metric_cache_x2f", DevExeSpace(), 0, nmb-1, 0, (n3-1), 0, n2, 0, (n1-1),
+  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    Real x1v = CellCenterX(i-is, indcs.nx1, size.d_view(m).x1min, size.d_view(m).x1max);
+    Real x2f = LeftEdgeX  (j-js, indcs.nx2, size.d_view(m).x2min, size.d_view(m).x2max);
+    Real x3v = CellCenterX(k-ks, indcs.nx3, size.d_view(m).x3min, size.d_view(m).x3max);
+    ComputeNullVector(x1v, x2f, x3v, flat, spin, gx2f(m,0,k,j,i), gx2f(m,1,k,j,i),
+                      gx2f(m,2,k,j,i), gx2f(m,3,k,j,i));
+  });
+
+  // x3-faces
+  par_for("metric_cache_x3f", DevExeSpace(), 0, nmb-1, 0, n3, 0, (n2-1), 0, (n1-1),
+  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    Real x1v = CellCenterX(i-is, indcs.nx1, size.d_view(m).x1min, size.d_view(m).x1max);
+    Real x2v = CellCenterX(j-js, indcs.nx2, size.d_view(m).x2min, size.d_view(m).x2max);
+    Real x3f = LeftEdgeX  (k-ks, indcs.nx3, size.d_view(m).x3min, size.d_view(m).x3max);
+    ComputeNullVector(x1v, x2v, x3f, flat, spin, gx3f(m,0,k,j,i), gx3f(m,1,k,j,i),
+                      gx3f(m,2,k,j,i), gx3f(m,3,k,j,i));
+  });
+
+  return;
+}
@@ -11,6 +11,7 @@
 #include <limits>
 #include <algorithm>
 #include <string> // string
+#include <thread> // yield
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -23,6 +24,7 @@
 #include "dyn_grmhd/dyn_grmhd.hpp"
 #include "ion-neutral/ion-neutral.hpp"
 #include "radiation/radiation.hpp"
+#include "utils/profiler.hpp"
 #include "driver.hpp"
 
 #if MPI_PARALLEL_ENABLED
@@ -277,6 +279,9 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
       exit(EXIT_FAILURE);
     }
   }
+
+  // set up built-in timers of Tasks and kernels
+  profiler::Initialize(pin);
 }
 
 //----------------------------------------------------------------------------------------
@@ -292,14 +297,21 @@ void Driver::ExecuteTaskList(Mesh *pm, std::string tl, int stage) {
   }
   int npack_left = (pm->nmb_packs_thisrank);
   while (npack_left > 0) {
+    // all packs are idle unless at least one Task completes in this pass
+    bool idle = true;
     if (pmbp->tl_map[tl]->Empty()) {
       npack_left--;
+      idle = false;
     } else {
       if (!pmbp->tl_map[tl]->IsComplete()) {
         auto status = pmbp->tl_map[tl]->DoAvailable(this, stage);
         if (status == TaskListStatus::complete) { npack_left--; }
+        if (status != TaskListStatus::stuck) { idle = false; }
       }
     }
+    // every remaining Task is waiting (e.g. on MPI messages), so yield the processor
+    // rather than immediately polling again
+    if (idle && npack_left > 0) { std::this_thread::yield(); }
   }
   return;
 }
@@ -312,12 +324,17 @@ void Driver::ExecuteTaskList(Mesh *pm, std::string tl, int stage) {
 void Driver::Initialize(Mesh *pmesh, ParameterInput *pin, Outputs *pout, bool res_flag) {
   //---- Step 1.  Set conserved variables in ghost zones for all physics
   InitBoundaryValuesAndPrimitives(pmesh);
-
-  //---- Step 2.  Compute time step (if problem involves time evolution)
   hydro::Hydro *phydro = pmesh->pmb_pack->phydro;
   mhd::MHD *pmhd = pmesh->pmb_pack->pmhd;
   radiation::Radiation *prad = pmesh->pmb_pack->prad;
   z4c::Z4c *pz4c = pmesh->pmb_pack->pz4c;
+  // ADM variables are derived from Z4c variables on restarts, and packed restart files
+  // do not contain the Z4c ghost zones, so recompute ADM everywhere now they are set
+  if (res_flag && pz4c != nullptr) {
+    pz4c->Z4cToADM(pmesh->pmb_pack);
+  }
+
+  //---- Step 2.  Compute time step (if problem involves time evolution)
   if (time_evolution != TimeEvolution::tstatic) {
     if (phydro != nullptr) {
       (void) pmesh->pmb_pack->phydro->NewTimeStep(this, nexp_stages);
@@ -391,6 +408,13 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
            (elapsed_time < wall_time)) {
       if (global_variable::my_rank == 0) {OutputCycleDiagnostics(pmesh);}
 
+      // Let outputs know if they are due at end of this cycle, so that work such as
+      // history sums can be done within the tasks of the last stage
+      for (auto &out : pout->pout_list) {
+        out->PrepareCycle(pmesh, out->OutputDue(pmesh->time + pmesh->dt,
+                                                pmesh->ncycle + 1, tlim));
+      }
+
       // Execute TaskLists
       // Work before time integrator indicated by "0" in stage
       ExecuteTaskList(pmesh, "before_timeintegrator", 0);
@@ -412,26 +436,22 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
       pmesh->dt_last_completed = pmesh->dt;
       nmb_updated_ += pmesh->nmb_total;
       npart_updated_ += pmesh->nprtcl_total;
-      // load balancing efficiency
+      // dump timers accumulated so far (if needed)
+      if ((profiler::dump_cycles > 0) && (pmesh->ncycle % profiler::dump_cycles == 0)) {
+        profiler::DumpJSON(pin->GetString("job","basename"), pmesh->ncycle, pmesh->time);
+      }
+      // measured cost of each MeshBlock (if needed)
+      if (pmesh->mbcost.measured) {pmesh->UpdateMeasuredCost();}
+      // load balancing efficiency, based on cost of MeshBlocks on each rank
       if (global_variable::nranks > 1) {
-        int minnmb = std::numeric_limits<int>::max();
-        for (int i=0; i<global_variable::nranks; ++i) {
-          minnmb = std::min(minnmb, pmesh->nmb_eachrank[i]);
-        }
-        lb_efficiency_ += static_cast<float>(minnmb*(global_variable::nranks))/
-            static_cast<float>(pmesh->nmb_total);
+        float min_cost, max_cost, total_cost;
+        pmesh->CostPerRank(min_cost, max_cost, total_cost);
+        lb_efficiency_ += min_cost*static_cast<float>(global_variable::nranks)/total_cost;
       }
 
       // Test for/make outputs
       for (auto &out : pout->pout_list) {
-        // compare at floating point (32-bit) precision to reduce effect of round off
-        float time_32 = static_cast<float>(pmesh->time);
-        float next_32 = static_cast<float>(out->out_params.last_time+out->out_params.dt);
-        float tlim_32 = static_cast<float>(tlim);
-        int &dcycle_ = out->out_params.dcycle;
-
-        if (((out->out_params.dt > 0.0) && ((time_32 >= next_32) && (time_32<tlim_32))) ||
-            ((dcycle_ > 0) && ((pmesh->ncycle)%(dcycle_) == 0)) ) {
+        if (out->OutputDue(pmesh->time, pmesh->ncycle, tlim)) {
           out->LoadOutputData(pmesh);
           out->WriteOutputFile(pmesh, pin);
         }
@@ -439,12 +459,15 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
 
       // AMR
       if (pmesh->adaptive) {pmesh->pmr->AdaptiveMeshRefinement(this, pin);}
-      // compute new timestep AFTER all Meshblocks refined/derefined
-      pmesh->NewTimeStep(tlim);
-
-      // Update wall clock time if needed.
+      // rebalance MeshBlocks if measured load imbalance is too large
+      if (pmesh->mbcost.threshold > 0.0) {pmesh->pmr->CheckLoadImbalance(this, pin);}
+      // compute new timestep AFTER all Meshblocks refined/derefined.  If needed, update
+      // wall clock time (maximum over all ranks) in the same reduction as the timestep.
       if (wall_time > 0.) {
-        elapsed_time = UpdateWallClock();
+        elapsed_time = pwall_clock_->seconds();
+        pmesh->NewTimeStep(tlim, &elapsed_time);
+      } else {
+        pmesh->NewTimeStep(tlim);
       }
     }  // end while
   }    // end of (time_evolution != tstatic) clause
@@ -460,8 +483,10 @@ void Driver::Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
   // cycle through output Types and load data / write files
   //  This design allows for asynchronous outputs to implemented in the future.
   for (auto &out : pout->pout_list) {
+    out->PrepareCycle(pmesh, false);
     out->LoadOutputData(pmesh);
     out->WriteOutputFile(pmesh, pin);
+    out->Finish(pmesh);
   }
 
   // call any problem specific functions to do work after main loop
@@ -469,12 +494,17 @@ void Driver::Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
     (pmesh->pgen->pgen_final_func)(pin, pmesh);
   }
 
+  // finish any asynchronous writes so that all files are complete on return
+  if (pout->pasync != nullptr) {pout->pasync->Wait();}
+  // finish draining node-local restart files, and record them in the manifest
+  if (pout->pdrain != nullptr) {pout->pdrain->UpdateManifest(true);}
+
   float exe_time = run_time_.seconds();
 
   if (time_evolution != TimeEvolution::tstatic) {
 #if MPI_PARALLEL_ENABLED
     // Collect number of MeshBlocks communicated during load balancing across all ranks
-    if (pmesh->adaptive) {
+    if (pmesh->pmr != nullptr) {
       MPI_Allreduce(MPI_IN_PLACE, &(pmesh->pmr->nmb_sent_thisrank), 1, MPI_INT, MPI_SUM,
                     MPI_COMM_WORLD);
     }
@@ -500,6 +530,13 @@ void Driver::Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
 #if MPI_PARALLEL_ENABLED
         std::cout << pmesh->pmr->nmb_sent_thisrank << " communicated for load balancing, "
           <<"load balancing efficiency = " << (lb_efficiency_/pmesh->ncycle) << std::endl;
+#endif
+      } else if (pmesh->mbcost.threshold > 0.0) {
+#if MPI_PARALLEL_ENABLED
+        std::cout << std::endl << "MeshBlocks rebalanced " << pmesh->pmr->nrebalance
+          << " times, " << pmesh->pmr->nmb_sent_thisrank << " communicated for load "
+          << "balancing, load balancing efficiency = " << (lb_efficiency_/pmesh->ncycle)
+          << std::endl;
 #endif
       }
 
@@ -514,8 +551,20 @@ void Driver::Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
       std::cout << "cpu time used  = " << exe_time << std::endl;
       std::cout << "zone-cycles/cpu_second = " << zcps << std::endl;
       std::cout << "particle-updates/cpu_second = " << pups << std::endl;
+      if (pout->pasync != nullptr) {
+        std::cout << pout->pasync->nfiles << " files written asynchronously, "
+                  << "time spent waiting for I/O thread = " << pout->pasync->wait_time
+                  << std::endl;
+      }
+      if (pout->pdrain != nullptr) {
+        std::cout << pout->pdrain->nfiles << " restart files drained from local_dir, "
+                  << "time spent draining = " << pout->pdrain->drain_time << std::endl;
+      }
     }
   }
+
+  // print tables of Task and kernel timers (if enabled)
+  profiler::Report(exe_time);
   return;
 }
 
@@ -542,6 +591,8 @@ void Driver::OutputCycleDiagnostics(Mesh *pm) {
 //! and 2) may reach the end of a loop to update their timers at slightly different times.
 //! This may result in a weird problem where one or more ranks have timers that fall
 //! slightly below the wall clock time while others determine that it's time to quit.
+//! Only used before the main loop; within the loop the wall clock is reduced together
+//! with the timestep in Mesh::NewTimeStep(), avoiding an extra collective every cycle.
 
 Real Driver::UpdateWallClock() {
   Real tnow = 0.0;
@@ -549,7 +600,7 @@ Real Driver::UpdateWallClock() {
     tnow = pwall_clock_->seconds();
   }
 #if MPI_PARALLEL_ENABLED
-  MPI_Bcast(&tnow, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+  MPI_Bcast(&tnow, 1, MPI_ATHENA_REAL, 0, MPI_COMM_WORLD);
 #endif
   return tnow;
 }
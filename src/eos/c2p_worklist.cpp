@@ -0,0 +1,41 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file c2p_worklist.cpp
+//! \brief implements C2PWorklist class
+
+#include "athena.hpp"
+#include "c2p_worklist.hpp"
+
+//----------------------------------------------------------------------------------------
+//! \fn void C2PWorklist::Resize()
+//! \brief reallocates flag and list arrays if they are too small to hold n cells.  Arrays
+//! are never shrunk, since the range of cells passed to ConsToPrim varies between calls.
+
+void C2PWorklist::Resize(const int n) {
+  if (static_cast<int>(flag.extent(0)) < n) {
+    Kokkos::realloc(flag, n);
+    Kokkos::realloc(list, n);
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn int C2PWorklist::Compact()
+//! \brief exclusive scan over flags set in the fast pass, storing the index of each
+//! flagged cell in list.  Returns number of flagged cells.
+
+int C2PWorklist::Compact(const int n) {
+  auto &flag_ = flag;
+  auto &list_ = list;
+  int nflag = 0;
+  Kokkos::parallel_scan("c2p_compact", Kokkos::RangePolicy<DevExeSpace>(0, n),
+  KOKKOS_LAMBDA(const int idx, int &partial, const bool final) {
+    if (flag_(idx)) {
+      if (final) {list_(partial) = idx;}
+      partial += 1;
+    }
+  }, nflag);
+  return nflag;
+}
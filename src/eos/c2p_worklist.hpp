@@ -0,0 +1,37 @@
+#ifndef EOS_C2P_WORKLIST_HPP_
+#define EOS_C2P_WORKLIST_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file c2p_worklist.hpp
+//! \brief definitions for C2PWorklist class, used to implement two-pass conservative to
+//! primitive variable inversion.
+//!
+//! Most cells converge in a few iterations of the root finder, while a few cells near
+//! floors or the horizon need many.  In the first (fast) pass all cells are inverted
+//! with a small iteration budget, and cells that do not converge set a flag rather than
+//! storing a result.  Flagged cells are then compacted into a list by a prefix scan, and
+//! a second pass runs the full solver only over that list.
+
+#include "athena.hpp"
+
+//----------------------------------------------------------------------------------------
+//! \class C2PWorklist
+
+class C2PWorklist {
+ public:
+  C2PWorklist() : flag("c2p_flag",1), list("c2p_list",1) {}
+
+  int fast_iter = 0;        // iteration budget of fast pass (0 disables two-pass C2P)
+  DvceArray1D<int> flag;    // set in fast pass for cells that did not converge
+  DvceArray1D<int> list;    // indices of flagged cells, compacted for second pass
+
+  // ensures arrays can hold n cells
+  void Resize(const int n);
+  // compacts indices of flagged cells in [0,n) into list, returns number of such cells
+  int Compact(const int n);
+};
+
+#endif // EOS_C2P_WORKLIST_HPP_
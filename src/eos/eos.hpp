@@ -17,6 +17,7 @@
 #include "athena.hpp"
 #include "mesh/meshblock.hpp"
 #include "parameter_input.hpp"
+#include "c2p_worklist.hpp"
 
 //----------------------------------------------------------------------------------------
 //! \struct EOSData
@@ -387,6 +388,8 @@ class IdealGRMHD : public EquationOfState {
   void PrimToCons(const DvceArray5D<Real> &prim, const DvceArray5D<Real> &bcc,
                   DvceArray5D<Real> &cons, const int il, const int iu,
                   const int jl, const int ju, const int kl, const int ku) override;
+
+  C2PWorklist c2p_work;  // cells left unconverged by fast pass of two-pass C2P
 };
 
 //----------------------------------------------------------------------------------------
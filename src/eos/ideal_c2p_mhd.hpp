@@ -118,19 +118,23 @@ Real Equation44(const Real mu, const Real b2, const Real rpar, const Real r, con
   return mu - 1./(h/w + rbar*mu);                  // (45)
 }
 
+// default maximum number of iterations of each root-finding loop in SingleC2P_IdealSRMHD
+constexpr int C2P_MAX_ITER_MHD = 25;
+
 //----------------------------------------------------------------------------------------
 //! \fn void SingleC2P_IdealSRMHD()
 //! \brief Converts single state of conserved variables into primitive variables for
 //! special relativistic MHD with an ideal gas EOS. Note input CONSERVED state contains
 //! cell-centered magnetic fields, but PRIMITIVE state returned via arguments does not.
+//! If the root is not found within max_iterations, c2p_failure is set.
 
 KOKKOS_INLINE_FUNCTION
 void SingleC2P_IdealSRMHD(MHDCons1D &u, const EOS_Data &eos, Real s2, Real b2, Real rpar,
                           HydPrim1D &w, bool &dfloor_used, bool &efloor_used,
-                          bool &c2p_failure, int &max_iter) {
+                          bool &c2p_failure, int &max_iter,
+                          const int max_iterations=C2P_MAX_ITER_MHD) {
   // Parameters
   const Real dfloor_ = fmax(eos.dfloor, b2/eos.sigma_max);
-  const int max_iterations = 25;
   const Real tol = 1.0e-12;
   const Real gm1 = eos.gamma - 1.0;
 
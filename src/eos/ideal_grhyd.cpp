@@ -46,11 +46,15 @@ void IdealGRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
   int &nscal = pmy_pack->phydro->nscalars;
   int &nmb = pmy_pack->nmb_thispack;
   auto &fofc_ = pmy_pack->phydro->fofc;
+  auto &mbwork_ = pmy_pack->pmesh->mbcost.work;
+  const bool count_work = pmy_pack->pmesh->mbcost.measured;
   auto eos = eos_data;
   Real gm1 = eos_data.gamma - 1.0;
 
   auto &flat = pmy_pack->pcoord->coord_data.is_minkowski;
   auto &spin = pmy_pack->pcoord->coord_data.bh_spin;
+  auto &use_cache = pmy_pack->pcoord->coord_data.metric_cache;
+  auto &gcc = pmy_pack->pcoord->coord_data.gcc;
   auto &use_excise = pmy_pack->pcoord->coord_data.bh_excise;
   auto &excision_floor_ = pmy_pack->pcoord->excision_floor;
   auto &excision_flux_ = pmy_pack->pcoord->excision_flux;
@@ -94,7 +98,11 @@ void IdealGRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (use_cache) {
+      CachedMetricAndInverse(gcc, m, k, j, i, glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     HydPrim1D w;
     bool dfloor_used=false, efloor_used=false;
@@ -150,6 +158,7 @@ void IdealGRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
     if (only_testfloors) {
       if (dfloor_used || efloor_used || vceiling_used || c2p_failure) {
         fofc_(m,k,j,i) = true;
+        if (count_work) {Kokkos::atomic_add(&mbwork_(m,IWFOFC), std::int64_t{1});}
         sumd++;  // use dfloor as counter for when either is true
       }
     } else {
@@ -158,6 +167,7 @@ void IdealGRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
       if (vceiling_used) {sumv++;}
       if (c2p_failure) {sumf++;}
       max_it = (iter_used > max_it) ? iter_used : max_it;
+      if (count_work) {Kokkos::atomic_add(&mbwork_(m,IWC2P), std::int64_t{iter_used});}
 
       // store primitive state in 3D array
       prim(m,IDN,k,j,i) = w.d;
@@ -211,6 +221,8 @@ void IdealGRHydro::PrimToCons(const DvceArray5D<Real> &prim, DvceArray5D<Real> &
   auto &size = pmy_pack->pmb->mb_size;
   auto &flat = pmy_pack->pcoord->coord_data.is_minkowski;
   auto &spin = pmy_pack->pcoord->coord_data.bh_spin;
+  auto &use_cache = pmy_pack->pcoord->coord_data.metric_cache;
+  auto &gcc = pmy_pack->pcoord->coord_data.gcc;
   int &nhyd  = pmy_pack->phydro->nhydro;
   int &nscal = pmy_pack->phydro->nscalars;
   int &nmb = pmy_pack->nmb_thispack;
@@ -232,7 +244,11 @@ void IdealGRHydro::PrimToCons(const DvceArray5D<Real> &prim, DvceArray5D<Real> &
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (use_cache) {
+      CachedMetricAndInverse(gcc, m, k, j, i, glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Load single state of primitive variables
     HydPrim1D w;
@@ -8,6 +8,8 @@
 
 #include <float.h>
 
+#include <iostream>
+
 #include "athena.hpp"
 #include "mhd/mhd.hpp"
 #include "eos.hpp"
@@ -27,6 +29,14 @@ IdealGRMHD::IdealGRMHD(MeshBlockPack *pp, ParameterInput *pin) :
   eos_data.iso_cs = 0.0;
   eos_data.gamma_max = pin->GetOrAddReal("mhd","gamma_max",(FLT_MAX));  // gamma ceiling
   eos_data.sigma_max = pin->GetOrAddReal("mhd","sigma_max",(FLT_MAX));  // sigma ceiling
+  // iteration budget of fast pass in two-pass C2P (0 = single pass)
+  c2p_work.fast_iter = pin->GetOrAddInteger("mhd","c2p_fast_iter",0);
+  if (c2p_work.fast_iter < 0 || c2p_work.fast_iter >= C2P_MAX_ITER_MHD) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "<mhd>/c2p_fast_iter must be in [0," << C2P_MAX_ITER_MHD << ")"
+              << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
 }
 
 //----------------------------------------------------------------------------------------
@@ -46,11 +56,15 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
   int &nscal = pmy_pack->pmhd->nscalars;
   int &nmb = pmy_pack->nmb_thispack;
   auto &fofc_ = pmy_pack->pmhd->fofc;
+  auto &mbwork_ = pmy_pack->pmesh->mbcost.work;
+  const bool count_work = pmy_pack->pmesh->mbcost.measured;
   auto eos = eos_data;
   Real gm1 = eos_data.gamma - 1.0;
 
   auto &flat = pmy_pack->pcoord->coord_data.is_minkowski;
   auto &spin = pmy_pack->pcoord->coord_data.bh_spin;
+  auto &use_cache = pmy_pack->pcoord->coord_data.metric_cache;
+  auto &gcc = pmy_pack->pcoord->coord_data.gcc;
   auto &use_excise = pmy_pack->pcoord->coord_data.bh_excise;
   auto &excision_floor_ = pmy_pack->pcoord->excision_floor;
   auto &excision_flux_ = pmy_pack->pcoord->excision_flux;
@@ -62,157 +76,202 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
   const int nkji = (ku - kl + 1)*nji;
   const int nmkji = nmb*nkji;
 
+  // With two-pass C2P, the first (fast) pass inverts all cells with a small iteration
+  // budget and flags those that do not converge.  Flagged cells are compacted into a
+  // list, and inverted with the full iteration budget in a second pass.  Otherwise,
+  // all cells are inverted with the full budget in a single pass.
+  const bool two_pass = (c2p_work.fast_iter > 0);
+  if (two_pass) {c2p_work.Resize(nmkji);}
+  auto &flag_ = c2p_work.flag;
+  auto &list_ = c2p_work.list;
+
   int nfloord_=0, nfloore_=0, nceilv_=0, nfail_=0, maxit_=0;
-  Kokkos::parallel_reduce("grmhd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-  KOKKOS_LAMBDA(const int &idx, int &sumd, int &sume, int &sumv, int &sumf, int &max_it) {
-    int m = (idx)/nkji;
-    int k = (idx - m*nkji)/nji;
-    int j = (idx - m*nkji - k*nji)/ni;
-    int i = (idx - m*nkji - k*nji - j*ni) + il;
-    j += jl;
-    k += kl;
-
-    // load single state conserved variables
-    MHDCons1D u;
-    u.d  = cons(m,IDN,k,j,i);
-    u.mx = cons(m,IM1,k,j,i);
-    u.my = cons(m,IM2,k,j,i);
-    u.mz = cons(m,IM3,k,j,i);
-    u.e  = cons(m,IEN,k,j,i);
-
-    // load cell-centered fields into conserved state
-    // use input CC fields if only testing floors with FOFC
-    if (only_testfloors) {
-      u.bx = bcc(m,IBX,k,j,i);
-      u.by = bcc(m,IBY,k,j,i);
-      u.bz = bcc(m,IBZ,k,j,i);
-    // else use simple linear average of face-centered fields
-    } else {
-      u.bx = 0.5*(b.x1f(m,k,j,i) + b.x1f(m,k,j,i+1));
-      u.by = 0.5*(b.x2f(m,k,j,i) + b.x2f(m,k,j+1,i));
-      u.bz = 0.5*(b.x3f(m,k,j,i) + b.x3f(m,k+1,j,i));
-    }
+  int nwork = nmkji, nslow = 0;
+  for (int pass=0; pass<2; ++pass) {
+    const bool fast_pass = (two_pass && (pass == 0));
+    const int c2p_iter = (fast_pass)? c2p_work.fast_iter : C2P_MAX_ITER_MHD;
+    int nfloord=0, nfloore=0, nceilv=0, nfail=0, maxit=0;
+    Kokkos::parallel_reduce("grmhd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nwork),
+    KOKKOS_LAMBDA(const int &iw,
+                  int &sumd, int &sume, int &sumv, int &sumf, int &max_it) {
+      // in second pass, only cells flagged in fast pass are inverted
+      const int idx = (pass == 0)? iw : list_(iw);
+      if (fast_pass) {flag_(idx) = 0;}
+      int m = (idx)/nkji;
+      int k = (idx - m*nkji)/nji;
+      int j = (idx - m*nkji - k*nji)/ni;
+      int i = (idx - m*nkji - k*nji - j*ni) + il;
+      j += jl;
+      k += kl;
+
+      // load single state conserved variables
+      MHDCons1D u;
+      u.d  = cons(m,IDN,k,j,i);
+      u.mx = cons(m,IM1,k,j,i);
+      u.my = cons(m,IM2,k,j,i);
+      u.mz = cons(m,IM3,k,j,i);
+      u.e  = cons(m,IEN,k,j,i);
+
+      // load cell-centered fields into conserved state
+      // use input CC fields if only testing floors with FOFC
+      if (only_testfloors) {
+        u.bx = bcc(m,IBX,k,j,i);
+        u.by = bcc(m,IBY,k,j,i);
+        u.bz = bcc(m,IBZ,k,j,i);
+      // else use simple linear average of face-centered fields
+      } else {
+        u.bx = 0.5*(b.x1f(m,k,j,i) + b.x1f(m,k,j,i+1));
+        u.by = 0.5*(b.x2f(m,k,j,i) + b.x2f(m,k,j+1,i));
+        u.bz = 0.5*(b.x3f(m,k,j,i) + b.x3f(m,k+1,j,i));
+      }
 
-    // Extract components of metric
-    Real &x1min = size.d_view(m).x1min;
-    Real &x1max = size.d_view(m).x1max;
-    Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+      // Extract components of metric
+      Real &x1min = size.d_view(m).x1min;
+      Real &x1max = size.d_view(m).x1max;
+      Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
 
-    Real &x2min = size.d_view(m).x2min;
-    Real &x2max = size.d_view(m).x2max;
-    Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+      Real &x2min = size.d_view(m).x2min;
+      Real &x2max = size.d_view(m).x2max;
+      Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
 
-    Real &x3min = size.d_view(m).x3min;
-    Real &x3max = size.d_view(m).x3max;
-    Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+      Real &x3min = size.d_view(m).x3min;
+      Real &x3max = size.d_view(m).x3max;
+      Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
-    Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
-
-    HydPrim1D w;
-    bool dfloor_used=false, efloor_used=false;
-    bool vceiling_used=false, c2p_failure=false;
-    int iter_used=0;
-
-    // Only execute cons2prim if outside excised region
-    bool excised = false;
-    if (use_excise) {
-      if (excision_floor_(m,k,j,i)) {
-        w.d = dexcise_;
-        w.vx = 0.0;
-        w.vy = 0.0;
-        w.vz = 0.0;
-        w.e = pexcise_/gm1;
-        excised = true;
+      Real glower[4][4], gupper[4][4];
+      if (use_cache) {
+        CachedMetricAndInverse(gcc, m, k, j, i, glower, gupper);
+      } else {
+        ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
       }
-      if (only_testfloors) {
-        if (excision_flux_(m,k,j,i)) {
+
+      HydPrim1D w;
+      bool dfloor_used=false, efloor_used=false;
+      bool vceiling_used=false, c2p_failure=false;
+      int iter_used=0;
+
+      // Only execute cons2prim if outside excised region
+      bool excised = false;
+      if (use_excise) {
+        if (excision_floor_(m,k,j,i)) {
+          w.d = dexcise_;
+          w.vx = 0.0;
+          w.vy = 0.0;
+          w.vz = 0.0;
+          w.e = pexcise_/gm1;
           excised = true;
         }
+        if (only_testfloors) {
+          if (excision_flux_(m,k,j,i)) {
+            excised = true;
+          }
+        }
       }
-    }
 
-    if (!(excised)) {
-      // calculate SR conserved quantities
-      MHDCons1D u_sr;
-      Real s2, b2, rpar;
-      TransformToSRMHD(u,glower,gupper,s2,b2,rpar,u_sr);
-
-      // call c2p function
-      // (inline function in ideal_c2p_mhd.hpp file)
-      SingleC2P_IdealSRMHD(u_sr, eos, s2, b2, rpar, w,
-                           dfloor_used, efloor_used, c2p_failure, iter_used);
-
-      // apply velocity ceiling if necessary
-      Real tmp = glower[1][1]*SQR(w.vx)
-               + glower[2][2]*SQR(w.vy)
-               + glower[3][3]*SQR(w.vz)
-               + 2.0*glower[1][2]*w.vx*w.vy + 2.0*glower[1][3]*w.vx*w.vz
-               + 2.0*glower[2][3]*w.vy*w.vz;
-      Real lor = sqrt(1.0+tmp);
-      if (lor > eos.gamma_max) {
-        vceiling_used = true;
-        Real factor = sqrt((SQR(eos.gamma_max)-1.0)/(SQR(lor)-1.0));
-        w.vx *= factor;
-        w.vy *= factor;
-        w.vz *= factor;
-      }
-    }
+      if (!(excised)) {
+        // calculate SR conserved quantities
+        MHDCons1D u_sr;
+        Real s2, b2, rpar;
+        TransformToSRMHD(u,glower,gupper,s2,b2,rpar,u_sr);
+
+        // call c2p function
+        // (inline function in ideal_c2p_mhd.hpp file)
+        SingleC2P_IdealSRMHD(u_sr, eos, s2, b2, rpar, w,
+                             dfloor_used, efloor_used, c2p_failure, iter_used, c2p_iter);
+
+        // in fast pass, flag unconverged cell for second pass rather than failing
+        if (fast_pass && c2p_failure) {
+          flag_(idx) = 1;
+          if (count_work) {
+            Kokkos::atomic_add(&mbwork_(m,IWC2P), std::int64_t{iter_used});
+          }
+          return;
+        }
 
-    // set FOFC flag and quit loop if this function called only to check floors
-    if (only_testfloors) {
-      if (dfloor_used || efloor_used || vceiling_used || c2p_failure) {
-        fofc_(m,k,j,i) = true;
-        sumd++;  // use dfloor as counter for when either is true
-      }
-    } else {
-      if (dfloor_used) {sumd++;}
-      if (efloor_used) {sume++;}
-      if (vceiling_used) {sumv++;}
-      if (c2p_failure) {sumf++;}
-      max_it = (iter_used > max_it) ? iter_used : max_it;
-
-      // store primitive state in 3D array
-      prim(m,IDN,k,j,i) = w.d;
-      prim(m,IVX,k,j,i) = w.vx;
-      prim(m,IVY,k,j,i) = w.vy;
-      prim(m,IVZ,k,j,i) = w.vz;
-      prim(m,IEN,k,j,i) = w.e;
-
-      // store cell-centered fields in 3D array
-      bcc(m,IBX,k,j,i) = u.bx;
-      bcc(m,IBY,k,j,i) = u.by;
-      bcc(m,IBZ,k,j,i) = u.bz;
-
-      // reset conserved variables if floor, ceiling, failure, or excision encountered
-      if (dfloor_used || efloor_used || vceiling_used || c2p_failure || excised) {
-        MHDPrim1D w_in;
-        w_in.d  = w.d;
-        w_in.vx = w.vx;
-        w_in.vy = w.vy;
-        w_in.vz = w.vz;
-        w_in.e  = w.e;
-        w_in.bx = u.bx;
-        w_in.by = u.by;
-        w_in.bz = u.bz;
-
-        HydCons1D u_out;
-        SingleP2C_IdealGRMHD(glower, gupper, w_in, eos.gamma, u_out);
-        cons(m,IDN,k,j,i) = u_out.d;
-        cons(m,IM1,k,j,i) = u_out.mx;
-        cons(m,IM2,k,j,i) = u_out.my;
-        cons(m,IM3,k,j,i) = u_out.mz;
-        cons(m,IEN,k,j,i) = u_out.e;
-        u.d = u_out.d;  // (needed if there are scalars below)
+        // apply velocity ceiling if necessary
+        Real tmp = glower[1][1]*SQR(w.vx)
+                 + glower[2][2]*SQR(w.vy)
+                 + glower[3][3]*SQR(w.vz)
+                 + 2.0*glower[1][2]*w.vx*w.vy + 2.0*glower[1][3]*w.vx*w.vz
+                 + 2.0*glower[2][3]*w.vy*w.vz;
+        Real lor = sqrt(1.0+tmp);
+        if (lor > eos.gamma_max) {
+          vceiling_used = true;
+          Real factor = sqrt((SQR(eos.gamma_max)-1.0)/(SQR(lor)-1.0));
+          w.vx *= factor;
+          w.vy *= factor;
+          w.vz *= factor;
+        }
       }
 
-      // convert scalars (if any)
-      for (int n=nmhd; n<(nmhd+nscal); ++n) {
-        prim(m,n,k,j,i) = cons(m,n,k,j,i)/u.d;
+      // set FOFC flag and quit loop if this function called only to check floors
+      if (only_testfloors) {
+        if (dfloor_used || efloor_used || vceiling_used || c2p_failure) {
+          fofc_(m,k,j,i) = true;
+          if (count_work) {Kokkos::atomic_add(&mbwork_(m,IWFOFC), std::int64_t{1});}
+          sumd++;  // use dfloor as counter for when either is true
+        }
+      } else {
+        if (dfloor_used) {sumd++;}
+        if (efloor_used) {sume++;}
+        if (vceiling_used) {sumv++;}
+        if (c2p_failure) {sumf++;}
+        max_it = (iter_used > max_it) ? iter_used : max_it;
+        if (count_work) {Kokkos::atomic_add(&mbwork_(m,IWC2P), std::int64_t{iter_used});}
+
+        // store primitive state in 3D array
+        prim(m,IDN,k,j,i) = w.d;
+        prim(m,IVX,k,j,i) = w.vx;
+        prim(m,IVY,k,j,i) = w.vy;
+        prim(m,IVZ,k,j,i) = w.vz;
+        prim(m,IEN,k,j,i) = w.e;
+
+        // store cell-centered fields in 3D array
+        bcc(m,IBX,k,j,i) = u.bx;
+        bcc(m,IBY,k,j,i) = u.by;
+        bcc(m,IBZ,k,j,i) = u.bz;
+
+        // reset conserved variables if floor, ceiling, failure, or excision encountered
+        if (dfloor_used || efloor_used || vceiling_used || c2p_failure || excised) {
+          MHDPrim1D w_in;
+          w_in.d  = w.d;
+          w_in.vx = w.vx;
+          w_in.vy = w.vy;
+          w_in.vz = w.vz;
+          w_in.e  = w.e;
+          w_in.bx = u.bx;
+          w_in.by = u.by;
+          w_in.bz = u.bz;
+
+          HydCons1D u_out;
+          SingleP2C_IdealGRMHD(glower, gupper, w_in, eos.gamma, u_out);
+          cons(m,IDN,k,j,i) = u_out.d;
+          cons(m,IM1,k,j,i) = u_out.mx;
+          cons(m,IM2,k,j,i) = u_out.my;
+          cons(m,IM3,k,j,i) = u_out.mz;
+          cons(m,IEN,k,j,i) = u_out.e;
+          u.d = u_out.d;  // (needed if there are scalars below)
+        }
+
+        // convert scalars (if any)
+        for (int n=nmhd; n<(nmhd+nscal); ++n) {
+          prim(m,n,k,j,i) = cons(m,n,k,j,i)/u.d;
+        }
       }
-    }
-  }, Kokkos::Sum<int>(nfloord_), Kokkos::Sum<int>(nfloore_), Kokkos::Sum<int>(nceilv_),
-     Kokkos::Sum<int>(nfail_), Kokkos::Max<int>(maxit_));
+    }, Kokkos::Sum<int>(nfloord), Kokkos::Sum<int>(nfloore), Kokkos::Sum<int>(nceilv),
+       Kokkos::Sum<int>(nfail), Kokkos::Max<int>(maxit));
+    nfloord_ += nfloord;
+    nfloore_ += nfloore;
+    nceilv_  += nceilv;
+    nfail_   += nfail;
+    maxit_ = (maxit > maxit_) ? maxit : maxit_;
+
+    // compact cells flagged in fast pass into list for second pass
+    if (!(fast_pass)) break;
+    nwork = c2p_work.Compact(nmkji);
+    nslow = nwork;
+    if (nwork == 0) break;
+  }
 
   // store appropriate counters
   if (only_testfloors) {
@@ -224,6 +283,10 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
     pmy_pack->pmesh->ecounter.neos_fail   += nfail_;
     pmy_pack->pmesh->ecounter.maxit_c2p = maxit_;
   }
+  if (two_pass) {
+    pmy_pack->pmesh->ecounter.nc2p_fast += nmkji - nslow;
+    pmy_pack->pmesh->ecounter.nc2p_slow += nslow;
+  }
 
   return;
 }
@@ -241,6 +304,8 @@ void IdealGRMHD::PrimToCons(const DvceArray5D<Real> &prim, const DvceArray5D<Rea
   auto &size = pmy_pack->pmb->mb_size;
   auto &flat = pmy_pack->pcoord->coord_data.is_minkowski;
   auto &spin = pmy_pack->pcoord->coord_data.bh_spin;
+  auto &use_cache = pmy_pack->pcoord->coord_data.metric_cache;
+  auto &gcc = pmy_pack->pcoord->coord_data.gcc;
   int &nmhd  = pmy_pack->pmhd->nmhd;
   int &nscal = pmy_pack->pmhd->nscalars;
   int &nmb = pmy_pack->nmb_thispack;
@@ -262,7 +327,11 @@ void IdealGRMHD::PrimToCons(const DvceArray5D<Real> &prim, const DvceArray5D<Rea
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (use_cache) {
+      CachedMetricAndInverse(gcc, m, k, j, i, glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Load single state of primitive variables
     MHDPrim1D w;
@@ -35,6 +35,8 @@ void IdealHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
   int &nmb = pmy_pack->nmb_thispack;
   auto &eos = eos_data;
   auto &fofc_ = pmy_pack->phydro->fofc;
+  auto &mbwork_ = pmy_pack->pmesh->mbcost.work;
+  const bool count_work = pmy_pack->pmesh->mbcost.measured;
 
   const int ni   = (iu - il + 1);
   const int nji  = (ju - jl + 1)*ni;
@@ -69,6 +71,7 @@ void IdealHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
     if (only_testfloors) {
       if (dfloor_used || efloor_used || tfloor_used) {
         fofc_(m,k,j,i) = true;
+        if (count_work) {Kokkos::atomic_add(&mbwork_(m,IWFOFC), std::int64_t{1});}
         sumd++;  // use dfloor as counter for when either is true
       }
     } else {
@@ -37,6 +37,8 @@ void IdealMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &b,
   int &nmb = pmy_pack->nmb_thispack;
   auto &eos = eos_data;
   auto &fofc_ = pmy_pack->pmhd->fofc;
+  auto &mbwork_ = pmy_pack->pmesh->mbcost.work;
+  const bool count_work = pmy_pack->pmesh->mbcost.measured;
 
   const int ni   = (iu - il + 1);
   const int nji  = (ju - jl + 1)*ni;
@@ -84,6 +86,7 @@ void IdealMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &b,
     if (only_testfloors) {
       if (dfloor_used || efloor_used || tfloor_used) {
         fofc_(m,k,j,i) = true;
+        if (count_work) {Kokkos::atomic_add(&mbwork_(m,IWFOFC), std::int64_t{1});}
         sumd++;  // use dfloor as counter for when either is true
       }
     } else {
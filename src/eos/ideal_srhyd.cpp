@@ -58,6 +58,8 @@ void IdealSRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
   int &nscal = pmy_pack->phydro->nscalars;
   int &nmb = pmy_pack->nmb_thispack;
   auto &fofc_ = pmy_pack->phydro->fofc;
+  auto &mbwork_ = pmy_pack->pmesh->mbcost.work;
+  const bool count_work = pmy_pack->pmesh->mbcost.measured;
   auto eos = eos_data;
 
   const int ni   = (iu - il + 1);
@@ -108,6 +110,7 @@ void IdealSRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
     if (only_testfloors) {
       if (dfloor_used || efloor_used || vceiling_used || c2p_failure) {
         fofc_(m,k,j,i) = true;
+        if (count_work) {Kokkos::atomic_add(&mbwork_(m,IWFOFC), std::int64_t{1});}
         sumd++;  // use dfloor as counter for when either is true
       }
     } else {
@@ -116,6 +119,7 @@ void IdealSRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
       if (vceiling_used) {sumv++;}
       if (c2p_failure) {sumf++;}
       max_it = (iter_used > max_it) ? iter_used : max_it;
+      if (count_work) {Kokkos::atomic_add(&mbwork_(m,IWC2P), std::int64_t{iter_used});}
 
       // store primitive state in 3D array
       prim(m,IDN,k,j,i) = w.d;
@@ -59,6 +59,8 @@ void IdealSRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
   int &nmb = pmy_pack->nmb_thispack;
   auto eos = eos_data;
   auto &fofc_ = pmy_pack->pmhd->fofc;
+  auto &mbwork_ = pmy_pack->pmesh->mbcost.work;
+  const bool count_work = pmy_pack->pmesh->mbcost.measured;
 
   const int ni   = (iu - il + 1);
   const int nji  = (ju - jl + 1)*ni;
@@ -123,6 +125,7 @@ void IdealSRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
     if (only_testfloors) {
       if (dfloor_used || efloor_used || vceiling_used || c2p_failure) {
         fofc_(m,k,j,i) = true;
+        if (count_work) {Kokkos::atomic_add(&mbwork_(m,IWFOFC), std::int64_t{1});}
         sumd++;  // use dfloor as counter for when either is true
       }
     } else {
@@ -131,6 +134,7 @@ void IdealSRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
       if (vceiling_used) {sumv++;}
       if (c2p_failure) {sumf++;}
       max_it = (iter_used > max_it) ? iter_used : max_it;
+      if (count_work) {Kokkos::atomic_add(&mbwork_(m,IWC2P), std::int64_t{iter_used});}
 
       // store primitive state in 3D array
       prim(m,IDN,k,j,i) = w.d;
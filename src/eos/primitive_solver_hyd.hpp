@@ -40,6 +40,7 @@
 #include "mhd/mhd.hpp"
 #include "coordinates/coordinates.hpp"
 #include "coordinates/cell_locations.hpp"
+#include "eos/c2p_worklist.hpp"
 
 template<class EOSPolicy, class ErrorPolicy>
 class PrimitiveSolverHydro {
@@ -127,6 +128,7 @@ class PrimitiveSolverHydro {
   MeshBlockPack* pmy_pack;
   unsigned int nerrs;
   unsigned int errcap;
+  C2PWorklist c2p_work;  // cells left unconverged by fast pass of two-pass C2P
 
   PrimitiveSolverHydro(std::string block, MeshBlockPack *pp, ParameterInput *pin) :
 //        pmy_pack(pp), ps{&eos} {
@@ -138,6 +140,15 @@ class PrimitiveSolverHydro {
     ps.GetEOSMutable().SetThreshold(pin->GetOrAddReal(block, "dthreshold", 1.0));
     ps.tol = pin->GetOrAddReal(block, "c2p_tol", 1e-15);
     ps.GetRootSolverMutable().iterations = pin->GetOrAddInteger(block, "c2p_iter", 50);
+    // iteration budget of fast pass in two-pass C2P (0 = single pass)
+    c2p_work.fast_iter = pin->GetOrAddInteger(block, "c2p_fast_iter", 0);
+    if (c2p_work.fast_iter < 0 ||
+        c2p_work.fast_iter >= static_cast<int>(ps.GetRootSolver().iterations)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<" << block << ">/c2p_fast_iter must be >= 0 and "
+                << "less than <" << block << ">/c2p_iter" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
     errcap = pin->GetOrAddInteger(block, "c2perrs", 1000);
 
     // Calculate maximum allowed velocity
@@ -339,7 +350,6 @@ class PrimitiveSolverHydro {
     const int nmkji = nmb*nkji;
 
     const int rank = global_variable::my_rank;
-    const int nerrs_ = nerrs;
     const int errcap_ = errcap;
 
     Real mb = eos_.GetBaryonMass();
@@ -353,178 +363,137 @@ class PrimitiveSolverHydro {
       ps.GetEOSMutable().SetConservedFloorFailure(true);
     }
 
-    // FIXME(JMF): We can short-circuit the primitive solve if FOFC is already enabled
-    // due to a maximum principle violation.
+    // With two-pass C2P, the first (fast) pass inverts all cells with the root finder
+    // limited to a small number of iterations, and flags cells where it fails to
+    // converge.  Flagged cells are compacted into a list, and inverted with the full
+    // number of iterations in a second pass.  Otherwise, a single pass is used.
+    const bool two_pass = (c2p_work.fast_iter > 0);
+    if (two_pass) {c2p_work.Resize(nmkji);}
+    auto &flag_ = c2p_work.flag;
+    auto &list_ = c2p_work.list;
+    auto ps_fast_ = ps;
+    ps_fast_.GetRootSolverMutable().iterations = c2p_work.fast_iter;
+
     int count_errs=0;
-    Kokkos::parallel_reduce("pshyd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-    KOKKOS_LAMBDA(const int &idx, int &sumerrs) {
-      int m = (idx)/nkji;
-      int k = (idx - m*nkji)/nji;
-      int j = (idx - m*nkji - k*nji)/ni;
-      int i = (idx - m*nkji - k*nji - j*ni) + il;
-      j += jl;
-      k += kl;
-
-      // Add in a short circuit where FOFC is guaranteed.
-      if (floors_only && fofc_(m, k, j, i)) {
-        return;
-      }
-      if (floors_only && excise) {
-        if (excision_flux_(m,k,j,i)) {
+    int nwork = nmkji, nslow = 0;
+    for (int pass=0; pass<2; ++pass) {
+      const bool fast_pass = (two_pass && (pass == 0));
+      const auto &solver_ = (fast_pass)? ps_fast_ : ps_;
+      const int nerrs_ = nerrs + count_errs;
+      int nerrs_pass=0;
+      // FIXME(JMF): We can short-circuit the primitive solve if FOFC is already enabled
+      // due to a maximum principle violation.
+      Kokkos::parallel_reduce("pshyd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nwork),
+      KOKKOS_LAMBDA(const int &iw, int &sumerrs) {
+        // in second pass, only cells flagged in fast pass are inverted
+        const int idx = (pass == 0)? iw : list_(iw);
+        if (fast_pass) {flag_(idx) = 0;}
+        int m = (idx)/nkji;
+        int k = (idx - m*nkji)/nji;
+        int j = (idx - m*nkji - k*nji)/ni;
+        int i = (idx - m*nkji - k*nji - j*ni) + il;
+        j += jl;
+        k += kl;
+
+        // Add in a short circuit where FOFC is guaranteed.
+        if (floors_only && fofc_(m, k, j, i)) {
           return;
         }
-      }
-
-      // Extract the metric
-      Real g3d[NSPMETRIC], g3u[NSPMETRIC], detg, sdetg;
-      g3d[S11] = adm.g_dd(m, 0, 0, k, j, i);
-      g3d[S12] = adm.g_dd(m, 0, 1, k, j, i);
-      g3d[S13] = adm.g_dd(m, 0, 2, k, j, i);
-      g3d[S22] = adm.g_dd(m, 1, 1, k, j, i);
-      g3d[S23] = adm.g_dd(m, 1, 2, k, j, i);
-      g3d[S33] = adm.g_dd(m, 2, 2, k, j, i);
-      detg = Primitive::GetDeterminant(g3d);
-      sdetg = sqrt(detg);
-      Real isdetg = 1.0/sdetg;
-      adm::SpatialInv(1.0/detg,
-                  g3d[S11], g3d[S12], g3d[S13], g3d[S22], g3d[S23], g3d[S33],
-                 &g3u[S11], &g3u[S12], &g3u[S13], &g3u[S22], &g3u[S23], &g3u[S33]);
-
-      // Extract the conserved variables
-      Real cons_pt[NCONS], cons_pt_old[NCONS], prim_pt[NPRIM];
-      cons_pt[CDN] = cons_pt_old[CDN] = cons(m, IDN, k, j, i)*isdetg;
-      cons_pt[CSX] = cons_pt_old[CSX] = cons(m, IM1, k, j, i)*isdetg;
-      cons_pt[CSY] = cons_pt_old[CSY] = cons(m, IM2, k, j, i)*isdetg;
-      cons_pt[CSZ] = cons_pt_old[CSZ] = cons(m, IM3, k, j, i)*isdetg;
-      cons_pt[CTA] = cons_pt_old[CTA] = cons(m, IEN, k, j, i)*isdetg;
-      for (int n = 0; n < nscal; n++) {
-        cons_pt[CYD + n] = cons_pt_old[CYD + n] = cons(m, nhyd + n, k, j, i)*isdetg;
-      }
-      // If we're only testing the floors, we can use the CC fields.
-      Real b3u[NMAG];
-      if (floors_only) {
-        b3u[IBX] = bcc0(m, IBX, k, j, i)*isdetg;
-        b3u[IBY] = bcc0(m, IBY, k, j, i)*isdetg;
-        b3u[IBZ] = bcc0(m, IBZ, k, j, i)*isdetg;
-      } else {
-        // Otherwise we don't have the correct CC fields yet, so use
-        // the FC fields.
-        bcc0(m, IBX, k, j, i) = 0.5*(bfc.x1f(m,k,j,i) + bfc.x1f(m,k,j,i+1));
-        bcc0(m, IBY, k, j, i) = 0.5*(bfc.x2f(m,k,j,i) + bfc.x2f(m,k,j+1,i));
-        bcc0(m, IBZ, k, j, i) = 0.5*(bfc.x3f(m,k,j,i) + bfc.x3f(m,k+1,j,i));
-        b3u[IBX] = bcc0(m, IBX, k, j, i)*isdetg;
-        b3u[IBY] = bcc0(m, IBY, k, j, i)*isdetg;
-        b3u[IBZ] = bcc0(m, IBZ, k, j, i)*isdetg;
-      }
+        if (floors_only && excise) {
+          if (excision_flux_(m,k,j,i)) {
+            return;
+          }
+        }
 
-      // If we're in an excised region, set the primitives to some default value.
-      Primitive::SolverResult result;
-      if (excise) {
-        // If smooth excision is enabled, do C2P everywhere.
-        if (smoothing) {
-          result = ps_.ConToPrim(prim_pt, cons_pt, b3u, g3d, g3u);
+        // Extract the metric
+        Real g3d[NSPMETRIC], g3u[NSPMETRIC], detg, sdetg;
+        g3d[S11] = adm.g_dd(m, 0, 0, k, j, i);
+        g3d[S12] = adm.g_dd(m, 0, 1, k, j, i);
+        g3d[S13] = adm.g_dd(m, 0, 2, k, j, i);
+        g3d[S22] = adm.g_dd(m, 1, 1, k, j, i);
+        g3d[S23] = adm.g_dd(m, 1, 2, k, j, i);
+        g3d[S33] = adm.g_dd(m, 2, 2, k, j, i);
+        detg = Primitive::GetDeterminant(g3d);
+        sdetg = sqrt(detg);
+        Real isdetg = 1.0/sdetg;
+        adm::SpatialInv(1.0/detg,
+                    g3d[S11], g3d[S12], g3d[S13], g3d[S22], g3d[S23], g3d[S33],
+                   &g3u[S11], &g3u[S12], &g3u[S13], &g3u[S22], &g3u[S23], &g3u[S33]);
+
+        // Extract the conserved variables
+        Real cons_pt[NCONS], cons_pt_old[NCONS], prim_pt[NPRIM];
+        cons_pt[CDN] = cons_pt_old[CDN] = cons(m, IDN, k, j, i)*isdetg;
+        cons_pt[CSX] = cons_pt_old[CSX] = cons(m, IM1, k, j, i)*isdetg;
+        cons_pt[CSY] = cons_pt_old[CSY] = cons(m, IM2, k, j, i)*isdetg;
+        cons_pt[CSZ] = cons_pt_old[CSZ] = cons(m, IM3, k, j, i)*isdetg;
+        cons_pt[CTA] = cons_pt_old[CTA] = cons(m, IEN, k, j, i)*isdetg;
+        for (int n = 0; n < nscal; n++) {
+          cons_pt[CYD + n] = cons_pt_old[CYD + n] = cons(m, nhyd + n, k, j, i)*isdetg;
+        }
+        // If we're only testing the floors, we can use the CC fields.
+        Real b3u[NMAG];
+        if (floors_only) {
+          b3u[IBX] = bcc0(m, IBX, k, j, i)*isdetg;
+          b3u[IBY] = bcc0(m, IBY, k, j, i)*isdetg;
+          b3u[IBZ] = bcc0(m, IBZ, k, j, i)*isdetg;
         } else {
-          if (excision_floor_(m,k,j,i)) {
-            prim_pt[PRH] = dexcise_/mb;
-            prim_pt[PVX] = 0.0;
-            prim_pt[PVY] = 0.0;
-            prim_pt[PVZ] = 0.0;
-            for (int n = 0; n < nscal; n++) {
-              // FIXME: Particle abundances should probably be set to a
-              // default inside an excised region.
-              prim_pt[PYF + n] = cons_pt[CYD]/cons_pt[CDN];
-            }
-            prim_pt[PPR] = eos_.GetPressure(prim_pt[PRH], texcise_, &prim_pt[PYF]);
-            prim_pt[PTM] = texcise_;
-            result.error = Primitive::Error::SUCCESS;
-            result.iterations = 0;
-            result.cons_floor = false;
-            result.prim_floor = false;
-            result.cons_adjusted = true;
-            ps_.PrimToCon(prim_pt, cons_pt, b3u, g3d);
-          } else {
-            result = ps_.ConToPrim(prim_pt, cons_pt, b3u, g3d, g3u);
-          }
+          // Otherwise we don't have the correct CC fields yet, so use
+          // the FC fields.
+          bcc0(m, IBX, k, j, i) = 0.5*(bfc.x1f(m,k,j,i) + bfc.x1f(m,k,j,i+1));
+          bcc0(m, IBY, k, j, i) = 0.5*(bfc.x2f(m,k,j,i) + bfc.x2f(m,k,j+1,i));
+          bcc0(m, IBZ, k, j, i) = 0.5*(bfc.x3f(m,k,j,i) + bfc.x3f(m,k+1,j,i));
+          b3u[IBX] = bcc0(m, IBX, k, j, i)*isdetg;
+          b3u[IBY] = bcc0(m, IBY, k, j, i)*isdetg;
+          b3u[IBZ] = bcc0(m, IBZ, k, j, i)*isdetg;
         }
-      } else {
-        result = ps_.ConToPrim(prim_pt, cons_pt, b3u, g3d, g3u);
-      }
 
-      if (result.error != Primitive::Error::SUCCESS && floors_only) {
-        fofc_(m,k,j,i) = true;
-      } else if (!floors_only) {
-        if (result.error != Primitive::Error::SUCCESS && (nerrs_ + sumerrs < errcap_)) {
-          sumerrs++;
-          // Find out where the point went bad and report a bunch of information about it.
-          Real &x1min = size.d_view(m).x1min;
-          Real &x1max = size.d_view(m).x1max;
-          Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
-
-          Real &x2min = size.d_view(m).x2min;
-          Real &x2max = size.d_view(m).x2max;
-          Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
-
-          Real &x3min = size.d_view(m).x3min;
-          Real &x3max = size.d_view(m).x3max;
-          Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
-
-          Kokkos::printf("An error occurred during the primitive solve: %s\n"
-                 "  Location: (%d, %d, %d, %d)\n"
-                 "            (%.17g, %.17g, %.17g)\n"
-                 "  Conserved vars: \n"
-                 "    D   = %.17g\n"
-                 "    Sx  = %.17g\n"
-                 "    Sy  = %.17g\n"
-                 "    Sz  = %.17g\n"
-                 "    tau = %.17g\n"
-                 "    Dye = %.17g\n"
-                 "    Bx  = %.17g\n"
-                 "    By  = %.17g\n"
-                 "    Bz  = %.17g\n"
-                 "  Metric vars: \n"
-                 "    detg = %.17g\n"
-                 "    g_dd = {%.17g, %.17g, %.17g, %.17g, %.17g, %.17g}\n"
-                 "    alp  = %.17g\n"
-                 "    beta = {%.17g, %.17g, %.17g}\n"
-                 "    psi4 = %.17g\n"
-                 "    K_dd = {%.17g, %.17g, %.17g, %.17g, %.17g, %.17g}\n",
-                 ErrorToString(result.error),
-                 m, k, j, i,
-                 x1v, x2v, x3v,
-                 cons_pt_old[CDN], cons_pt_old[CSX], cons_pt_old[CSY], cons_pt_old[CSZ],
-                 cons_pt_old[CTA], cons_pt_old[CYD], b3u[IBX], b3u[IBY], b3u[IBZ], detg,
-                 g3d[S11], g3d[S12], g3d[S13], g3d[S22], g3d[S23], g3d[S33],
-                 adm.alpha(m, k, j, i),
-                 adm.beta_u(m, 0, k, j, i),
-                 adm.beta_u(m, 1, k, j, i), adm.beta_u(m, 2, k, j, i),
-                 adm.psi4(m, k, j, i),
-                 adm.vK_dd(m, 0, 0, k, j, i), adm.vK_dd(m, 0, 1, k, j, i),
-                 adm.vK_dd(m, 0, 2, k, j, i),
-                 adm.vK_dd(m, 1, 1, k, j, i), adm.vK_dd(m, 1, 2, k, j, i),
-                 adm.vK_dd(m, 2, 2, k, j, i));
-          if (nerrs_ + sumerrs == errcap_) {
-            Kokkos::printf("%d C2P errors have been detected on rank %d."
-                   "All future C2P errors\n"
-                   "on this rank will be suppressed. Fix your code!\n",
-                   nerrs_ + sumerrs,rank);
+        // If we're in an excised region, set the primitives to some default value.
+        Primitive::SolverResult result;
+        if (excise) {
+          // If smooth excision is enabled, do C2P everywhere.
+          if (smoothing) {
+            result = solver_.ConToPrim(prim_pt, cons_pt, b3u, g3d, g3u);
+          } else {
+            if (excision_floor_(m,k,j,i)) {
+              prim_pt[PRH] = dexcise_/mb;
+              prim_pt[PVX] = 0.0;
+              prim_pt[PVY] = 0.0;
+              prim_pt[PVZ] = 0.0;
+              for (int n = 0; n < nscal; n++) {
+                // FIXME: Particle abundances should probably be set to a
+                // default inside an excised region.
+                prim_pt[PYF + n] = cons_pt[CYD]/cons_pt[CDN];
+              }
+              prim_pt[PPR] = eos_.GetPressure(prim_pt[PRH], texcise_, &prim_pt[PYF]);
+              prim_pt[PTM] = texcise_;
+              result.error = Primitive::Error::SUCCESS;
+              result.iterations = 0;
+              result.cons_floor = false;
+              result.prim_floor = false;
+              result.cons_adjusted = true;
+              ps_.PrimToCon(prim_pt, cons_pt, b3u, g3d);
+            } else {
+              result = solver_.ConToPrim(prim_pt, cons_pt, b3u, g3d, g3u);
+            }
           }
-        }
-        // Regardless of failure, we need to copy the primitives.
-        prim(m, IDN, k, j, i) = prim_pt[PRH]*mb;
-        prim(m, IVX, k, j, i) = prim_pt[PVX];
-        prim(m, IVY, k, j, i) = prim_pt[PVY];
-        prim(m, IVZ, k, j, i) = prim_pt[PVZ];
-        prim(m, IPR, k, j, i) = prim_pt[PPR];
-        for (int n = 0; n < nscal; n++) {
-          prim(m, nhyd + n, k, j, i) = prim_pt[PYF + n];
+        } else {
+          result = solver_.ConToPrim(prim_pt, cons_pt, b3u, g3d, g3u);
         }
 
-        temperature(m,0,k,j,i) = prim_pt[PTM];
+        // in fast pass, flag cell for second pass if root finder ran out of iterations
+        if (fast_pass && (result.error == Primitive::Error::NO_SOLUTION ||
+                          result.error == Primitive::Error::BRACKETING_FAILED)) {
+          flag_(idx) = 1;
+          return;
+        }
 
-        // If the conservative variables were floored or adjusted for consistency,
-        // we need to copy the conserved variables, too.
-        if (result.cons_floor || result.cons_adjusted) {
-          /*if (fabs((cons_pt[CDN] - cons_pt_old[CDN])/cons_pt_old[CDN]) > 1e-12) {
+        if (result.error != Primitive::Error::SUCCESS && floors_only) {
+          fofc_(m,k,j,i) = true;
+        } else if (!floors_only) {
+          if (result.error != Primitive::Error::SUCCESS && (nerrs_ + sumerrs < errcap_)) {
+            sumerrs++;
+            // Find out where the point went bad and report a bunch of information about
+            // it.
             Real &x1min = size.d_view(m).x1min;
             Real &x1max = size.d_view(m).x1max;
             Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
@@ -536,31 +505,112 @@ class PrimitiveSolverHydro {
             Real &x3min = size.d_view(m).x3min;
             Real &x3max = size.d_view(m).x3max;
             Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
-            bool is_ghost = (i < is) || (i > ie) ||
-                            (j < js) || (j > je) ||
-                            (k < ks) || (k > ke);
-
-            printf("Density was nontrivially adjusted on MeshBlock %d!\n"
-                   "  Grid index: (i=%d, j=%d, k=%d)\n"
-                   "  Physical position: (%g, %g, %g)\n"
-                   "  D (old): %.17g\n"
-                   "  D (new): %.17g\n"
-                   "  Ghost zone? %s\n",
-                   m, i, j, k,
-                   x1v, x2v, x3v, cons_pt_old[CDN], cons_pt[CDN],
-                   is_ghost ? "true" : "false");
-          }*/
-          cons(m, IDN, k, j, i) = cons_pt[CDN]*sdetg;
-          cons(m, IM1, k, j, i) = cons_pt[CSX]*sdetg;
-          cons(m, IM2, k, j, i) = cons_pt[CSY]*sdetg;
-          cons(m, IM3, k, j, i) = cons_pt[CSZ]*sdetg;
-          cons(m, IEN, k, j, i) = cons_pt[CTA]*sdetg;
+
+            Kokkos::printf("An error occurred during the primitive solve: %s\n"
+                   "  Location: (%d, %d, %d, %d)\n"
+                   "            (%.17g, %.17g, %.17g)\n"
+                   "  Conserved vars: \n"
+                   "    D   = %.17g\n"
+                   "    Sx  = %.17g\n"
+                   "    Sy  = %.17g\n"
+                   "    Sz  = %.17g\n"
+                   "    tau = %.17g\n"
+                   "    Dye = %.17g\n"
+                   "    Bx  = %.17g\n"
+                   "    By  = %.17g\n"
+                   "    Bz  = %.17g\n"
+                   "  Metric vars: \n"
+                   "    detg = %.17g\n"
+                   "    g_dd = {%.17g, %.17g, %.17g, %.17g, %.17g, %.17g}\n"
+                   "    alp  = %.17g\n"
+                   "    beta = {%.17g, %.17g, %.17g}\n"
+                   "    psi4 = %.17g\n"
+                   "    K_dd = {%.17g, %.17g, %.17g, %.17g, %.17g, %.17g}\n",
+                   ErrorToString(result.error),
+                   m, k, j, i,
+                   x1v, x2v, x3v,
+                   cons_pt_old[CDN], cons_pt_old[CSX], cons_pt_old[CSY], cons_pt_old[CSZ],
+                   cons_pt_old[CTA], cons_pt_old[CYD], b3u[IBX], b3u[IBY], b3u[IBZ], detg,
+                   g3d[S11], g3d[S12], g3d[S13], g3d[S22], g3d[S23], g3d[S33],
+                   adm.alpha(m, k, j, i),
+                   adm.beta_u(m, 0, k, j, i),
+                   adm.beta_u(m, 1, k, j, i), adm.beta_u(m, 2, k, j, i),
+                   adm.psi4(m, k, j, i),
+                   adm.vK_dd(m, 0, 0, k, j, i), adm.vK_dd(m, 0, 1, k, j, i),
+                   adm.vK_dd(m, 0, 2, k, j, i),
+                   adm.vK_dd(m, 1, 1, k, j, i), adm.vK_dd(m, 1, 2, k, j, i),
+                   adm.vK_dd(m, 2, 2, k, j, i));
+            if (nerrs_ + sumerrs == errcap_) {
+              Kokkos::printf("%d C2P errors have been detected on rank %d."
+                     "All future C2P errors\n"
+                     "on this rank will be suppressed. Fix your code!\n",
+                     nerrs_ + sumerrs,rank);
+            }
+          }
+          // Regardless of failure, we need to copy the primitives.
+          prim(m, IDN, k, j, i) = prim_pt[PRH]*mb;
+          prim(m, IVX, k, j, i) = prim_pt[PVX];
+          prim(m, IVY, k, j, i) = prim_pt[PVY];
+          prim(m, IVZ, k, j, i) = prim_pt[PVZ];
+          prim(m, IPR, k, j, i) = prim_pt[PPR];
           for (int n = 0; n < nscal; n++) {
-            cons(m, nhyd + n, k, j, i) = cons_pt[CYD + n]*sdetg;
+            prim(m, nhyd + n, k, j, i) = prim_pt[PYF + n];
+          }
+
+          temperature(m,0,k,j,i) = prim_pt[PTM];
+
+          // If the conservative variables were floored or adjusted for consistency,
+          // we need to copy the conserved variables, too.
+          if (result.cons_floor || result.cons_adjusted) {
+            /*if (fabs((cons_pt[CDN] - cons_pt_old[CDN])/cons_pt_old[CDN]) > 1e-12) {
+              Real &x1min = size.d_view(m).x1min;
+              Real &x1max = size.d_view(m).x1max;
+              Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+
+              Real &x2min = size.d_view(m).x2min;
+              Real &x2max = size.d_view(m).x2max;
+              Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+
+              Real &x3min = size.d_view(m).x3min;
+              Real &x3max = size.d_view(m).x3max;
+              Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+              bool is_ghost = (i < is) || (i > ie) ||
+                              (j < js) || (j > je) ||
+                              (k < ks) || (k > ke);
+
+              printf("Density was nontrivially adjusted on MeshBlock %d!\n"
+                     "  Grid index: (i=%d, j=%d, k=%d)\n"
+                     "  Physical position: (%g, %g, %g)\n"
+                     "  D (old): %.17g\n"
+                     "  D (new): %.17g\n"
+                     "  Ghost zone? %s\n",
+                     m, i, j, k,
+                     x1v, x2v, x3v, cons_pt_old[CDN], cons_pt[CDN],
+                     is_ghost ? "true" : "false");
+            }*/
+            cons(m, IDN, k, j, i) = cons_pt[CDN]*sdetg;
+            cons(m, IM1, k, j, i) = cons_pt[CSX]*sdetg;
+            cons(m, IM2, k, j, i) = cons_pt[CSY]*sdetg;
+            cons(m, IM3, k, j, i) = cons_pt[CSZ]*sdetg;
+            cons(m, IEN, k, j, i) = cons_pt[CTA]*sdetg;
+            for (int n = 0; n < nscal; n++) {
+              cons(m, nhyd + n, k, j, i) = cons_pt[CYD + n]*sdetg;
+            }
           }
         }
-      }
-    }, Kokkos::Sum<int>(count_errs));
+      }, Kokkos::Sum<int>(nerrs_pass));
+      count_errs += nerrs_pass;
+
+      // compact cells flagged in fast pass into list for second pass
+      if (!(fast_pass)) break;
+      nwork = c2p_work.Compact(nmkji);
+      nslow = nwork;
+      if (nwork == 0) break;
+    }
+    if (two_pass) {
+      pmy_pack->pmesh->ecounter.nc2p_fast += nmkji - nslow;
+      pmy_pack->pmesh->ecounter.nc2p_slow += nslow;
+    }
 
     if (floors_only) {
       ps.GetEOSMutable().SetPrimitiveFloorFailure(prim_failure);
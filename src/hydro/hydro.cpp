@@ -35,6 +35,7 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     uflx("uflx",1,1,1,1,1),
     fofc("fofc",1,1,1,1),
     utest("utest",1,1,1,1,1),
+    fofc_list("fofc_list",1),
     pmy_pack(ppack) {
   // Total number of MeshBlocks on this rank to be used in array dimensioning
   int nmb = std::max((ppack->nmb_thispack), (ppack->pmesh->nmb_maxperrank));
@@ -144,6 +145,49 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     // determine if FOFC is enabled
     use_fofc = pin->GetOrAddBoolean("hydro","fofc",false);
 
+    // determine if split-phase updates are enabled.  Only supported for the basic task
+    // list on a uniform mesh, since the shell/interior split is not applied to fluxes at
+    // fine/coarse boundaries, FOFC, diffusion, shearing box, or source terms.  Runs
+    // with other physics use the task lists of those modules, which are not split.
+    split_phase = pin->GetOrAddBoolean("hydro","split_phase",false);
+    if (split_phase) {
+      bool user_srcs = pin->DoesParameterExist("problem","user_srcs") &&
+                       pin->GetBoolean("problem","user_srcs");
+      bool other_physics = pin->DoesBlockExist("mhd") ||
+                           pin->DoesBlockExist("radiation") ||
+                           pin->DoesBlockExist("ion-neutral") ||
+                           pin->DoesBlockExist("z4c") || pin->DoesBlockExist("adm");
+      if (pmy_pack->pmesh->multilevel || use_fofc || (porb_u != nullptr) ||
+          (pvisc != nullptr) || (pcond != nullptr) || (psrc != nullptr) ||
+          user_srcs || pmy_pack->pcoord->is_general_relativistic || other_physics) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "<hydro>/split_phase=true cannot be used with SMR/AMR, FOFC, "
+          << "shearing box, diffusion, source terms, GR, or with MHD, radiation, "
+          << "ion-neutral, z4c, or adm physics" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+
+    // with fused update, flux divergence is added to u0 directly in the flux kernels,
+    // so fluxes are never stored on all faces.  Not possible when fluxes are needed
+    // after they are computed (SMR/AMR flux correction, FOFC, diffusion), or when tasks
+    // inserted between Fluxes and RKUpdate modify u0 (turbulence driving adds forcing
+    // there, which must be weighted by gam0 in the update).
+    fused_update = pin->GetOrAddBoolean("hydro","fused_update",false);
+    if (fused_update) {
+      if (pmy_pack->pmesh->multilevel || use_fofc || split_phase ||
+          (pvisc != nullptr) || (pcond != nullptr) ||
+          pin->DoesBlockExist("turb_driving") ||
+          (pmy_pack->pcoord->is_general_relativistic &&
+           pmy_pack->pcoord->coord_data.bh_excise)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "<hydro>/fused_update=true cannot be used with SMR/AMR, FOFC, "
+          << "split-phase updates, diffusion, turbulence driving, or excision"
+          << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+
     // select reconstruction method (default PLM)
     std::string xorder = pin->GetOrAddString("hydro","reconstruct","plm");
     if (xorder.compare("dc") == 0) {
@@ -284,15 +328,22 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
       int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
       int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
       Kokkos::realloc(u1,       nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
-      Kokkos::realloc(uflx.x1f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
-      Kokkos::realloc(uflx.x2f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
-      Kokkos::realloc(uflx.x3f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+      if (!fused_update) {
+        Kokkos::realloc(uflx.x1f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+        Kokkos::realloc(uflx.x2f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+        Kokkos::realloc(uflx.x3f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+      }
 
       // allocate array of flags used with FOFC
       if (use_fofc) {
         Kokkos::realloc(fofc,  nmb, ncells3, ncells2, ncells1);
         Kokkos::realloc(utest, nmb, nhydro, ncells3, ncells2, ncells1);
       }
+      // list of flagged cells, also used for cells about the excision in GR
+      if (use_fofc || (pmy_pack->pcoord->is_general_relativistic &&
+                       pmy_pack->pcoord->coord_data.bh_excise)) {
+        Kokkos::realloc(fofc_list, nmb*ncells3*ncells2*ncells1);
+      }
     }
   }
 }
@@ -11,6 +11,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "athena.hpp"
 #include "parameter_input.hpp"
@@ -57,6 +58,9 @@ struct HydroTaskIDs {
   TaskID newdt;
   TaskID csend;
   TaskID crecv;
+  TaskID flux_int;    // following only used with split-phase updates
+  TaskID rkupdt_int;
+  TaskID c2p_int;
 };
 
 namespace hydro {
@@ -97,12 +101,25 @@ class Hydro {
   // following only used for time-evolving flow
   DvceArray5D<Real> u1;       // conserved variables at intermediate step
   DvceFaceFld5D<Real> uflx;   // fluxes of conserved quantities on cell faces
+  // if true, flux divergence is added to u0 in flux kernels, and uflx is not allocated
+  bool fused_update = false;
   Real dtnew;
+  // if true, Hydro::NewTimeStep() also accumulates history sums in hist_sums
+  bool fuse_hist = false;
+  array_sum::GlobalSum hist_sums;
 
   // following used for FOFC
   DvceArray4D<bool> fofc;  // flag for each cell to indicate if FOFC is needed
   bool use_fofc = false;   // flag to enable FOFC
   DvceArray5D<Real> utest;  // scratch array for FOFC
+  DvceArray1D<int> fofc_list;  // compacted list of cells flagged for FOFC
+
+  // following used for split-phase updates, in which the interior of each MeshBlock is
+  // updated while boundary communications are in flight
+  bool split_phase = false;          // flag to enable split-phase updates
+  std::vector<CellRange> shell_rng;  // active cells within ng cells of MeshBlock faces
+  CellRange interior_rng;            // all other active cells (may be empty)
+  std::vector<CellRange> ghost_rng;  // ghost cells
 
   // container to hold names of TaskIDs
   HydroTaskIDs id;
@@ -129,13 +146,26 @@ class Hydro {
   TaskStatus Prolongate(Driver* pdrive, int stage);
   TaskStatus ConToPrim(Driver *d, int stage);
   TaskStatus NewTimeStep(Driver *d, int stage);
+  // ...in "stagen_tl" list with split-phase updates
+  TaskStatus FluxesShell(Driver *d, int stage);
+  TaskStatus FluxesInterior(Driver *d, int stage);
+  TaskStatus RKUpdateShell(Driver *d, int stage);
+  TaskStatus RKUpdateInterior(Driver *d, int stage);
+  TaskStatus ConToPrimActive(Driver *d, int stage);
+  TaskStatus ConToPrimGhost(Driver *d, int stage);
   // ...in "after_stagen_tl" list
   TaskStatus ClearSend(Driver *d, int stage);
   TaskStatus ClearRecv(Driver *d, int stage);  // also in Driver::Initialize
 
-  // CalculateFluxes function templated over Riemann Solvers
+  // CalculateFluxes function templated over Riemann Solvers (and reconstruction method)
+  // Fluxes are computed on all faces of cells in range rng (plus extra faces needed for
+  // FOFC), and RK update is performed over cells in range rng
   template <Hydro_RSolver T>
-  void CalculateFluxes(Driver *d, int stage);
+  void CalculateFluxes(Driver *d, int stage, const CellRange &rng);
+  template <Hydro_RSolver T, ReconstructionMethod R, bool F>
+  void CalculateFluxes(Driver *d, int stage, const CellRange &rng);
+  void FluxesOverRange(Driver *d, int stage, const CellRange &rng);
+  void RKUpdateOverRange(Driver *d, int stage, const CellRange &rng);
 
   // first-order flux correction
   void FOFC(Driver *d, int stage);
@@ -31,35 +31,53 @@
 namespace hydro {
 //----------------------------------------------------------------------------------------
 //! \fn void Hydro::CalculateFluxes
-//! \brief Calls reconstruction and Riemann solver functions to compute hydro fluxes
-//! Note this function is templated over RS for better performance on GPUs.
-
-template <Hydro_RSolver rsolver_method_>
-void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
+//! \brief Calls reconstruction and Riemann solver functions to compute hydro fluxes on
+//! all faces of the cells in the range rng.  With FOFC fluxes are also computed on the
+//! faces of one extra layer of cells (FOFC is only used when rng spans all active cells).
+//! Note this function is templated over both RS and reconstruction method, so that each
+//! kernel contains only the code paths it uses, and scratch memory is sized per method.
+//!
+//! With fused_update the fluxes are only stored in scratch memory, and the flux
+//! difference in each direction is added to u0 in the same kernel.  The x1-kernel also
+//! applies the weighted average of u0 and u1, so RKUpdate() is not needed, and uflx is
+//! not allocated.  Only used on uniform grids without FOFC or diffusion, since these
+//! require fluxes on all faces.
+
+template <Hydro_RSolver rsolver_method_, ReconstructionMethod recon_method_,
+          bool fused_update_>
+void Hydro::CalculateFluxes(Driver *pdriver, int stage, const CellRange &rng) {
   RegionIndcs &indcs_ = pmy_pack->pmesh->mb_indcs;
-  int is = indcs_.is, ie = indcs_.ie;
-  int js = indcs_.js, je = indcs_.je;
-  int ks = indcs_.ks, ke = indcs_.ke;
+  int is = rng.il, ie = rng.iu;
+  int js = rng.jl, je = rng.ju;
+  int ks = rng.kl, ke = rng.ku;
   int ncells1 = indcs_.nx1 + 2*(indcs_.ng);
 
   int &nhyd_  = nhydro;
   int nvars = nhydro + nscalars;
   int nmb1 = pmy_pack->nmb_thispack - 1;
-  const auto recon_method_ = recon_method;
-  bool extrema = false;
-  if (recon_method == ReconstructionMethod::ppmx) {
-    extrema = true;
-  }
+  constexpr bool extrema = (recon_method_ == ReconstructionMethod::ppmx);
 
   auto &eos_ = peos->eos_data;
   auto &size_ = pmy_pack->pmb->mb_size;
   auto &coord_ = pmy_pack->pcoord->coord_data;
   auto &w0_ = w0;
 
+  // weights and fractional time step of RK stage, used with fused update
+  Real gam0 = 0.0, gam1 = 0.0, beta_dt = 0.0;
+  if constexpr (fused_update_) {
+    gam0 = pdriver->gam0[stage-1];
+    gam1 = pdriver->gam1[stage-1];
+    beta_dt = (pdriver->beta[stage-1])*(pmy_pack->pmesh->dt);
+  }
+  auto &u0_ = u0;
+  auto &u1_ = u1;
+  // number of scratch arrays for fluxes with fused update
+  constexpr int nfscr = (fused_update_)? 1 : 0;
+
   //--------------------------------------------------------------------------------------
   // i-direction
 
-  size_t scr_size = ScrArray2D<Real>::shmem_size(nvars, ncells1) * 2;
+  size_t scr_size = ScrArray2D<Real>::shmem_size(nvars, ncells1) * (2 + nfscr);
   int scr_level = 0;
   auto &flx1_ = uflx.x1f;
 
@@ -78,35 +96,32 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
   KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
     ScrArray2D<Real> wl(member.team_scratch(scr_level), nvars, ncells1);
     ScrArray2D<Real> wr(member.team_scratch(scr_level), nvars, ncells1);
+    ScrArray2D<Real> fscr;
+    if constexpr (fused_update_) {
+      fscr = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+    }
 
     // Reconstruct qR[i] and qL[i+1]
-    switch (recon_method_) {
-      case ReconstructionMethod::dc:
-        DonorCellX1(member, m, k, j, il-1, iu, w0_, wl, wr);
-        break;
-      case ReconstructionMethod::plm:
-        PiecewiseLinearX1(member, m, k, j, il-1, iu, w0_, wl, wr);
-        break;
-      case ReconstructionMethod::ppm4:
-      case ReconstructionMethod::ppmx:
-        PiecewiseParabolicX1(member,eos_,extrema,true, m, k, j, il-1, iu, w0_, wl, wr);
-        break;
-      case ReconstructionMethod::wenoz:
-        WENOZX1(member, eos_, true, m, k, j, il-1, iu, w0_, wl, wr);
-        break;
-      default:
-        break;
+    if constexpr (recon_method_ == ReconstructionMethod::dc) {
+      DonorCellX1(member, m, k, j, il-1, iu, w0_, wl, wr);
+    } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+      PiecewiseLinearX1(member, m, k, j, il-1, iu, w0_, wl, wr);
+    } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                         recon_method_ == ReconstructionMethod::ppmx) {
+      PiecewiseParabolicX1(member,eos_,extrema,true, m, k, j, il-1, iu, w0_, wl, wr);
+    } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+      WENOZX1(member, eos_, true, m, k, j, il-1, iu, w0_, wl, wr);
     }
     // Sync all threads in the team so that scratch memory is consistent
     member.team_barrier();
 
-    // compute fluxes over [is,ie+1]
+    // compute fluxes over [il,iu]
     // NOTE(@pdmullen): Capture variables prior to if constexpr.  Required for cuda 11.6+.
     auto eos = eos_;
     auto indcs = indcs_;
     auto size = size_;
     auto coord = coord_;
-    auto flx1 = flx1_;
+    auto flx1 = FluxArray<fused_update_>(flx1_, fscr);
     if constexpr (rsolver_method_ == Hydro_RSolver::advect) {
       Advect(member, eos, indcs, size, coord, m, k, j, il, iu, IVX, wl, wr, flx1);
     } else if constexpr (rsolver_method_ == Hydro_RSolver::llf) {
@@ -134,21 +149,34 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
     if (nvars > nhyd_) {
       for (int n=nhyd_; n<nvars; ++n) {
         par_for_inner(member, is, ie+1, [&](const int i) {
-          if (flx1_(m,IDN,k,j,i) >= 0.0) {
-            flx1_(m,n,k,j,i) = flx1_(m,IDN,k,j,i)*wl(n,i);
+          if (flx1(m,IDN,k,j,i) >= 0.0) {
+            flx1(m,n,k,j,i) = flx1(m,IDN,k,j,i)*wl(n,i);
           } else {
-            flx1_(m,n,k,j,i) = flx1_(m,IDN,k,j,i)*wr(n,i);
+            flx1(m,n,k,j,i) = flx1(m,IDN,k,j,i)*wr(n,i);
           }
         });
       }
     }
+
+    // with fused update, apply weighted average and add dF1/dx1 to u0
+    if constexpr (fused_update_) {
+      member.team_barrier();
+      for (int n=0; n<nvars; ++n) {
+        par_for_inner(member, is, ie, [&](const int i) {
+          u0_(m,n,k,j,i) = gam0*u0_(m,n,k,j,i) + gam1*u1_(m,n,k,j,i)
+                         - beta_dt*(fscr(n,i+1) - fscr(n,i))/size.d_view(m).dx1;
+        });
+      }
+    }
   });
 
   //--------------------------------------------------------------------------------------
   // j-direction
+  // Three scratch arrays are cycled over j (two are sufficient for donor cell)
 
+  constexpr int nscr = (recon_method_ == ReconstructionMethod::dc)? 2 : 3;
   if (pmy_pack->pmesh->multi_d) {
-    scr_size = ScrArray2D<Real>::shmem_size(nvars, ncells1) * 3;
+    scr_size = ScrArray2D<Real>::shmem_size(nvars, ncells1) * (nscr + 2*nfscr);
     auto &flx2_ = uflx.x2f;
 
     // set the loop limits for 1D/2D/3D problems
@@ -166,7 +194,15 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
     KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k) {
       ScrArray2D<Real> scr1(member.team_scratch(scr_level), nvars, ncells1);
       ScrArray2D<Real> scr2(member.team_scratch(scr_level), nvars, ncells1);
-      ScrArray2D<Real> scr3(member.team_scratch(scr_level), nvars, ncells1);
+      ScrArray2D<Real> scr3;
+      if constexpr (nscr == 3) {
+        scr3 = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+      }
+      ScrArray2D<Real> fscr1, fscr2;
+      if constexpr (fused_update_) {
+        fscr1 = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+        fscr2 = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+      }
 
       for (int j=jl; j<=ju; ++j) {
         // Permute scratch arrays.
@@ -177,24 +213,26 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
           wl     = scr2;
           wl_jp1 = scr1;
         }
+        // with donor cell, qR[j] = qL[j+1], so both share the same array
+        if constexpr (nscr == 2) {wr = wl_jp1;}
+        // with fused update, fluxes on faces j and j-1 are kept in scratch
+        auto fj   = fscr1;
+        auto fjm1 = fscr2;
+        if ((j%2) == 0) {
+          fj   = fscr2;
+          fjm1 = fscr1;
+        }
 
         // Reconstruct qR[j] and qL[j+1]
-        switch (recon_method_) {
-          case ReconstructionMethod::dc:
-            DonorCellX2(member, m, k, j, il, iu, w0_, wl_jp1, wr);
-            break;
-          case ReconstructionMethod::plm:
-            PiecewiseLinearX2(member, m, k, j, il, iu, w0_, wl_jp1, wr);
-            break;
-          case ReconstructionMethod::ppm4:
-          case ReconstructionMethod::ppmx:
-            PiecewiseParabolicX2(member,eos_,extrema,true,m,k,j,il,iu, w0_, wl_jp1, wr);
-            break;
-          case ReconstructionMethod::wenoz:
-            WENOZX2(member, eos_, true, m, k, j, il, iu, w0_, wl_jp1, wr);
-            break;
-          default:
-            break;
+        if constexpr (recon_method_ == ReconstructionMethod::dc) {
+          DonorCellX2(member, m, k, j, il, iu, w0_, wl_jp1, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+          PiecewiseLinearX2(member, m, k, j, il, iu, w0_, wl_jp1, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                             recon_method_ == ReconstructionMethod::ppmx) {
+          PiecewiseParabolicX2(member,eos_,extrema,true,m,k,j,il,iu, w0_, wl_jp1, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+          WENOZX2(member, eos_, true, m, k, j, il, iu, w0_, wl_jp1, wr);
         }
         member.team_barrier();
 
@@ -205,7 +243,7 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
           auto indcs = indcs_;
           auto size = size_;
           auto coord = coord_;
-          auto flx2 = flx2_;
+          auto flx2 = FluxArray<fused_update_>(flx2_, fj);
           if constexpr (rsolver_method_ == Hydro_RSolver::advect) {
             Advect(member, eos, indcs, size, coord, m, k, j, il, iu, IVY, wl, wr, flx2);
           } else if constexpr (rsolver_method_ == Hydro_RSolver::llf) {
@@ -228,18 +266,31 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
             HLLE_GR(member, eos, indcs, size, coord, m, k, j, il, iu, IVY, wl, wr, flx2);
           }
           member.team_barrier();
-        }
 
-        // calculate fluxes of scalars (if any)
-        if (nvars > nhyd_) {
-          for (int n=nhyd_; n<nvars; ++n) {
-            par_for_inner(member, is, ie, [&](const int i) {
-              if (flx2_(m,IDN,k,j,i) >= 0.0) {
-                flx2_(m,n,k,j,i) = flx2_(m,IDN,k,j,i)*wl(n,i);
-              } else {
-                flx2_(m,n,k,j,i) = flx2_(m,IDN,k,j,i)*wr(n,i);
+          // calculate fluxes of scalars (if any)
+          if (nvars > nhyd_) {
+            for (int n=nhyd_; n<nvars; ++n) {
+              par_for_inner(member, is, ie, [&](const int i) {
+                if (flx2(m,IDN,k,j,i) >= 0.0) {
+                  flx2(m,n,k,j,i) = flx2(m,IDN,k,j,i)*wl(n,i);
+                } else {
+                  flx2(m,n,k,j,i) = flx2(m,IDN,k,j,i)*wr(n,i);
+                }
+              });
+            }
+          }
+
+          // with fused update, add dF2/dx2 to u0 in cell j-1
+          if constexpr (fused_update_) {
+            if (j > js) {
+              member.team_barrier();
+              for (int n=0; n<nvars; ++n) {
+                par_for_inner(member, il, iu, [&](const int i) {
+                  u0_(m,n,k,j-1,i) -= beta_dt*(fj(n,i) - fjm1(n,i))/
+                                      size.d_view(m).dx2;
+                });
               }
-            });
+            }
           }
         }
       } // end of loop over j
@@ -250,7 +301,7 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
   // k-direction. Note order of k,j loops switched
 
   if (pmy_pack->pmesh->three_d) {
-    scr_size = ScrArray2D<Real>::shmem_size(nvars, ncells1) * 3;
+    scr_size = ScrArray2D<Real>::shmem_size(nvars, ncells1) * (nscr + 2*nfscr);
     auto &flx3_ = uflx.x3f;
 
     // set the loop limits
@@ -261,7 +312,15 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
     KOKKOS_LAMBDA(TeamMember_t member, const int m, const int j) {
       ScrArray2D<Real> scr1(member.team_scratch(scr_level), nvars, ncells1);
       ScrArray2D<Real> scr2(member.team_scratch(scr_level), nvars, ncells1);
-      ScrArray2D<Real> scr3(member.team_scratch(scr_level), nvars, ncells1);
+      ScrArray2D<Real> scr3;
+      if constexpr (nscr == 3) {
+        scr3 = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+      }
+      ScrArray2D<Real> fscr1, fscr2;
+      if constexpr (fused_update_) {
+        fscr1 = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+        fscr2 = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+      }
 
       for (int k=kl; k<=ku; ++k) {
         // Permute scratch arrays.
@@ -272,24 +331,26 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
           wl     = scr2;
           wl_kp1 = scr1;
         }
+        // with donor cell, qR[k] = qL[k+1], so both share the same array
+        if constexpr (nscr == 2) {wr = wl_kp1;}
+        // with fused update, fluxes on faces k and k-1 are kept in scratch
+        auto fk   = fscr1;
+        auto fkm1 = fscr2;
+        if ((k%2) == 0) {
+          fk   = fscr2;
+          fkm1 = fscr1;
+        }
 
         // Reconstruct qR[k] and qL[k+1]
-        switch (recon_method_) {
-          case ReconstructionMethod::dc:
-            DonorCellX3(member, m, k, j, il, iu, w0_, wl_kp1, wr);
-            break;
-          case ReconstructionMethod::plm:
-            PiecewiseLinearX3(member, m, k, j, il, iu, w0_, wl_kp1, wr);
-            break;
-          case ReconstructionMethod::ppm4:
-          case ReconstructionMethod::ppmx:
-            PiecewiseParabolicX3(member,eos_,extrema,true,m,k,j,il,iu, w0_, wl_kp1, wr);
-            break;
-          case ReconstructionMethod::wenoz:
-            WENOZX3(member, eos_, true, m, k, j, il, iu, w0_, wl_kp1, wr);
-            break;
-          default:
-            break;
+        if constexpr (recon_method_ == ReconstructionMethod::dc) {
+          DonorCellX3(member, m, k, j, il, iu, w0_, wl_kp1, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+          PiecewiseLinearX3(member, m, k, j, il, iu, w0_, wl_kp1, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                             recon_method_ == ReconstructionMethod::ppmx) {
+          PiecewiseParabolicX3(member,eos_,extrema,true,m,k,j,il,iu, w0_, wl_kp1, wr);
+        } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+          WENOZX3(member, eos_, true, m, k, j, il, iu, w0_, wl_kp1, wr);
         }
         member.team_barrier();
 
@@ -300,7 +361,7 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
           auto indcs = indcs_;
           auto size = size_;
           auto coord = coord_;
-          auto flx3 = flx3_;
+          auto flx3 = FluxArray<fused_update_>(flx3_, fk);
           if constexpr (rsolver_method_ == Hydro_RSolver::advect) {
             Advect(member, eos, indcs, size, coord, m, k, j, il, iu, IVZ, wl, wr, flx3);
           } else if constexpr (rsolver_method_ == Hydro_RSolver::llf) {
@@ -323,18 +384,31 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
             HLLE_GR(member, eos, indcs, size, coord, m, k, j, il, iu, IVZ, wl, wr, flx3);
           }
           member.team_barrier();
-        }
 
-        // calculate fluxes of scalars (if any)
-        if (nvars > nhyd_) {
-          for (int n=nhyd_; n<nvars; ++n) {
-            par_for_inner(member, is, ie, [&](const int i) {
-              if (flx3_(m,IDN,k,j,i) >= 0.0) {
-                flx3_(m,n,k,j,i) = flx3_(m,IDN,k,j,i)*wl(n,i);
-              } else {
-                flx3_(m,n,k,j,i) = flx3_(m,IDN,k,j,i)*wr(n,i);
+          // calculate fluxes of scalars (if any)
+          if (nvars > nhyd_) {
+            for (int n=nhyd_; n<nvars; ++n) {
+              par_for_inner(member, is, ie, [&](const int i) {
+                if (flx3(m,IDN,k,j,i) >= 0.0) {
+                  flx3(m,n,k,j,i) = flx3(m,IDN,k,j,i)*wl(n,i);
+                } else {
+                  flx3(m,n,k,j,i) = flx3(m,IDN,k,j,i)*wr(n,i);
+                }
+              });
+            }
+          }
+
+          // with fused update, add dF3/dx3 to u0 in cell k-1
+          if constexpr (fused_update_) {
+            if (k > ks) {
+              member.team_barrier();
+              for (int n=0; n<nvars; ++n) {
+                par_for_inner(member, il, iu, [&](const int i) {
+                  u0_(m,n,k-1,j,i) -= beta_dt*(fk(n,i) - fkm1(n,i))/
+                                      size.d_view(m).dx3;
+                });
               }
-            });
+            }
           }
         }
       } // end loop over k
@@ -344,16 +418,77 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void Hydro::CalculateFluxes
+//! \brief Selects CalculateFluxes function specialized for reconstruction method (and
+//! fused update).  The choice is made once per call, rather than inside every team of
+//! each flux kernel.
+
+template <Hydro_RSolver rsolver_method_>
+void Hydro::CalculateFluxes(Driver *pdriver, int stage, const CellRange &rng) {
+  using RM = ReconstructionMethod;
+  switch (recon_method) {
+    case RM::dc:
+      if (fused_update) {
+        CalculateFluxes<rsolver_method_, RM::dc, true>(pdriver, stage, rng);
+      } else {
+        CalculateFluxes<rsolver_method_, RM::dc, false>(pdriver, stage, rng);
+      }
+      break;
+    case RM::plm:
+      if (fused_update) {
+        CalculateFluxes<rsolver_method_, RM::plm, true>(pdriver, stage, rng);
+      } else {
+        CalculateFluxes<rsolver_method_, RM::plm, false>(pdriver, stage, rng);
+      }
+      break;
+    case RM::ppm4:
+      if (fused_update) {
+        CalculateFluxes<rsolver_method_, RM::ppm4, true>(pdriver, stage, rng);
+      } else {
+        CalculateFluxes<rsolver_method_, RM::ppm4, false>(pdriver, stage, rng);
+      }
+      break;
+    case RM::ppmx:
+      if (fused_update) {
+        CalculateFluxes<rsolver_method_, RM::ppmx, true>(pdriver, stage, rng);
+      } else {
+        CalculateFluxes<rsolver_method_, RM::ppmx, false>(pdriver, stage, rng);
+      }
+      break;
+    case RM::wenoz:
+      if (fused_update) {
+        CalculateFluxes<rsolver_method_, RM::wenoz, true>(pdriver, stage, rng);
+      } else {
+        CalculateFluxes<rsolver_method_, RM::wenoz, false>(pdriver, stage, rng);
+      }
+      break;
+    default:
+      break;
+  }
+  return;
+}
+
 // function definitions for each template parameter
-template void Hydro::CalculateFluxes<Hydro_RSolver::advect>(Driver *pdriver, int stage);
-template void Hydro::CalculateFluxes<Hydro_RSolver::llf>(Driver *pdriver, int stage);
-template void Hydro::CalculateFluxes<Hydro_RSolver::hlle>(Driver *pdriver, int stage);
-template void Hydro::CalculateFluxes<Hydro_RSolver::hllc>(Driver *pdriver, int stage);
-template void Hydro::CalculateFluxes<Hydro_RSolver::roe>(Driver *pdriver, int stage);
-template void Hydro::CalculateFluxes<Hydro_RSolver::llf_sr>(Driver *pdriver, int stage);
-template void Hydro::CalculateFluxes<Hydro_RSolver::hlle_sr>(Driver *pdriver, int stage);
-template void Hydro::CalculateFluxes<Hydro_RSolver::hllc_sr>(Driver *pdriver, int stage);
-template void Hydro::CalculateFluxes<Hydro_RSolver::llf_gr>(Driver *pdriver, int stage);
-template void Hydro::CalculateFluxes<Hydro_RSolver::hlle_gr>(Driver *pdriver, int stage);
+template void Hydro::CalculateFluxes<Hydro_RSolver::advect>(Driver *pdriver, int stage,
+                                                            const CellRange &rng);
+template void Hydro::CalculateFluxes<Hydro_RSolver::llf>(Driver *pdriver, int stage,
+                                                         const CellRange &rng);
+template void Hydro::CalculateFluxes<Hydro_RSolver::hlle>(Driver *pdriver, int stage,
+                                                          const CellRange &rng);
+template void Hydro::CalculateFluxes<Hydro_RSolver::hllc>(Driver *pdriver, int stage,
+                                                          const CellRange &rng);
+template void Hydro::CalculateFluxes<Hydro_RSolver::roe>(Driver *pdriver, int stage,
+                                                         const CellRange &rng);
+template void Hydro::CalculateFluxes<Hydro_RSolver::llf_sr>(Driver *pdriver, int stage,
+                                                            const CellRange &rng);
+template void Hydro::CalculateFluxes<Hydro_RSolver::hlle_sr>(Driver *pdriver, int stage,
+                                                             const CellRange &rng);
+template void Hydro::CalculateFluxes<Hydro_RSolver::hllc_sr>(Driver *pdriver, int stage,
+                                                             const CellRange &rng);
+template void Hydro::CalculateFluxes<Hydro_RSolver::llf_gr>(Driver *pdriver, int stage,
+                                                            const CellRange &rng);
+template void Hydro::CalculateFluxes<Hydro_RSolver::hlle_gr>(Driver *pdriver, int stage,
+                                                             const CellRange &rng);
 
 } // namespace hydro
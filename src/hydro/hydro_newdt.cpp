@@ -20,6 +20,7 @@
 #include "diffusion/conduction.hpp"
 #include "diffusion/viscosity.hpp"
 #include "srcterms/srcterms.hpp"
+#include "outputs/history_sums.hpp"
 
 namespace hydro {
 
@@ -52,9 +53,55 @@ TaskStatus Hydro::NewTimeStep(Driver *pdrive, int stage) {
   const int nkji = nx3*nx2*nx1;
   const int nji  = nx2*nx1;
 
-  if (pdrive->time_evolution == TimeEvolution::kinematic) {
-    // find smallest (dx/v) in each direction for advection problems
-    Kokkos::parallel_reduce("HydroNudt1",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  // find smallest (dx/v) in each direction for advection problems, and smallest
+  // dx/(v +/- Cs) in each direction for hydrodynamic problems
+  bool kinematic = (pdrive->time_evolution == TimeEvolution::kinematic);
+  auto cell_dt = KOKKOS_LAMBDA(const int m, const int k, const int j, const int i,
+                               Real &min_dt1, Real &min_dt2, Real &min_dt3) {
+    Real max_dv1 = 0.0, max_dv2 = 0.0, max_dv3 = 0.0;
+
+    if (kinematic) {
+      max_dv1 = fabs(w0_(m,IVX,k,j,i));
+      max_dv2 = fabs(w0_(m,IVY,k,j,i));
+      max_dv3 = fabs(w0_(m,IVZ,k,j,i));
+    } else if (is_general_relativistic_ || is_dynamical_relativistic_) {
+      max_dv1 = 1.0;
+      max_dv2 = 1.0;
+      max_dv3 = 1.0;
+    } else if (is_special_relativistic_) {
+      Real v2 = SQR(w0_(m,IVX,k,j,i)) + SQR(w0_(m,IVY,k,j,i)) + SQR(w0_(m,IVZ,k,j,i));
+      Real lor = sqrt(1.0 + v2);
+      // FIXME ERM: Ideal fluid for now
+      Real p = eos.IdealGasPressure(w0_(m,IEN,k,j,i));
+
+      Real lm, lp;
+      eos.IdealSRHydroSoundSpeeds(w0_(m,IDN,k,j,i), p, w0_(m,IVX,k,j,i), lor, lp, lm);
+      max_dv1 = fmax(fabs(lm), lp);
+
+      eos.IdealSRHydroSoundSpeeds(w0_(m,IDN,k,j,i), p, w0_(m,IVY,k,j,i), lor, lp, lm);
+      max_dv2 = fmax(fabs(lm), lp);
+
+      eos.IdealSRHydroSoundSpeeds(w0_(m,IDN,k,j,i), p, w0_(m,IVZ,k,j,i), lor, lp, lm);
+      max_dv3 = fmax(fabs(lm), lp);
+    } else {
+      Real cs;
+      if (eos.is_ideal) {
+        Real p = eos.IdealGasPressure(w0_(m,IEN,k,j,i));
+        cs = eos.IdealHydroSoundSpeed(w0_(m,IDN,k,j,i), p);
+      } else         {
+        cs = eos.iso_cs;
+      }
+      max_dv1 = fabs(w0_(m,IVX,k,j,i)) + cs;
+      max_dv2 = fabs(w0_(m,IVY,k,j,i)) + cs;
+      max_dv3 = fabs(w0_(m,IVZ,k,j,i)) + cs;
+    }
+    min_dt1 = fmin((mbsize.d_view(m).dx1/max_dv1), min_dt1);
+    min_dt2 = fmin((mbsize.d_view(m).dx2/max_dv2), min_dt2);
+    min_dt3 = fmin((mbsize.d_view(m).dx3/max_dv3), min_dt3);
+  };
+
+  if (!fuse_hist) {
+    Kokkos::parallel_reduce("HydroNudt",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
     KOKKOS_LAMBDA(const int &idx, Real &min_dt1, Real &min_dt2, Real &min_dt3) {
       // compute m,k,j,i indices of thread and call function
       int m = (idx)/nkji;
@@ -63,15 +110,18 @@ TaskStatus Hydro::NewTimeStep(Driver *pdrive, int stage) {
       int i = (idx - m*nkji - k*nji - j*nx1) + is;
       k += ks;
       j += js;
-
-      min_dt1 = fmin((mbsize.d_view(m).dx1/fabs(w0_(m,IVX,k,j,i))), min_dt1);
-      min_dt2 = fmin((mbsize.d_view(m).dx2/fabs(w0_(m,IVY,k,j,i))), min_dt2);
-      min_dt3 = fmin((mbsize.d_view(m).dx3/fabs(w0_(m,IVZ,k,j,i))), min_dt3);
+      cell_dt(m, k, j, i, min_dt1, min_dt2, min_dt3);
     }, Kokkos::Min<Real>(dt1), Kokkos::Min<Real>(dt2),Kokkos::Min<Real>(dt3));
   } else {
-    // find smallest dx/(v +/- Cs) in each direction for hydrodynamic problems
-    Kokkos::parallel_reduce("HydroNudt2",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-    KOKKOS_LAMBDA(const int &idx, Real &min_dt1, Real &min_dt2, Real &min_dt3) {
+    // history output is due at end of this cycle, so accumulate history sums over
+    // conserved variables in the same sweep (see HistoryOutput::LoadHydroHistoryData)
+    auto &u0_ = u0;
+    int nhydro_ = nhydro, nscalars_ = nscalars;
+    bool is_ideal = eos.is_ideal;
+    hist_sums = array_sum::GlobalSum();
+    Kokkos::parallel_reduce("HydroNudtHist",Kokkos::RangePolicy<>(DevExeSpace(),0,nmkji),
+    KOKKOS_LAMBDA(const int &idx, Real &min_dt1, Real &min_dt2, Real &min_dt3,
+                  array_sum::GlobalSum &hsum) {
       // compute m,k,j,i indices of thread and call function
       int m = (idx)/nkji;
       int k = (idx - m*nkji)/nji;
@@ -79,44 +129,11 @@ TaskStatus Hydro::NewTimeStep(Driver *pdrive, int stage) {
       int i = (idx - m*nkji - k*nji - j*nx1) + is;
       k += ks;
       j += js;
-
-      Real max_dv1 = 0.0, max_dv2 = 0.0, max_dv3 = 0.0;
-
-      if (is_general_relativistic_ || is_dynamical_relativistic_) {
-        max_dv1 = 1.0;
-        max_dv2 = 1.0;
-        max_dv3 = 1.0;
-      } else if (is_special_relativistic_) {
-        Real v2 = SQR(w0_(m,IVX,k,j,i)) + SQR(w0_(m,IVY,k,j,i)) + SQR(w0_(m,IVZ,k,j,i));
-        Real lor = sqrt(1.0 + v2);
-        // FIXME ERM: Ideal fluid for now
-        Real p = eos.IdealGasPressure(w0_(m,IEN,k,j,i));
-
-        Real lm, lp;
-        eos.IdealSRHydroSoundSpeeds(w0_(m,IDN,k,j,i), p, w0_(m,IVX,k,j,i), lor, lp, lm);
-        max_dv1 = fmax(fabs(lm), lp);
-
-        eos.IdealSRHydroSoundSpeeds(w0_(m,IDN,k,j,i), p, w0_(m,IVY,k,j,i), lor, lp, lm);
-        max_dv2 = fmax(fabs(lm), lp);
-
-        eos.IdealSRHydroSoundSpeeds(w0_(m,IDN,k,j,i), p, w0_(m,IVZ,k,j,i), lor, lp, lm);
-        max_dv3 = fmax(fabs(lm), lp);
-      } else {
-        Real cs;
-        if (eos.is_ideal) {
-          Real p = eos.IdealGasPressure(w0_(m,IEN,k,j,i));
-          cs = eos.IdealHydroSoundSpeed(w0_(m,IDN,k,j,i), p);
-        } else         {
-          cs = eos.iso_cs;
-        }
-        max_dv1 = fabs(w0_(m,IVX,k,j,i)) + cs;
-        max_dv2 = fabs(w0_(m,IVY,k,j,i)) + cs;
-        max_dv3 = fabs(w0_(m,IVZ,k,j,i)) + cs;
-      }
-      min_dt1 = fmin((mbsize.d_view(m).dx1/max_dv1), min_dt1);
-      min_dt2 = fmin((mbsize.d_view(m).dx2/max_dv2), min_dt2);
-      min_dt3 = fmin((mbsize.d_view(m).dx3/max_dv3), min_dt3);
-    }, Kokkos::Min<Real>(dt1), Kokkos::Min<Real>(dt2),Kokkos::Min<Real>(dt3));
+      cell_dt(m, k, j, i, min_dt1, min_dt2, min_dt3);
+      Real vol = mbsize.d_view(m).dx1*mbsize.d_view(m).dx2*mbsize.d_view(m).dx3;
+      HydroHistorySums(u0_, m, k, j, i, vol, nhydro_, nscalars_, is_ideal, hsum);
+    }, Kokkos::Min<Real>(dt1), Kokkos::Min<Real>(dt2),Kokkos::Min<Real>(dt3),
+       Kokkos::Sum<array_sum::GlobalSum>(hist_sums));
   }
 
   // compute minimum of dt1/dt2/dt3 for 1D/2D/3D problems
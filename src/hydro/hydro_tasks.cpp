@@ -44,37 +44,93 @@ namespace hydro {
 //!
 //! In addition there are "before_timeintegrator" and "after_timeintegrator" task lists
 //! in the tl map, which are generally used for operator split tasks.
+//!
+//! With <hydro>/split_phase=true the "stagen" task list is instead split so that only the
+//! shell of active cells within ng cells of MeshBlock faces is updated before SendU.  The
+//! fluxes, update, and ConsToPrim of the interior cells are then computed while boundary
+//! communications are in flight, and ConsToPrim in the ghost cells is done after RecvU.
 
 void Hydro::AssembleHydroTasks(std::map<std::string, std::shared_ptr<TaskList>> tl) {
   TaskID none(0);
 
   // assemble "before_stagen" task list
-  id.irecv = tl["before_stagen"]->AddTask(&Hydro::InitRecv, this, none);
+  id.irecv = tl["before_stagen"]->AddTask(&Hydro::InitRecv, this, none,
+                                          "Hydro::InitRecv");
+
+  // assemble "stagen" task list with split-phase updates.  Note id.flux and id.rkupdt
+  // refer to the shell, so that tasks inserted between them (e.g. turbulence driving)
+  // still precede the update of all active cells.
+  if (split_phase) {
+    pmy_pack->pmesh->SplitPhaseRanges(shell_rng, interior_rng, ghost_rng);
+    id.copyu      = tl["stagen"]->AddTask(&Hydro::CopyCons, this, none,
+                                          "Hydro::CopyCons");
+    id.flux       = tl["stagen"]->AddTask(&Hydro::FluxesShell, this, id.copyu,
+                                          "Hydro::FluxesShell");
+    id.rkupdt     = tl["stagen"]->AddTask(&Hydro::RKUpdateShell, this, id.flux,
+                                          "Hydro::RKUpdateShell");
+    id.sendu      = tl["stagen"]->AddTask(&Hydro::SendU, this, id.rkupdt, "Hydro::SendU");
+    id.flux_int   = tl["stagen"]->AddTask(&Hydro::FluxesInterior, this, id.sendu,
+                                          "Hydro::FluxesInterior");
+    id.rkupdt_int = tl["stagen"]->AddTask(&Hydro::RKUpdateInterior, this, id.flux_int,
+                                          "Hydro::RKUpdateInterior");
+    id.c2p_int    = tl["stagen"]->AddTask(&Hydro::ConToPrimActive, this, id.rkupdt_int,
+                                          "Hydro::ConToPrimActive");
+    id.recvu      = tl["stagen"]->AddTask(&Hydro::RecvU, this, id.c2p_int,
+                                          "Hydro::RecvU");
+    id.bcs        = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, this, id.recvu,
+                                          "Hydro::ApplyPhysicalBCs");
+    id.c2p        = tl["stagen"]->AddTask(&Hydro::ConToPrimGhost, this, id.bcs,
+                                          "Hydro::ConToPrimGhost");
+    id.newdt      = tl["stagen"]->AddTask(&Hydro::NewTimeStep, this, id.c2p,
+                                          "Hydro::NewTimeStep");
+
+    // assemble "after_stagen" task list
+    id.csend = tl["after_stagen"]->AddTask(&Hydro::ClearSend, this, none,
+                                           "Hydro::ClearSend");
+    id.crecv = tl["after_stagen"]->AddTask(&Hydro::ClearRecv, this, id.csend,
+                                           "Hydro::ClearRecv");
+    return;
+  }
 
   // assemble "stagen" task list
-  id.copyu     = tl["stagen"]->AddTask(&Hydro::CopyCons, this, none);
-  id.flux      = tl["stagen"]->AddTask(&Hydro::Fluxes,this,id.copyu);
-  id.sendf     = tl["stagen"]->AddTask(&Hydro::SendFlux, this, id.flux);
-  id.recvf     = tl["stagen"]->AddTask(&Hydro::RecvFlux, this, id.sendf);
-  id.rkupdt    = tl["stagen"]->AddTask(&Hydro::RKUpdate, this, id.recvf);
-  id.srctrms   = tl["stagen"]->AddTask(&Hydro::HydroSrcTerms, this, id.rkupdt);
-  id.sendu_oa  = tl["stagen"]->AddTask(&Hydro::SendU_OA, this, id.srctrms);
-  id.recvu_oa  = tl["stagen"]->AddTask(&Hydro::RecvU_OA, this, id.sendu_oa);
-  id.restu     = tl["stagen"]->AddTask(&Hydro::RestrictU, this, id.recvu_oa);
-  id.sendu     = tl["stagen"]->AddTask(&Hydro::SendU, this, id.restu);
-  id.recvu     = tl["stagen"]->AddTask(&Hydro::RecvU, this, id.sendu);
-  id.sendu_shr = tl["stagen"]->AddTask(&Hydro::SendU_Shr, this, id.recvu);
-  id.recvu_shr = tl["stagen"]->AddTask(&Hydro::RecvU_Shr, this, id.sendu_shr);
-  id.bcs       = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, this, id.recvu_shr);
-  id.prol      = tl["stagen"]->AddTask(&Hydro::Prolongate, this, id.bcs);
-  id.c2p       = tl["stagen"]->AddTask(&Hydro::ConToPrim, this, id.prol);
-  id.newdt     = tl["stagen"]->AddTask(&Hydro::NewTimeStep, this, id.c2p);
+  id.copyu     = tl["stagen"]->AddTask(&Hydro::CopyCons, this, none, "Hydro::CopyCons");
+  id.flux      = tl["stagen"]->AddTask(&Hydro::Fluxes,this,id.copyu, "Hydro::Fluxes");
+  id.sendf     = tl["stagen"]->AddTask(&Hydro::SendFlux, this, id.flux,
+                                       "Hydro::SendFlux");
+  id.recvf     = tl["stagen"]->AddTask(&Hydro::RecvFlux, this, id.sendf,
+                                       "Hydro::RecvFlux");
+  id.rkupdt    = tl["stagen"]->AddTask(&Hydro::RKUpdate, this, id.recvf,
+                                       "Hydro::RKUpdate");
+  id.srctrms   = tl["stagen"]->AddTask(&Hydro::HydroSrcTerms, this, id.rkupdt,
+                                       "Hydro::HydroSrcTerms");
+  id.sendu_oa  = tl["stagen"]->AddTask(&Hydro::SendU_OA, this, id.srctrms,
+                                       "Hydro::SendU_OA");
+  id.recvu_oa  = tl["stagen"]->AddTask(&Hydro::RecvU_OA, this, id.sendu_oa,
+                                       "Hydro::RecvU_OA");
+  id.restu     = tl["stagen"]->AddTask(&Hydro::RestrictU, this, id.recvu_oa,
+                                       "Hydro::RestrictU");
+  id.sendu     = tl["stagen"]->AddTask(&Hydro::SendU, this, id.restu, "Hydro::SendU");
+  id.recvu     = tl["stagen"]->AddTask(&Hydro::RecvU, this, id.sendu, "Hydro::RecvU");
+  id.sendu_shr = tl["stagen"]->AddTask(&Hydro::SendU_Shr, this, id.recvu,
+                                       "Hydro::SendU_Shr");
+  id.recvu_shr = tl["stagen"]->AddTask(&Hydro::RecvU_Shr, this, id.sendu_shr,
+                                       "Hydro::RecvU_Shr");
+  id.bcs       = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, this, id.recvu_shr,
+                                       "Hydro::ApplyPhysicalBCs");
+  id.prol      = tl["stagen"]->AddTask(&Hydro::Prolongate, this, id.bcs,
+                                       "Hydro::Prolongate");
+  id.c2p       = tl["stagen"]->AddTask(&Hydro::ConToPrim, this, id.prol,
+                                       "Hydro::ConToPrim");
+  id.newdt     = tl["stagen"]->AddTask(&Hydro::NewTimeStep, this, id.c2p,
+                                       "Hydro::NewTimeStep");
 
   // assemble "after_stagen" task list
-  id.csend = tl["after_stagen"]->AddTask(&Hydro::ClearSend, this, none);
+  id.csend = tl["after_stagen"]->AddTask(&Hydro::ClearSend, this, none,
+                                         "Hydro::ClearSend");
   // although RecvFlux/U functions check that all recvs complete, add ClearRecv to
   // task list anyways to catch potential bugs in MPI communication logic
-  id.crecv = tl["after_stagen"]->AddTask(&Hydro::ClearRecv, this, id.csend);
+  id.crecv = tl["after_stagen"]->AddTask(&Hydro::ClearRecv, this, id.csend,
+                                         "Hydro::ClearRecv");
 
   return;
 }
@@ -157,28 +213,9 @@ TaskStatus Hydro::CopyCons(Driver *pdrive, int stage) {
 //! of conserved variables
 
 TaskStatus Hydro::Fluxes(Driver *pdrive, int stage) {
-  // select which calculate_flux function to call based on rsolver_method
-  if (rsolver_method == Hydro_RSolver::advect) {
-    CalculateFluxes<Hydro_RSolver::advect>(pdrive, stage);
-  } else if (rsolver_method == Hydro_RSolver::llf) {
-    CalculateFluxes<Hydro_RSolver::llf>(pdrive, stage);
-  } else if (rsolver_method == Hydro_RSolver::hlle) {
-    CalculateFluxes<Hydro_RSolver::hlle>(pdrive, stage);
-  } else if (rsolver_method == Hydro_RSolver::hllc) {
-    CalculateFluxes<Hydro_RSolver::hllc>(pdrive, stage);
-  } else if (rsolver_method == Hydro_RSolver::roe) {
-    CalculateFluxes<Hydro_RSolver::roe>(pdrive, stage);
-  } else if (rsolver_method == Hydro_RSolver::llf_sr) {
-    CalculateFluxes<Hydro_RSolver::llf_sr>(pdrive, stage);
-  } else if (rsolver_method == Hydro_RSolver::hlle_sr) {
-    CalculateFluxes<Hydro_RSolver::hlle_sr>(pdrive, stage);
-  } else if (rsolver_method == Hydro_RSolver::hllc_sr) {
-    CalculateFluxes<Hydro_RSolver::hllc_sr>(pdrive, stage);
-  } else if (rsolver_method == Hydro_RSolver::llf_gr) {
-    CalculateFluxes<Hydro_RSolver::llf_gr>(pdrive, stage);
-  } else if (rsolver_method == Hydro_RSolver::hlle_gr) {
-    CalculateFluxes<Hydro_RSolver::hlle_gr>(pdrive, stage);
-  }
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  CellRange active = {indcs.is, indcs.ie, indcs.js, indcs.je, indcs.ks, indcs.ke};
+  FluxesOverRange(pdrive, stage, active);
 
   // Add diffusion fluxes
   if (pcond != nullptr) {
@@ -200,6 +237,85 @@ TaskStatus Hydro::Fluxes(Driver *pdrive, int stage) {
   return TaskStatus::complete;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void Hydro::FluxesOverRange
+//! \brief Calls CalculateFluxes function appropriate to rsolver_method over all faces of
+//! cells in range rng
+
+void Hydro::FluxesOverRange(Driver *pdrive, int stage, const CellRange &rng) {
+  // select which calculate_flux function to call based on rsolver_method
+  if (rsolver_method == Hydro_RSolver::advect) {
+    CalculateFluxes<Hydro_RSolver::advect>(pdrive, stage, rng);
+  } else if (rsolver_method == Hydro_RSolver::llf) {
+    CalculateFluxes<Hydro_RSolver::llf>(pdrive, stage, rng);
+  } else if (rsolver_method == Hydro_RSolver::hlle) {
+    CalculateFluxes<Hydro_RSolver::hlle>(pdrive, stage, rng);
+  } else if (rsolver_method == Hydro_RSolver::hllc) {
+    CalculateFluxes<Hydro_RSolver::hllc>(pdrive, stage, rng);
+  } else if (rsolver_method == Hydro_RSolver::roe) {
+    CalculateFluxes<Hydro_RSolver::roe>(pdrive, stage, rng);
+  } else if (rsolver_method == Hydro_RSolver::llf_sr) {
+    CalculateFluxes<Hydro_RSolver::llf_sr>(pdrive, stage, rng);
+  } else if (rsolver_method == Hydro_RSolver::hlle_sr) {
+    CalculateFluxes<Hydro_RSolver::hlle_sr>(pdrive, stage, rng);
+  } else if (rsolver_method == Hydro_RSolver::hllc_sr) {
+    CalculateFluxes<Hydro_RSolver::hllc_sr>(pdrive, stage, rng);
+  } else if (rsolver_method == Hydro_RSolver::llf_gr) {
+    CalculateFluxes<Hydro_RSolver::llf_gr>(pdrive, stage, rng);
+  } else if (rsolver_method == Hydro_RSolver::hlle_gr) {
+    CalculateFluxes<Hydro_RSolver::hlle_gr>(pdrive, stage, rng);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus Hydro::FluxesShell
+//! \brief Wrapper task list function used with split-phase updates that computes fluxes
+//! of conserved variables for active cells within ng cells of MeshBlock faces
+
+TaskStatus Hydro::FluxesShell(Driver *pdrive, int stage) {
+  for (auto &rng : shell_rng) {
+    FluxesOverRange(pdrive, stage, rng);
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus Hydro::FluxesInterior
+//! \brief Wrapper task list function used with split-phase updates that computes fluxes
+//! of conserved variables for interior active cells (not in shell)
+
+TaskStatus Hydro::FluxesInterior(Driver *pdrive, int stage) {
+  if (!(interior_rng.IsEmpty())) {
+    FluxesOverRange(pdrive, stage, interior_rng);
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus Hydro::RKUpdateShell
+//! \brief Wrapper task list function used with split-phase updates that performs RK
+//! update of active cells within ng cells of MeshBlock faces
+
+TaskStatus Hydro::RKUpdateShell(Driver *pdrive, int stage) {
+  for (auto &rng : shell_rng) {
+    RKUpdateOverRange(pdrive, stage, rng);
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus Hydro::RKUpdateInterior
+//! \brief Wrapper task list function used with split-phase updates that performs RK
+//! update of interior active cells (not in shell)
+
+TaskStatus Hydro::RKUpdateInterior(Driver *pdrive, int stage) {
+  if (!(interior_rng.IsEmpty())) {
+    RKUpdateOverRange(pdrive, stage, interior_rng);
+  }
+  return TaskStatus::complete;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn TaskList Hydro::SendFlux
 //! \brief Wrapper task list function to pack/send restricted values of fluxes of
@@ -401,6 +517,30 @@ TaskStatus Hydro::ConToPrim(Driver *pdrive, int stage) {
   return TaskStatus::complete;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn TaskList Hydro::ConToPrimActive
+//! \brief Wrapper task list function used with split-phase updates to call ConsToPrim
+//! over active cells, while boundary communications are in flight
+
+TaskStatus Hydro::ConToPrimActive(Driver *pdrive, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  peos->ConsToPrim(u0, w0, false, indcs.is, indcs.ie, indcs.js, indcs.je,
+                   indcs.ks, indcs.ke);
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskList Hydro::ConToPrimGhost
+//! \brief Wrapper task list function used with split-phase updates to call ConsToPrim
+//! over ghost cells, after boundary values have been received and set
+
+TaskStatus Hydro::ConToPrimGhost(Driver *pdrive, int stage) {
+  for (auto &rng : ghost_rng) {
+    peos->ConsToPrim(u0, w0, false, rng.il, rng.iu, rng.jl, rng.ju, rng.kl, rng.ku);
+  }
+  return TaskStatus::complete;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn TaskList Hydro::ClearSend
 //! \brief Wrapper task list function that checks all MPI sends have completed. Used in
@@ -21,10 +21,24 @@ namespace hydro {
 //  \brief Explicit RK update including flux divergence terms
 
 TaskStatus Hydro::RKUpdate(Driver *pdriver, int stage) {
+  // with fused update, u0 has already been updated in Fluxes()
+  if (fused_update) return TaskStatus::complete;
   auto &indcs = pmy_pack->pmesh->mb_indcs;
-  int is = indcs.is, ie = indcs.ie;
-  int js = indcs.js, je = indcs.je;
-  int ks = indcs.ks, ke = indcs.ke;
+  CellRange active = {indcs.is, indcs.ie, indcs.js, indcs.je, indcs.ks, indcs.ke};
+  RKUpdateOverRange(pdriver, stage, active);
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void Hydro::RKUpdateOverRange
+//  \brief Explicit RK update including flux divergence terms over cells in range rng.
+//  Called over separate parts of each MeshBlock with split-phase updates.
+
+void Hydro::RKUpdateOverRange(Driver *pdriver, int stage, const CellRange &rng) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = rng.il, ie = rng.iu;
+  int js = rng.jl, je = rng.ju;
+  int ks = rng.kl, ke = rng.ku;
   int ncells1 = indcs.nx1 + 2*(indcs.ng);
   bool &multi_d = pmy_pack->pmesh->multi_d;
   bool &three_d = pmy_pack->pmesh->three_d;
@@ -79,6 +93,6 @@ TaskStatus Hydro::RKUpdate(Driver *pdriver, int stage) {
       u0_(m,n,k,j,i) = gam0*u0_(m,n,k,j,i) + gam1*u1_(m,n,k,j,i) - beta_dt*divf(i);
     });
   });
-  return TaskStatus::complete;
+  return;
 }
 } // namespace hydro
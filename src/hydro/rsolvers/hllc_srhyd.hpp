@@ -23,11 +23,12 @@ namespace hydro {
 //! \brief The HLLC Riemann solver for SR hydrodynamics.  Based on HLLCTransforming()
 //! function in Athena++ (C++ version)
 
+template <typename FlxArray>
 KOKKOS_INLINE_FUNCTION
 void HLLC_SR(TeamMember_t const &member, const EOS_Data &eos,
      const RegionIndcs &indcs,const DualArray1D<RegionSize> &size,const CoordData &coord,
      const int m, const int k, const int j, const int il, const int iu, const int ivx,
-     const ScrArray2D<Real> &wl, const ScrArray2D<Real> &wr, DvceArray5D<Real> flx) {
+     const ScrArray2D<Real> &wl, const ScrArray2D<Real> &wr, FlxArray flx) {
   int ivy = IVX + ((ivx-IVX)+1)%3;
   int ivz = IVX + ((ivx-IVX)+2)%3;
   const Real gamma_prime = eos.gamma/(eos.gamma - 1.0);
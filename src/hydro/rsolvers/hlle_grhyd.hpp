@@ -22,17 +22,22 @@ namespace hydro {
 //! \fn void HLLE_GR
 //! \brief HLLE for GR hydrodynamics
 
+template <typename FlxArray>
 KOKKOS_INLINE_FUNCTION
 void HLLE_GR(TeamMember_t const &member, const EOS_Data &eos,
      const RegionIndcs &indcs,const DualArray1D<RegionSize> &size,const CoordData &coord,
      const int m, const int k, const int j, const int il, const int iu, const int ivx,
-     const ScrArray2D<Real> &wl, const ScrArray2D<Real> &wr, DvceArray5D<Real> flx) {
+     const ScrArray2D<Real> &wl, const ScrArray2D<Real> &wr, FlxArray flx) {
   int ivy = IVX + ((ivx-IVX)+1)%3;
   int ivz = IVX + ((ivx-IVX)+2)%3;
   const Real gamma_prime = eos.gamma/(eos.gamma - 1.0);
   auto &flat = coord.is_minkowski;
   auto &spin = coord.bh_spin;
 
+  // cached metric at faces normal to direction ivx (only used if coord.metric_cache)
+  const DvceArray5D<Real> &gfc = (ivx == IVX)? coord.gfc.x1f :
+                                 ((ivx == IVY)? coord.gfc.x2f : coord.gfc.x3f);
+
   int is = indcs.is;
   int js = indcs.js;
   int ks = indcs.ks;
@@ -75,7 +80,11 @@ void HLLE_GR(TeamMember_t const &member, const EOS_Data &eos,
       x3v = LeftEdgeX  (k-ks, indcs.nx3, x3min, x3max);
     }
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (coord.metric_cache) {
+      CachedMetricAndInverse(gfc, m, k, j, i, glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Calculate 4-velocity in left state (contravariant compt)
     Real q = glower[ivx][ivx] * SQR(wl_ivx) + glower[ivy][ivy] * SQR(wl_ivy) +
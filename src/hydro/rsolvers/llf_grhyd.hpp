@@ -8,6 +8,7 @@
 //! \file llf_grhyd.hpp
 //! \brief LLF Riemann solver for general relativistic hydrodynamics.
 
+#include "coordinates/cartesian_ks.hpp"
 #include "coordinates/cell_locations.hpp"
 #include "llf_hyd_singlestate.hpp"
 
@@ -16,15 +17,20 @@ namespace hydro {
 //! \fn void LLF_GR
 //! \brief The LLF Riemann solver for GR hydrodynamics
 
+template <typename FlxArray>
 KOKKOS_INLINE_FUNCTION
 void LLF_GR(TeamMember_t const &member, const EOS_Data &eos,
      const RegionIndcs &indcs,const DualArray1D<RegionSize> &size,const CoordData &coord,
      const int m, const int k, const int j, const int il, const int iu, const int ivx,
-     const ScrArray2D<Real> &wl, const ScrArray2D<Real> &wr, DvceArray5D<Real> flx) {
+     const ScrArray2D<Real> &wl, const ScrArray2D<Real> &wr, FlxArray flx) {
   // Cyclic permutation of array indices
   int ivy = IVX + ((ivx-IVX)+1)%3;
   int ivz = IVX + ((ivx-IVX)+2)%3;
 
+  // cached metric at faces normal to direction ivx (only used if coord.metric_cache)
+  const DvceArray5D<Real> &gfc = (ivx == IVX)? coord.gfc.x1f :
+                                 ((ivx == IVY)? coord.gfc.x2f : coord.gfc.x3f);
+
   int is = indcs.is;
   int js = indcs.js;
   int ks = indcs.ks;
@@ -50,6 +56,13 @@ void LLF_GR(TeamMember_t const &member, const EOS_Data &eos,
       x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
       x3v = LeftEdgeX  (k-ks, indcs.nx3, x3min, x3max);
     }
+    Real glower[4][4], gupper[4][4];
+    if (coord.metric_cache) {
+      CachedMetricAndInverse(gfc, m, k, j, i, glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, coord.is_minkowski, coord.bh_spin,
+                              glower, gupper);
+    }
 
     // Extract left/right primitives.
     HydPrim1D wli,wri;
@@ -67,7 +80,7 @@ void LLF_GR(TeamMember_t const &member, const EOS_Data &eos,
 
     // Call LLF solver on single interface state
     HydCons1D flux;
-    SingleStateLLF_GRHyd(wli, wri, x1v, x2v, x3v, ivx, coord, eos, flux);
+    SingleStateLLF_GRHyd(wli, wri, glower, gupper, ivx, eos, flux);
 
     // Store results in 3D array of fluxes
     flx(m,IDN,k,j,i) = flux.d;
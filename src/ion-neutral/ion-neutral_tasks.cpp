@@ -36,54 +36,72 @@ void IonNeutral::AssembleIonNeutralTasks(
   Hydro *phyd = pmy_pack->phydro;
 
   // assemble "before_stagen_tl" task list
-  id.i_irecv = tl["before_stagen"]->AddTask(&MHD::InitRecv, pmhd, none);
-  id.n_irecv = tl["before_stagen"]->AddTask(&Hydro::InitRecv, phyd, none);
+  id.i_irecv = tl["before_stagen"]->AddTask(&MHD::InitRecv, pmhd, none, "MHD::InitRecv");
+  id.n_irecv = tl["before_stagen"]->AddTask(&Hydro::InitRecv, phyd, none,
+                                            "Hydro::InitRecv");
 
   // assemble "stagen_tl" task list
   // FirstTwoImpRK task does CopyCons
-  id.impl_2x = tl["stagen"]->AddTask(&IonNeutral::FirstTwoImpRK, this, none);
-
-  id.i_flux   = tl["stagen"]->AddTask(&MHD::Fluxes, pmhd, id.impl_2x);
-  id.i_sendf  = tl["stagen"]->AddTask(&MHD::SendFlux, pmhd, id.i_flux);
-  id.i_recvf  = tl["stagen"]->AddTask(&MHD::RecvFlux, pmhd, id.i_sendf);
-  id.i_rkupdt = tl["stagen"]->AddTask(&MHD::RKUpdate, pmhd, id.i_recvf);
-  id.i_srctrms   = tl["stagen"]->AddTask(&MHD::MHDSrcTerms, pmhd, id.i_rkupdt);
-
-  id.n_flux   = tl["stagen"]->AddTask(&Hydro::Fluxes, phyd, id.i_srctrms);
-  id.n_sendf  = tl["stagen"]->AddTask(&Hydro::SendFlux, phyd, id.n_flux);
-  id.n_recvf  = tl["stagen"]->AddTask(&Hydro::RecvFlux, phyd, id.n_sendf);
-  id.n_rkupdt = tl["stagen"]->AddTask(&Hydro::RKUpdate, phyd, id.n_recvf);
-  id.n_srctrms   = tl["stagen"]->AddTask(&Hydro::HydroSrcTerms, phyd, id.n_rkupdt);
-
-  id.impl     = tl["stagen"]->AddTask(&IonNeutral::ImpRKUpdate, this, id.n_srctrms);
-  id.i_restu  = tl["stagen"]->AddTask(&MHD::RestrictU, pmhd, id.impl);
-  id.n_restu  = tl["stagen"]->AddTask(&Hydro::RestrictU, phyd, id.i_restu);
-
-  id.i_sendu  = tl["stagen"]->AddTask(&MHD::SendU, pmhd, id.n_restu);
-  id.n_sendu  = tl["stagen"]->AddTask(&Hydro::SendU, phyd, id.n_restu);
-  id.i_recvu  = tl["stagen"]->AddTask(&MHD::RecvU, pmhd, id.i_sendu);
-  id.n_recvu  = tl["stagen"]->AddTask(&Hydro::RecvU, phyd, id.n_sendu);
-
-  id.efld     = tl["stagen"]->AddTask(&MHD::CornerE, pmhd, id.i_recvu);
-  id.sende    = tl["stagen"]->AddTask(&MHD::SendE, pmhd, id.efld);
-  id.recve    = tl["stagen"]->AddTask(&MHD::RecvE, pmhd, id.sende);
-  id.ct       = tl["stagen"]->AddTask(&MHD::CT, pmhd, id.recve);
-  id.restb    = tl["stagen"]->AddTask(&MHD::RestrictB, pmhd, id.ct);
-  id.sendb    = tl["stagen"]->AddTask(&MHD::SendB, pmhd, id.restb);
-  id.recvb    = tl["stagen"]->AddTask(&MHD::RecvB, pmhd, id.sendb);
-
-  id.i_bcs    = tl["stagen"]->AddTask(&MHD::ApplyPhysicalBCs, pmhd, id.recvb);
-  id.n_bcs    = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, phyd, id.n_recvu);
-  id.i_prol   = tl["stagen"]->AddTask(&MHD::Prolongate, pmhd, id.i_bcs);
-  id.n_prol   = tl["stagen"]->AddTask(&Hydro::Prolongate, phyd, id.n_bcs);
-  id.i_c2p    = tl["stagen"]->AddTask(&MHD::ConToPrim, pmhd, id.i_prol);
-  id.n_c2p    = tl["stagen"]->AddTask(&Hydro::ConToPrim, phyd, id.n_prol);
-  id.i_newdt  = tl["stagen"]->AddTask(&MHD::NewTimeStep, pmhd, id.i_c2p);
-  id.n_newdt  = tl["stagen"]->AddTask(&Hydro::NewTimeStep, phyd, id.n_c2p);
+  id.impl_2x = tl["stagen"]->AddTask(&IonNeutral::FirstTwoImpRK, this, none,
+                                     "IonNeutral::FirstTwoImpRK");
+
+  id.i_flux   = tl["stagen"]->AddTask(&MHD::Fluxes, pmhd, id.impl_2x, "MHD::Fluxes");
+  id.i_sendf  = tl["stagen"]->AddTask(&MHD::SendFlux, pmhd, id.i_flux, "MHD::SendFlux");
+  id.i_recvf  = tl["stagen"]->AddTask(&MHD::RecvFlux, pmhd, id.i_sendf, "MHD::RecvFlux");
+  id.i_rkupdt = tl["stagen"]->AddTask(&MHD::RKUpdate, pmhd, id.i_recvf, "MHD::RKUpdate");
+  id.i_srctrms   = tl["stagen"]->AddTask(&MHD::MHDSrcTerms, pmhd, id.i_rkupdt,
+                                         "MHD::MHDSrcTerms");
+
+  id.n_flux   = tl["stagen"]->AddTask(&Hydro::Fluxes, phyd, id.i_srctrms,
+                                      "Hydro::Fluxes");
+  id.n_sendf  = tl["stagen"]->AddTask(&Hydro::SendFlux, phyd, id.n_flux,
+                                      "Hydro::SendFlux");
+  id.n_recvf  = tl["stagen"]->AddTask(&Hydro::RecvFlux, phyd, id.n_sendf,
+                                      "Hydro::RecvFlux");
+  id.n_rkupdt = tl["stagen"]->AddTask(&Hydro::RKUpdate, phyd, id.n_recvf,
+                                      "Hydro::RKUpdate");
+  id.n_srctrms   = tl["stagen"]->AddTask(&Hydro::HydroSrcTerms, phyd, id.n_rkupdt,
+                                         "Hydro::HydroSrcTerms");
+
+  id.impl     = tl["stagen"]->AddTask(&IonNeutral::ImpRKUpdate, this, id.n_srctrms,
+                                      "IonNeutral::ImpRKUpdate");
+  id.i_restu  = tl["stagen"]->AddTask(&MHD::RestrictU, pmhd, id.impl, "MHD::RestrictU");
+  id.n_restu  = tl["stagen"]->AddTask(&Hydro::RestrictU, phyd, id.i_restu,
+                                      "Hydro::RestrictU");
+
+  id.i_sendu  = tl["stagen"]->AddTask(&MHD::SendU, pmhd, id.n_restu, "MHD::SendU");
+  id.n_sendu  = tl["stagen"]->AddTask(&Hydro::SendU, phyd, id.n_restu, "Hydro::SendU");
+  id.i_recvu  = tl["stagen"]->AddTask(&MHD::RecvU, pmhd, id.i_sendu, "MHD::RecvU");
+  id.n_recvu  = tl["stagen"]->AddTask(&Hydro::RecvU, phyd, id.n_sendu, "Hydro::RecvU");
+
+  id.efld     = tl["stagen"]->AddTask(&MHD::CornerE, pmhd, id.i_recvu, "MHD::CornerE");
+  id.sende    = tl["stagen"]->AddTask(&MHD::SendE, pmhd, id.efld, "MHD::SendE");
+  id.recve    = tl["stagen"]->AddTask(&MHD::RecvE, pmhd, id.sende, "MHD::RecvE");
+  id.ct       = tl["stagen"]->AddTask(&MHD::CT, pmhd, id.recve, "MHD::CT");
+  id.restb    = tl["stagen"]->AddTask(&MHD::RestrictB, pmhd, id.ct, "MHD::RestrictB");
+  id.sendb    = tl["stagen"]->AddTask(&MHD::SendB, pmhd, id.restb, "MHD::SendB");
+  id.recvb    = tl["stagen"]->AddTask(&MHD::RecvB, pmhd, id.sendb, "MHD::RecvB");
+
+  id.i_bcs    = tl["stagen"]->AddTask(&MHD::ApplyPhysicalBCs, pmhd, id.recvb,
+                                      "MHD::ApplyPhysicalBCs");
+  id.n_bcs    = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, phyd, id.n_recvu,
+                                      "Hydro::ApplyPhysicalBCs");
+  id.i_prol   = tl["stagen"]->AddTask(&MHD::Prolongate, pmhd, id.i_bcs,
+                                      "MHD::Prolongate");
+  id.n_prol   = tl["stagen"]->AddTask(&Hydro::Prolongate, phyd, id.n_bcs,
+                                      "Hydro::Prolongate");
+  id.i_c2p    = tl["stagen"]->AddTask(&MHD::ConToPrim, pmhd, id.i_prol, "MHD::ConToPrim");
+  id.n_c2p    = tl["stagen"]->AddTask(&Hydro::ConToPrim, phyd, id.n_prol,
+                                      "Hydro::ConToPrim");
+  id.i_newdt  = tl["stagen"]->AddTask(&MHD::NewTimeStep, pmhd, id.i_c2p,
+                                      "MHD::NewTimeStep");
+  id.n_newdt  = tl["stagen"]->AddTask(&Hydro::NewTimeStep, phyd, id.n_c2p,
+                                      "Hydro::NewTimeStep");
 
   // assemble "after_stagen_tl" task list
-  id.i_clear = tl["after_stagen"]->AddTask(&MHD::ClearSend, pmhd, none);
-  id.n_clear = tl["after_stagen"]->AddTask(&Hydro::ClearSend, phyd, none);
+  id.i_clear = tl["after_stagen"]->AddTask(&MHD::ClearSend, pmhd, none, "MHD::ClearSend");
+  id.n_clear = tl["after_stagen"]->AddTask(&Hydro::ClearSend, phyd, none,
+                                           "Hydro::ClearSend");
 
   return;
 }
@@ -29,6 +29,7 @@
 #include <string>
 #include <memory>
 #include <cstdio> // sscanf
+#include <cstring> // strcmp
 #include <fstream>  // Include this for std::ifstream
 
 // Athena headers
@@ -38,6 +39,7 @@
 #include "mesh/mesh.hpp"
 #include "mesh/mesh_refinement.hpp"
 #include "outputs/outputs.hpp"
+#include "outputs/restart_redistribute.hpp"
 #include "driver/driver.hpp"
 #include "utils/utils.hpp"
 
@@ -92,7 +94,16 @@ int main(int argc, char *argv[]) {
     return(0);
   }
 #else  // no OpenMP
-  if (MPI_SUCCESS != MPI_Init(&argc, &argv)) {
+  // Only the main thread calls MPI, unless the -a option is given, in which case
+  // MPI_THREAD_MULTIPLE is requested for the I/O thread used by asynchronous outputs
+  // (which checks the level actually provided).  It is not requested by default, since
+  // with some MPI libraries it selects slower (thread-safe) communication paths.
+  int mpireq = MPI_THREAD_FUNNELED;
+  for (int i=1; i<argc; i++) {
+    if (std::strcmp(argv[i], "-a") == 0) {mpireq = MPI_THREAD_MULTIPLE;}
+  }
+  int mpiprv;
+  if (MPI_SUCCESS != MPI_Init_thread(&argc, &argv, mpireq, &mpiprv)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
               << "MPI Initialization failed." << std::endl;
     return(0);
@@ -129,6 +140,7 @@ int main(int argc, char *argv[]) {
       // check that command line options that require arguments actually have them:
       char opt_letter = *(argv[i]+1);
       switch(opt_letter) {
+        case 'a':
         case 'c':
         case 'h':
         case 'm':
@@ -166,6 +178,8 @@ int main(int argc, char *argv[]) {
         case 'n':
           narg_flag = true;
           break;
+        case 'a':                      // MPI_THREAD_MULTIPLE requested during MPI init
+          break;
         case 'm':
           marg_flag = true;
           break;
@@ -196,6 +210,7 @@ int main(int argc, char *argv[]) {
             std::cout << "  -c              show configuration and quit\n";
             std::cout << "  -m              output mesh structure and quit\n";
             std::cout << "  -t hh:mm:ss     wall time limit for final output\n";
+            std::cout << "  -a              enable asynchronous outputs with MPI\n";
             std::cout << "  -h              this help\n";
             ShowConfig();
           }
@@ -234,22 +249,31 @@ int main(int argc, char *argv[]) {
   IOWrapper infile, restartfile;
   // read parameters from restart file
   bool single_file_per_rank = false; // DBF: flag for single_file_per_rank for rst files
+  int nrst_files = 0;                // number of per-rank restart files
   if (res_flag) {
+    // A checkpoint manifest selects the newest checkpoint drained from local_dir
+    const std::string manifest_ext = ".manifest";
+    if (restart_file.size() > manifest_ext.size() &&
+        restart_file.compare(restart_file.size() - manifest_ext.size(),
+                             manifest_ext.size(), manifest_ext) == 0) {
+      restart_file = LatestCheckpoint(restart_file);
+      if (global_variable::my_rank == 0) {
+        std::cout << "Restarting from newest complete checkpoint " << restart_file
+                  << std::endl;
+      }
+    }
+
     // Check if the path contains "rank_" directory
     size_t rank_pos = restart_file.find("/rank_");
     single_file_per_rank = (rank_pos != std::string::npos);
 
-    // If single_file_per_rank is true, modify the path for the current rank
+    // If single_file_per_rank is true, modify the path for the current rank.  Files may
+    // have been written by a different number of ranks, in which case header data is
+    // read from any file, and MeshBlock data is redistributed in ProblemGenerator
     if (single_file_per_rank) {
-        // Extract the base directory and file name
-        size_t last_slash = restart_file.rfind('/');
-        std::string base_dir = restart_file.substr(0, rank_pos);
-        std::string file_name = restart_file.substr(last_slash + 1);
-
-        // Construct the path for the current rank
-        char rank_dir[20];
-        std::snprintf(rank_dir, sizeof(rank_dir), "rank_%08d", global_variable::my_rank);
-        restart_file = base_dir + "/" + rank_dir + "/" + file_name;
+      nrst_files = restart_redistribute::CountRankFiles(restart_file);
+      int file_rank = global_variable::my_rank % nrst_files;
+      restart_file = restart_redistribute::RankFileName(restart_file, file_rank);
     }
 
     // Now use restart_file for opening the file
@@ -325,13 +349,16 @@ int main(int argc, char *argv[]) {
     pmesh->pgen = std::make_unique<ProblemGenerator>(pinput,
                                                      pmesh,
                                                      restartfile,
-                                                     single_file_per_rank);
+                                                     single_file_per_rank,
+                                                     restart_file,
+                                                     nrst_files);
     restartfile.Close(single_file_per_rank);
   }
 
   // Construct MeshRefinement object only after physics modules have been added because
-  // size of buffers for load balancing, refinement criteria, etc. depend on physics
-  if (pmesh->multilevel) {
+  // size of buffers for load balancing, refinement criteria, etc. depend on physics.
+  // Also needed on uniform meshes to redistribute MeshBlocks with dynamic load balancing
+  if (pmesh->multilevel || (pmesh->mbcost.threshold > 0.0)) {
     pmesh->pmr = new MeshRefinement(pmesh, pinput);
   }
 
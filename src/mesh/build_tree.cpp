@@ -239,8 +239,9 @@ void Mesh::BuildTreeFromScratch(ParameterInput *pin) {
   gids_eachrank = new int[global_variable::nranks];
   nmb_eachrank = new int[global_variable::nranks];
 
-  // following returns LogicalLocation list sorted by Z-ordering, and total # of MBs
-  ptree->CreateZOrderedLLList(lloc_eachmb, nullptr, nmb_total);
+  // following returns LogicalLocation list sorted by Z- (or Hilbert) ordering, and total
+  // # of MBs
+  ptree->CreateOrderedLLList(lloc_eachmb, nullptr, nmb_total);
 
 #if MPI_PARALLEL_ENABLED
   // check there is at least one MeshBlock per MPI rank
@@ -252,8 +253,8 @@ void Mesh::BuildTreeFromScratch(ParameterInput *pin) {
   }
 #endif
 
-  // initialize cost array with the simplest estimate; all the blocks are equal
-  // TODO(@user): implement variable cost per MeshBlock as needed
+  // initialize cost array with the simplest estimate; all the blocks are equal.
+  // Measured costs (if requested) are set in UpdateMeasuredCost() during the run.
   for (int i=0; i<nmb_total; i++) {cost_eachmb[i] = 1.0;}
   LoadBalance(cost_eachmb, rank_eachmb, gids_eachrank, nmb_eachrank, nmb_total);
 
@@ -267,9 +268,9 @@ void Mesh::BuildTreeFromScratch(ParameterInput *pin) {
   pmb_pack->AddMeshBlocks(pin);
   pmb_pack->pmb->SetNeighbors(ptree, rank_eachmb);
 
-  // Fix maximum number of MeshBlocks per rank with AMR
+  // Fix maximum number of MeshBlocks per rank with AMR or dynamic load balancing
   nmb_maxperrank = nmb_thisrank;
-  if (adaptive) {
+  if (adaptive || (mbcost.threshold > 0.0)) {
     if (pin->DoesParameterExist("mesh_refinement", "max_nmb_per_rank")) {
       nmb_maxperrank = pin->GetReal("mesh_refinement", "max_nmb_per_rank");
       if (nmb_maxperrank < nmb_thisrank) {
@@ -281,12 +282,17 @@ void Mesh::BuildTreeFromScratch(ParameterInput *pin) {
       }
     } else {
       std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-        << std::endl << "With AMR maximum number of MeshBlocks per rank must be "
-        << "specified in input file using <mesh_refinement>/max_nmb_per_rank"
-        << std::endl;
+        << std::endl << "With AMR or dynamic load balancing maximum number of "
+        << "MeshBlocks per rank must be specified in input file using "
+        << "<mesh_refinement>/max_nmb_per_rank" << std::endl;
       std::exit(EXIT_FAILURE);
     }
   }
+  // allocate work counters used to measure cost of each MeshBlock
+  if (mbcost.measured) {
+    Kokkos::realloc(mbcost.work, nmb_maxperrank, NWORK);
+    Kokkos::deep_copy(mbcost.work, 0);
+  }
 #if MPI_PARALLEL_ENABLED
   if (nmb_maxperrank > (1 << (NUM_BITS_LID))) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
@@ -438,13 +444,30 @@ void Mesh::BuildTreeFromRestart(ParameterInput *pin, IOWrapper &resfile,
   // number read from the restart file.
   {
     int nnb;
-    ptree->CreateZOrderedLLList(lloc_eachmb, nullptr, nnb);
+    ptree->CountMeshBlocks(nnb);
     if (nnb != nmb_total) {
       std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
         << std::endl << "Tree reconstruction failed. Total number of blocks in "
         << "reconstructed tree=" << nnb << ", number in file=" << nmb_total << std::endl;
       std::exit(EXIT_FAILURE);
     }
+    // data in restart file is stored in gid order, so MeshBlocks must be ordered along
+    // the same space-filling curve as when the file was written
+    LogicalLocation *newlist = new LogicalLocation[nmb_total];
+    ptree->CreateOrderedLLList(newlist, nullptr, nnb);
+    for (int i=0; i<nmb_total; i++) {
+      if ((newlist[i].lx1 != lloc_eachmb[i].lx1) ||
+          (newlist[i].lx2 != lloc_eachmb[i].lx2) ||
+          (newlist[i].lx3 != lloc_eachmb[i].lx3) ||
+          (newlist[i].level != lloc_eachmb[i].level)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "Order of MeshBlocks in restart file differs from that in "
+          << "reconstructed tree. Check <mesh>/sfc_ordering is same as in original run"
+          << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+    delete [] newlist;
   }
 
 #ifdef MPI_PARALLEL_ENABLED
@@ -471,9 +494,9 @@ void Mesh::BuildTreeFromRestart(ParameterInput *pin, IOWrapper &resfile,
   pmb_pack->AddMeshBlocks(pin);
   pmb_pack->pmb->SetNeighbors(ptree, rank_eachmb);
 
-  // Fix maximum number of MeshBlocks per rank with AMR
+  // Fix maximum number of MeshBlocks per rank with AMR or dynamic load balancing
   nmb_maxperrank = nmb_thisrank;
-  if (adaptive) {
+  if (adaptive || (mbcost.threshold > 0.0)) {
     if (pin->DoesParameterExist("mesh_refinement", "max_nmb_per_rank")) {
       nmb_maxperrank = pin->GetReal("mesh_refinement", "max_nmb_per_rank");
       if (nmb_maxperrank < nmb_thisrank) {
@@ -485,12 +508,17 @@ void Mesh::BuildTreeFromRestart(ParameterInput *pin, IOWrapper &resfile,
       }
     } else {
       std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-        << std::endl << "With AMR maximum number of MeshBlocks per rank must be "
-        << "specified in input file using <mesh_refinement>/max_nmb_per_rank"
-        << std::endl;
+        << std::endl << "With AMR or dynamic load balancing maximum number of "
+        << "MeshBlocks per rank must be specified in input file using "
+        << "<mesh_refinement>/max_nmb_per_rank" << std::endl;
       std::exit(EXIT_FAILURE);
     }
   }
+  // allocate work counters used to measure cost of each MeshBlock
+  if (mbcost.measured) {
+    Kokkos::realloc(mbcost.work, nmb_maxperrank, NWORK);
+    Kokkos::deep_copy(mbcost.work, 0);
+  }
 
   // set remaining parameters, output diagnostics
   cfl_no = pin->GetReal("time", "cfl_number");
@@ -11,6 +11,7 @@
 #include <limits> // numeric_limits<>
 #include <algorithm> // max
 #include <utility> // make_pair
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -19,6 +20,7 @@
 #include "mhd/mhd.hpp"
 #include "radiation/radiation.hpp"
 #include "z4c/z4c.hpp"
+#include "particles/particles.hpp"
 
 #if MPI_PARALLEL_ENABLED
 #include <mpi.h>
@@ -32,10 +34,12 @@
 //! output: rlist = rank to which each MB is assigned (array of length nmbtotal)
 //!         slist = starting grid ID (gid) for MB on each rank (array of length nrank)
 //!         nlist = number of MBs on each rank (array of length nrank)
+//! warn = print warning if MBs cannot be divided evenly between ranks
 //! With multiple ranks in MPI, this function is needed even on a uniform mesh and not
 //! just for SMR/AMR, which is why it is part of the Mesh and not MeshRefinement class.
 
-void Mesh::LoadBalance(float *clist, int *rlist, int *slist, int *nlist, int nb) {
+void Mesh::LoadBalance(float *clist, int *rlist, int *slist, int *nlist, int nb,
+                       bool warn) {
   float min_cost = std::numeric_limits<float>::max();
   float max_cost = 0.0, totalcost = 0.0;
   // find min/max and total cost in clist
@@ -77,7 +81,7 @@ void Mesh::LoadBalance(float *clist, int *rlist, int *slist, int *nlist, int nb)
   nlist[j] = nb-slist[j];
 
 #if MPI_PARALLEL_ENABLED
-  if (nb % global_variable::nranks != 0
+  if (warn && nb % global_variable::nranks != 0
      && !adaptive && max_cost == min_cost && global_variable::my_rank == 0) {
     std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
               << "Number of MeshBlocks cannot be divided evenly by number of MPI ranks. "
@@ -87,6 +91,127 @@ void Mesh::LoadBalance(float *clist, int *rlist, int *slist, int *nlist, int nb)
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void Mesh::UpdateMeasuredCost()
+//! \brief Sets cost of each MeshBlock from work counters accumulated over the previous
+//! <load_balancing>/ncycle_measure cycles (or since MBs were last redistributed, since
+//! counters are reset in RedistAndRefineMeshBlocks).  The cost of each MB is measured
+//! relative to the update of all of its cells (cost=1), plus weighted contributions from
+//! the average number of c2p iterations and FOFC cells per cell per cycle, and the number
+//! of particles per cell.  Costs are shared between all ranks, so that cost_eachmb is up
+//! to date when MBs are next load balanced (with AMR, rebalancing, or on restart).
+
+void Mesh::UpdateMeasuredCost() {
+  mbcost.ncycle_counted++;
+  if ((ncycle % mbcost.ncycle) != 0) {return;}
+
+  // count number of particles in each MB on this rank
+  int nmb = nmb_thisrank;
+  int mbs = gids_eachrank[global_variable::my_rank];
+  DvceArray1D<int> nprtcl_eachmb("nprtcl_eachmb", nmb);
+  if (pmb_pack->ppart != nullptr) {
+    auto &pi = pmb_pack->ppart->prtcl_idata;
+    int npart = pmb_pack->ppart->nprtcl_thispack;
+    par_for("count_prtcl", DevExeSpace(), 0, (npart-1), KOKKOS_LAMBDA(const int p) {
+      int m = pi(PGID,p) - mbs;
+      if ((m >= 0) && (m < nmb)) {Kokkos::atomic_add(&nprtcl_eachmb(m), 1);}
+    });
+  }
+
+  // copy counters to host, compute cost of each MB on this rank
+  auto work_h = Kokkos::create_mirror_view(mbcost.work);
+  auto nprtcl_h = Kokkos::create_mirror_view(nprtcl_eachmb);
+  Kokkos::deep_copy(work_h, mbcost.work);
+  Kokkos::deep_copy(nprtcl_h, nprtcl_eachmb);
+  float ncells = static_cast<float>(NumberOfMeshBlockCells());
+  float ncyc = static_cast<float>(mbcost.ncycle_counted);
+  for (int m=0; m<nmb; ++m) {
+    cost_eachmb[mbs+m] = 1.0 +
+        (mbcost.wght_c2p*static_cast<float>(work_h(m,IWC2P)) +
+         mbcost.wght_fofc*static_cast<float>(work_h(m,IWFOFC)))/(ncells*ncyc) +
+        mbcost.wght_prtcl*static_cast<float>(nprtcl_h(m))/ncells;
+  }
+#if MPI_PARALLEL_ENABLED
+  // Pass costs between all ranks
+  MPI_Allgatherv(MPI_IN_PLACE, nmb_eachrank[global_variable::my_rank], MPI_FLOAT,
+                 cost_eachmb, nmb_eachrank, gids_eachrank, MPI_FLOAT, MPI_COMM_WORLD);
+#endif
+
+  // reset counters
+  Kokkos::deep_copy(mbcost.work, 0);
+  mbcost.ncycle_counted = 0;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Mesh::CostPerRank()
+//! \brief Returns min/max of total cost of MeshBlocks on each rank, and total cost of all
+//! MeshBlocks.  With uniform costs, these are simply min/max # of MBs per rank.
+
+void Mesh::CostPerRank(float &min_cost, float &max_cost, float &total_cost) {
+  min_cost = std::numeric_limits<float>::max();
+  max_cost = 0.0;
+  total_cost = 0.0;
+  for (int r=0; r<global_variable::nranks; ++r) {
+    float rank_cost = 0.0;
+    for (int m=gids_eachrank[r]; m<(gids_eachrank[r] + nmb_eachrank[r]); ++m) {
+      rank_cost += cost_eachmb[m];
+    }
+    min_cost = std::min(min_cost, rank_cost);
+    max_cost = std::max(max_cost, rank_cost);
+    total_cost += rank_cost;
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshRefinement::CheckLoadImbalance()
+//! \brief Redistributes MeshBlocks across ranks (without any refinement) whenever ratio
+//! of max to mean cost per rank exceeds <load_balancing>/imbalance_threshold, and the
+//! new distribution reduces this ratio by at least <load_balancing>/imbalance_min_gain.
+//! The latter prevents MBs being redistributed at every check when the imbalance cannot
+//! be reduced (e.g. a few very expensive MBs).  Checked only on cycles when measured
+//! costs are updated.
+
+void MeshRefinement::CheckLoadImbalance(Driver *pdriver, ParameterInput *pin) {
+  Mesh* pm = pmy_mesh;
+  if ((global_variable::nranks == 1) || ((pm->ncycle % pm->mbcost.ncycle) != 0)) {
+    return;
+  }
+  float min_cost, max_cost, total_cost;
+  pm->CostPerRank(min_cost, max_cost, total_cost);
+  float imbalance = max_cost*static_cast<float>(global_variable::nranks)/total_cost;
+  if (imbalance <= pm->mbcost.threshold) {return;}
+
+  // compute new distribution of MBs from current costs (same as computed in
+  // RedistAndRefineMeshBlocks), and its imbalance
+  int nranks = global_variable::nranks;
+  std::vector<int> rlist(pm->nmb_total), slist(nranks), nlist(nranks);
+  pm->LoadBalance(pm->cost_eachmb, rlist.data(), slist.data(), nlist.data(),
+                  pm->nmb_total, false);
+  float new_max_cost = 0.0;
+  for (int r=0; r<nranks; ++r) {
+    float rank_cost = 0.0;
+    for (int m=slist[r]; m<(slist[r] + nlist[r]); ++m) {
+      rank_cost += pm->cost_eachmb[m];
+    }
+    new_max_cost = std::max(new_max_cost, rank_cost);
+  }
+  float new_imbalance = new_max_cost*static_cast<float>(nranks)/total_cost;
+  if (new_imbalance > (imbalance - pm->mbcost.min_gain)) {return;}
+
+  // all ranks have same costs, so all make same decision
+  RedistAndRefineMeshBlocks(pin, 0, 0);
+  InitRedistributedMeshBlocks(pdriver);
+  nrebalance++;
+  if (global_variable::my_rank == 0) {
+    std::cout << "Load imbalance=" << imbalance << " on cycle=" << pm->ncycle
+              << ", MeshBlocks rebalanced (new imbalance=" << new_imbalance << ")"
+              << std::endl;
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void MeshRefinement::InitRecvAMR()
 //! \brief Allocates and initializes receive buffers, and posts non-blocking receives,
@@ -7,11 +7,14 @@
 //  \brief implementation of constructor and functions in Mesh class
 
 #include <algorithm>
+#include <array>
 #include <cinttypes>
+#include <cstdlib>  // abs
 #include <iostream>
 #include <limits>
 #include <cstdio> // fclose
 #include <string> // string
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -185,6 +188,55 @@ Mesh::Mesh(ParameterInput *pin) :
     std::exit(EXIT_FAILURE);
   }
 
+  // read space-filling curve used to order MeshBlocks (and so distribute them over ranks)
+  {
+    std::string sfc = pin->GetOrAddString("mesh", "sfc_ordering", "z_order");
+    if (sfc == "z_order") {
+      hilbert_ordering = false;
+    } else if (sfc == "hilbert") {
+      hilbert_ordering = true;
+    } else {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "<mesh>/sfc_ordering=" << sfc << " not implemented, "
+          << "use 'z_order' or 'hilbert'" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+  }
+
+  // read parameters for load balancing with measured cost of each MeshBlock
+  if (pin->DoesBlockExist("load_balancing")) {
+    mbcost.measured = pin->GetOrAddBoolean("load_balancing", "measure_cost", false);
+    mbcost.ncycle = pin->GetOrAddInteger("load_balancing", "ncycle_measure", 10);
+    mbcost.threshold = pin->GetOrAddReal("load_balancing", "imbalance_threshold", 0.0);
+    mbcost.wght_c2p = pin->GetOrAddReal("load_balancing", "c2p_weight", 0.05);
+    mbcost.wght_fofc = pin->GetOrAddReal("load_balancing", "fofc_weight", 1.0);
+    mbcost.wght_prtcl = pin->GetOrAddReal("load_balancing", "prtcl_weight", 0.5);
+    mbcost.min_gain = pin->GetOrAddReal("load_balancing", "imbalance_min_gain", 0.05);
+    if (mbcost.ncycle < 1) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "<load_balancing>/ncycle_measure must be > 0" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if ((mbcost.threshold > 0.0) && (mbcost.threshold < 1.0)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "<load_balancing>/imbalance_threshold=" << mbcost.threshold
+          << " must be > 1 (or 0 to disable rebalancing)" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    // with uniform costs, rebalancing cannot reduce the imbalance measured in #MBs/rank
+    if ((mbcost.threshold > 0.0) && !(mbcost.measured)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "<load_balancing>/imbalance_threshold > 0 requires "
+          << "<load_balancing>/measure_cost=true" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (mbcost.min_gain < 0.0) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "<load_balancing>/imbalance_min_gain must be >= 0" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+  }
+
   // error check physical size of mesh (root level) from input file.
   if (mesh_size.x1max <= mesh_size.x1min) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
@@ -338,7 +390,7 @@ Mesh::Mesh(ParameterInput *pin) :
 
 Mesh::~Mesh() {
   if (pmb_pack->ppart != nullptr) {delete [] nprtcl_eachrank;}
-  if (multilevel) {
+  if (pmr != nullptr) {
     delete pmr;
   }
   delete pmb_pack;
@@ -417,9 +469,65 @@ void Mesh::PrintMeshDiagnostics() {
       << std::endl;
     delete[] nb_per_rank;
     delete[] cost_per_rank;
+
+    // output number of off-rank face/edge/corner neighbors per rank, which measures the
+    // surface-to-volume ratio of the MeshBlocks on each rank (and so MPI traffic)
+    std::vector<std::array<int,3>> noff(global_variable::nranks, {0,0,0});
+    CountOffRankNeighbors(noff);
+    std::array<int,3> ntot = {0,0,0};
+    std::cout << "Off-rank neighbors (faces/edges/corners) with "
+              << ((hilbert_ordering)? "Hilbert" : "Z") << "-ordering:" << std::endl;
+    for (int i=0; i<global_variable::nranks; ++i) {
+      std::cout << "  Rank = " << i << ": " << noff[i][0] << "/" << noff[i][1] << "/"
+                << noff[i][2] << std::endl;
+      for (int n=0; n<3; ++n) {ntot[n] += noff[i][n];}
+    }
+    std::cout << "  Total = " << ntot[0] << "/" << ntot[1] << "/" << ntot[2] << std::endl;
   }
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void Mesh::CountOffRankNeighbors()
+//! \brief Counts number of neighbors across faces, edges, and corners of all MeshBlocks
+//! that are on a different rank, summed over the MeshBlocks on each rank.  Computed from
+//! tree (which is the same on all ranks), so can be called on any one rank.  Neighbors at
+//! a finer level are counted once for each child MeshBlock adjacent to the face/edge/
+//! corner, and a coarser neighbor may be counted more than once.
+
+void Mesh::CountOffRankNeighbors(std::vector<std::array<int,3>> &noff) {
+  int s2 = (multi_d)? -1 : 0, e2 = (multi_d)? 1 : 0;
+  int s3 = (three_d)? -1 : 0, e3 = (three_d)? 1 : 0;
+  for (int m=0; m<nmb_total; ++m) {
+    int rank = rank_eachmb[m];
+    for (int ox3=s3; ox3<=e3; ox3++) {
+      for (int ox2=s2; ox2<=e2; ox2++) {
+        for (int ox1=-1; ox1<=1; ox1++) {
+          int ntype = std::abs(ox1) + std::abs(ox2) + std::abs(ox3) - 1;
+          if (ntype < 0) {continue;}
+          MeshBlockTree *nt = ptree->FindNeighbor(lloc_eachmb[m], ox1, ox2, ox3);
+          if (nt == nullptr) {continue;}
+          if (nt->pleaf_ == nullptr) {
+            if (rank_eachmb[nt->gid_] != rank) {noff[rank][ntype]++;}
+          } else {
+            // neighbor at finer level, loop over children adjacent to this MeshBlock
+            for (int n=0; n<nt->nleaf_; n++) {
+              int fx = n&1, fy = (n>>1)&1, fz = (n>>2)&1;
+              if ((ox1 != 0 && fx != (1 - (ox1 + 1)/2)) ||
+                  (ox2 != 0 && fy != (1 - (ox2 + 1)/2)) ||
+                  (ox3 != 0 && fz != (1 - (ox3 + 1)/2))) {continue;}
+              MeshBlockTree *nf = nt->pleaf_[n];
+              if ((nf != nullptr) && (rank_eachmb[nf->gid_] != rank)) {
+                noff[rank][ntype]++;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void Mesh::WriteMeshStructure(int ndim)
 //  \brief writes file containing MeshBlock positions and sizes that can be used to create
@@ -567,10 +675,70 @@ std::string Mesh::GetBoundaryString(BoundaryFlag input_flag) {
   }
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void Mesh::SplitPhaseRanges()
+//! \brief Decomposes the cells of each MeshBlock into three disjoint sets used with
+//! split-phase stage updates:
+//!  (1) shell    = active cells within ng cells of a MeshBlock face.  These are the only
+//!                 active cells packed into boundary buffers, so they are updated first.
+//!  (2) interior = active cells not in the shell.  These can be updated while boundary
+//!                 communications are in flight.  Empty when nx <= 2*ng in any direction.
+//!  (3) ghost    = all ghost cells.
+//! Both the shell and ghost cells are returned as a list of up to six disjoint slabs.
+
+void Mesh::SplitPhaseRanges(std::vector<CellRange> &shell, CellRange &interior,
+                            std::vector<CellRange> &ghost) {
+  // returns slabs covering (outer - inner), where inner is contained within outer
+  auto subtract = [](const CellRange &outer, const CellRange &inner) {
+    std::vector<CellRange> slabs;
+    if (inner.IsEmpty()) {
+      slabs.push_back(outer);
+      return slabs;
+    }
+    CellRange r;
+    r = {outer.il, inner.il-1, outer.jl, outer.ju, outer.kl, outer.ku};
+    if (!(r.IsEmpty())) slabs.push_back(r);
+    r = {inner.iu+1, outer.iu, outer.jl, outer.ju, outer.kl, outer.ku};
+    if (!(r.IsEmpty())) slabs.push_back(r);
+    r = {inner.il, inner.iu, outer.jl, inner.jl-1, outer.kl, outer.ku};
+    if (!(r.IsEmpty())) slabs.push_back(r);
+    r = {inner.il, inner.iu, inner.ju+1, outer.ju, outer.kl, outer.ku};
+    if (!(r.IsEmpty())) slabs.push_back(r);
+    r = {inner.il, inner.iu, inner.jl, inner.ju, outer.kl, inner.kl-1};
+    if (!(r.IsEmpty())) slabs.push_back(r);
+    r = {inner.il, inner.iu, inner.jl, inner.ju, inner.ku+1, outer.ku};
+    if (!(r.IsEmpty())) slabs.push_back(r);
+    return slabs;
+  };
+
+  auto &indcs = mb_indcs;
+  int &ng = indcs.ng;
+  CellRange all = {0, indcs.nx1 + 2*ng - 1, 0, 0, 0, 0};
+  CellRange active = {indcs.is, indcs.ie, indcs.js, indcs.je, indcs.ks, indcs.ke};
+  interior = {indcs.is + ng, indcs.ie - ng, indcs.js, indcs.je, indcs.ks, indcs.ke};
+  if (multi_d) {
+    all.ju = indcs.nx2 + 2*ng - 1;
+    interior.jl = indcs.js + ng;
+    interior.ju = indcs.je - ng;
+  }
+  if (three_d) {
+    all.ku = indcs.nx3 + 2*ng - 1;
+    interior.kl = indcs.ks + ng;
+    interior.ku = indcs.ke - ng;
+  }
+
+  shell = subtract(active, interior);
+  ghost = subtract(all, active);
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 // \fn Mesh::NewTimeStep()
+// If pwall_time is not null, on input it holds the wall clock time elapsed on this rank,
+// and on output the maximum over all ranks.  It is reduced in the same collective as dt,
+// so that checking a wall clock limit requires no extra synchronization.
 
-void Mesh::NewTimeStep(const Real tlim) {
+void Mesh::NewTimeStep(const Real tlim, Real *pwall_time) {
   // save old timestep
   dtold = dt;
   if (dt == std::numeric_limits<float>::max()) {
@@ -632,8 +800,15 @@ void Mesh::NewTimeStep(const Real tlim) {
   }
 
 #if MPI_PARALLEL_ENABLED
-  // get minimum dt over all MPI ranks
-  MPI_Allreduce(MPI_IN_PLACE, &dt, 1, MPI_ATHENA_REAL, MPI_MIN, MPI_COMM_WORLD);
+  // get minimum dt (and maximum wall time, as minimum of its negative) over all MPI ranks
+  if (pwall_time != nullptr) {
+    Real rbuf[2] = {dt, -(*pwall_time)};
+    MPI_Allreduce(MPI_IN_PLACE, rbuf, 2, MPI_ATHENA_REAL, MPI_MIN, MPI_COMM_WORLD);
+    dt = rbuf[0];
+    *pwall_time = -rbuf[1];
+  } else {
+    MPI_Allreduce(MPI_IN_PLACE, &dt, 1, MPI_ATHENA_REAL, MPI_MIN, MPI_COMM_WORLD);
+  }
 #endif
 
   // limit last time step to stop at tlim *exactly*
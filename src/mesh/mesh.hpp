@@ -11,9 +11,11 @@
 //! MeshBlocks (potentially on different levels) that tile the entire domain.  MeshBlocks
 //! are grouped together into MeshBlockPacks for better performance on GPUs.
 
-#include <cstdint>  // int32_t
+#include <array>
+#include <cstdint>  // int32_t, int64_t
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "athena.hpp"
 
@@ -40,6 +42,16 @@ struct RegionIndcs {
   int cis,cie,cjs,cje,cks,cke;  // indices of ACTIVE coarse cells
 };
 
+//----------------------------------------------------------------------------------------
+//! \struct CellRange
+//! \brief Inclusive range of cell indices [il:iu]x[jl:ju]x[kl:ku] within a MeshBlock.
+//! Used to restrict stage updates to part of each MeshBlock (e.g. split-phase updates)
+
+struct CellRange {
+  int il, iu, jl, ju, kl, ku;
+  bool IsEmpty() const {return (iu < il) || (ju < jl) || (ku < kl);}
+};
+
 //----------------------------------------------------------------------------------------
 //! \struct NeighborBlock
 //! \brief Information about neighboring MeshBlocks stored as 2D DualArray in MeshBlock
@@ -69,8 +81,31 @@ struct LogicalLocation {
 
 struct EventCounters {
   int nfofc, neos_dfloor, neos_efloor, neos_tfloor, neos_vceil, neos_fail, maxit_c2p;
+  std::int64_t nc2p_fast, nc2p_slow;  // cells inverted in fast/second pass of 2-pass C2P
   EventCounters() : nfofc(0), neos_dfloor(0), neos_efloor(0), neos_tfloor(0),
-                    neos_vceil(0), neos_fail(0), maxit_c2p(0) {}
+                    neos_vceil(0), neos_fail(0), maxit_c2p(0),
+                    nc2p_fast(0), nc2p_slow(0) {}
+};
+
+//----------------------------------------------------------------------------------------
+//! \struct MeshBlockCost
+//! \brief parameters and per-MeshBlock work counters used to measure the cost of each
+//! MeshBlock for load balancing (see load_balance.cpp).  Counters are indexed by the
+//! local ID of MeshBlocks on this rank, and the work index below.
+
+enum MeshBlockWork {IWC2P=0, IWFOFC=1};
+constexpr int NWORK = 2;
+
+struct MeshBlockCost {
+  bool measured=false;       // set cost_eachmb from measured work (otherwise all 1.0)
+  int ncycle=10;             // # of cycles between updates of measured cost
+  int ncycle_counted=0;      // # of cycles accumulated in counters since last update
+  float threshold=0.0;       // rebalance when max/mean cost per rank exceeds (0 = never)
+  float min_gain=0.05;       // min reduction of max/mean cost needed to rebalance
+  float wght_c2p=0.05;       // cost of one c2p iteration (relative to one cell update)
+  float wght_fofc=1.0;       // cost of one FOFC cell (relative to one cell update)
+  float wght_prtcl=0.5;      // cost of one particle (relative to one cell update)
+  DvceArray2D<std::int64_t> work;  // work counters on this rank, dim [nmb][NWORK]
 };
 
 // Forward declarations required due to recursive definitions amongst mesh classes
@@ -114,6 +149,7 @@ class Mesh {
   bool multi_d;               // flag to indicate 2D and 3D calculations
   bool multilevel;            // true for SMR and AMR
   bool adaptive;              // true only for AMR
+  bool hilbert_ordering;      // order MBs along Hilbert (rather than Z-order) curve
 
   int nmb_rootx1, nmb_rootx2, nmb_rootx3; // # of MeshBlocks at root level in each dir
   int nmb_total;           // total number of MeshBlocks across all levels/ranks
@@ -122,6 +158,7 @@ class Mesh {
 
   int root_level; // logical level of root (physical) grid (e.g. Fig. 3 of method paper)
   int max_level;  // logical level of maximum refinement grid in Mesh
+  int nghbr_version=0;  // incremented each time MeshBlock neighbors are (re)built
 
   int nprtcl_thisrank;     // number of particles this rank
   int nprtcl_total;        // total number of particles across all ranks
@@ -140,6 +177,7 @@ class Mesh {
   Real time, dt, dtold, dt_last_completed, cfl_no;
   int ncycle;
   EventCounters ecounter;
+  MeshBlockCost mbcost;
 
   int nmb_packs_thisrank;                  // number of MBPacks on this rank
   MeshBlockPack* pmb_pack;                 // container for MeshBlocks on this rank
@@ -151,11 +189,16 @@ class Mesh {
   void BuildTreeFromRestart(ParameterInput *pin, IOWrapper &resfile,
                             bool single_file_per_rank=false);
   void PrintMeshDiagnostics();
+  void CountOffRankNeighbors(std::vector<std::array<int,3>> &noff);
   void WriteMeshStructure();
-  void NewTimeStep(const Real tlim);
+  void NewTimeStep(const Real tlim, Real *pwall_time=nullptr);
   void AddCoordinatesAndPhysics(ParameterInput *pinput);
   BoundaryFlag GetBoundaryFlag(const std::string& input_string);
   std::string GetBoundaryString(BoundaryFlag input_flag);
+  void SplitPhaseRanges(std::vector<CellRange> &shell, CellRange &interior,
+                        std::vector<CellRange> &ghost);
+  void UpdateMeasuredCost();
+  void CostPerRank(float &min_cost, float &max_cost, float &total_cost);
 
   // comparison function for sorting LogicalLocations based on level
   static bool GreaterLevel(const LogicalLocation & left, const LogicalLocation &right) {
@@ -175,6 +218,7 @@ class Mesh {
 
  private:
   std::unique_ptr<MeshBlockTree> ptree;  // pointer to root node in binary/quad/oct-tree
-  void LoadBalance(float *clist, int *rlist, int *slist, int *nlist, int nb);
+  void LoadBalance(float *clist, int *rlist, int *slist, int *nlist, int nb,
+                   bool warn=true);
 };
 #endif  // MESH_MESH_HPP_
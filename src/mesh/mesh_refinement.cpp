@@ -46,6 +46,7 @@ MeshRefinement::MeshRefinement(Mesh *pm, ParameterInput *pin) :
   nmb_created(0),
   nmb_deleted(0),
   nmb_sent_thisrank(0),
+  nrebalance(0),
   ncyc_check_amr(1),
   refinement_interval(5),
   prolong_prims(false),
@@ -77,6 +78,14 @@ MeshRefinement::MeshRefinement(Mesh *pm, ParameterInput *pin) :
     pmrc = new RefinementCriteria(pm, pin);
   }
 
+  // particles are not yet redistributed with MeshBlocks
+  if ((pm->mbcost.threshold > 0.0) && (pm->pmb_pack->ppart != nullptr)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+        << "Dynamic load balancing (<load_balancing>/imbalance_threshold > 0) is not "
+        << "currently compatible with particles" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
   // be sure Views are initialized to zero
   for (int m=0; m<(pm->nmb_total); ++m) {
     refine_flag.h_view(m) = 0;
@@ -149,28 +158,37 @@ void MeshRefinement::AdaptiveMeshRefinement(Driver *pdriver, ParameterInput *pin
   // Refine/derefine mesh and evolved data, set boundary conditions/timestep on new mesh
   if (nnew != 0 || ndel != 0) { // at least one (de)refinement flagged
     RedistAndRefineMeshBlocks(pin, nnew, ndel);
-    pdriver->InitBoundaryValuesAndPrimitives(pmy_mesh);
-
-    MeshBlockPack* pmbp = pmy_mesh->pmb_pack;
-    if (pmbp->phydro != nullptr) {
-      (void) pmbp->phydro->NewTimeStep(pdriver, pdriver->nexp_stages);
-    }
-    if (pmbp->pmhd != nullptr) {
-      (void) pmbp->pmhd->NewTimeStep(pdriver, pdriver->nexp_stages);
-    }
-    if (pmbp->prad != nullptr) {
-      (void) pmbp->prad->NewTimeStep(pdriver, pdriver->nexp_stages);
-    }
-    if (pmbp->pz4c != nullptr) {
-      (void) pmbp->pz4c->NewTimeStep(pdriver, pdriver->nexp_stages);
-    }
-
+    InitRedistributedMeshBlocks(pdriver);
     nmb_created += nnew;
     nmb_deleted += ndel;
   }
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void MeshRefinement::InitRedistributedMeshBlocks()
+//! \brief Sets boundary conditions, primitives, and timestep on all MeshBlocks after
+//! they have been refined/derefined and/or redistributed across ranks.
+
+void MeshRefinement::InitRedistributedMeshBlocks(Driver *pdriver) {
+  pdriver->InitBoundaryValuesAndPrimitives(pmy_mesh);
+
+  MeshBlockPack* pmbp = pmy_mesh->pmb_pack;
+  if (pmbp->phydro != nullptr) {
+    (void) pmbp->phydro->NewTimeStep(pdriver, pdriver->nexp_stages);
+  }
+  if (pmbp->pmhd != nullptr) {
+    (void) pmbp->pmhd->NewTimeStep(pdriver, pdriver->nexp_stages);
+  }
+  if (pmbp->prad != nullptr) {
+    (void) pmbp->prad->NewTimeStep(pdriver, pdriver->nexp_stages);
+  }
+  if (pmbp->pz4c != nullptr) {
+    (void) pmbp->pz4c->NewTimeStep(pdriver, pdriver->nexp_stages);
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void RefinementCriteria::CheckForRefinement()
 //! \brief Checks for refinement/de-refinement and sets refine_flag(m) for all
@@ -336,27 +354,19 @@ void MeshRefinement::UpdateMeshBlockTree(int &nnew, int &ndel) {
   // calculate the list of the newly derefined blocks
   int ctnd = 0;
   if (tnderef >= nleaf) {
-    int lk = 0, lj = 0;
-    if (pmy_mesh->multi_d) lj = 1;
-    if (pmy_mesh->three_d) lk = 1;
     for (int n=0; n<tnderef; n++) {
       if ((llderef[n].lx1 & 1) == 0 &&
           (llderef[n].lx2 & 1) == 0 &&
           (llderef[n].lx3 & 1) == 0) {
-        int r = n, rr = 0;
-        for (std::int32_t k=0; k<=lk; k++) {
-          for (std::int32_t j=0; j<=lj; j++) {
-            for (std::int32_t i=0; i<=1; i++) {
-              if (r < tnderef) {
-                if ((llderef[n].lx1+i) == llderef[r].lx1 &&
-                    (llderef[n].lx2+j) == llderef[r].lx2 &&
-                    (llderef[n].lx3+k) == llderef[r].lx3 &&
-                     llderef[n].level  == llderef[r].level) {
-                  rr++;
-                }
-                r++;
-              }
-            }
+        // leaves of the same parent are contiguous in list (which is in gid order), but
+        // not necessarily in Z-order, so search nleaf-1 entries on either side
+        int rr = 0;
+        for (int r=std::max(0, n-nleaf+1); r<std::min(tnderef, n+nleaf); r++) {
+          if ((llderef[n].lx1 >> 1) == (llderef[r].lx1 >> 1) &&
+              (llderef[n].lx2 >> 1) == (llderef[r].lx2 >> 1) &&
+              (llderef[n].lx3 >> 1) == (llderef[r].lx3 >> 1) &&
+               llderef[n].level  == llderef[r].level) {
+            rr++;
           }
         }
         if (rr == nleaf) {
@@ -417,13 +427,13 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
   if (pm->two_d) nleaf = 4;
   if (pm->three_d) nleaf = 8;
 
-  // Step 1. Create Z-ordered list of logical locations for new MBs, and newtoold list
+  // Step 1. Create SFC-ordered list of logical locations for new MBs, and newtoold list
   // mapping (new MB gid [n])-->(old gid) for all MBs. Index of array [n] is new gid,
   // value is old gid.
   new_lloc_eachmb = new LogicalLocation[new_nmb];
   newtoold = new int[new_nmb];
   int new_nmb_total;
-  pm->ptree->CreateZOrderedLLList(new_lloc_eachmb, newtoold, new_nmb_total);
+  pm->ptree->CreateOrderedLLList(new_lloc_eachmb, newtoold, new_nmb_total);
   if (new_nmb_total != new_nmb) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
         << "Number of MeshBlocks in new tree = " << new_nmb_total << " but expected "
@@ -453,15 +463,25 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
   }
 
   // Step 3.
-  // Calculate new load balance. Initialize new cost array with the simplest estimate
-  // possible: all the blocks are equal
-  // TODO(@user): implement variable cost per MeshBlock as needed
+  // Calculate new load balance. New MBs inherit cost of the old MB they were created
+  // from: refined MBs have same cost as their parent (same number of cells, similar work
+  // per cell), de-refined MBs the average cost of their children.  With uniform costs
+  // this reduces to the simplest estimate possible: all the blocks are equal.
   new_cost_eachmb = new float[new_nmb];
   new_rank_eachmb = new int[new_nmb];
   new_gids_eachrank = new int[global_variable::nranks];
   new_nmb_eachrank = new int[global_variable::nranks];
 
-  for (int i=0; i<new_nmb; i++) {new_cost_eachmb[i] = 1.0;}
+  for (int n=0; n<new_nmb; n++) {
+    int oldm = newtoold[n];
+    if (pm->lloc_eachmb[oldm].level > new_lloc_eachmb[n].level) {  // de-refined
+      float cost = 0.0;
+      for (int l=0; l<nleaf; l++) {cost += pm->cost_eachmb[oldm+l];}
+      new_cost_eachmb[n] = cost/static_cast<float>(nleaf);
+    } else {
+      new_cost_eachmb[n] = pm->cost_eachmb[oldm];
+    }
+  }
   pm->LoadBalance(new_cost_eachmb, new_rank_eachmb, new_gids_eachrank, new_nmb_eachrank,
                   new_nmb_total);
   if (new_nmb_eachrank[global_variable::my_rank] > pm->nmb_maxperrank) {
@@ -614,6 +634,14 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
   Kokkos::realloc(ncyc_since_ref, new_nmb_total);
   Kokkos::deep_copy(ncyc_since_ref, new_ncyc_since_ref);
 
+  // Work counters used to measure cost of each MB are indexed by local ID of MBs on this
+  // rank, which have now changed.  So discard work accumulated since last update of the
+  // measured cost (new MBs keep cost inherited in Step 3 until the next update).
+  if (pm->mbcost.measured) {
+    Kokkos::deep_copy(pm->mbcost.work, 0);
+    pm->mbcost.ncycle_counted = 0;
+  }
+
   // Update data in Mesh/MeshBlockPack/MeshBlock classes with new grid properties
   delete [] pm->lloc_eachmb;
   delete [] pm->rank_eachmb;
@@ -644,16 +672,15 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
   delete [] oldtonew;
 
   // Step 11.
-  // Initialize quantities stored on the mesh associated with each physics, if necessary
-  if ((nnew > 0) || (ndel > 0)) {
-    // With dynGRMHD, recalculate ADM variables
-    if ((pz4c == nullptr) && (padm != nullptr)) {
-      padm->SetADMVariables(pm->pmb_pack);
-    }
-    // With radiation, compute tetrads and associated mesh arrays
-    if (prad != nullptr) {
-      prad->SetOrthonormalTetrad();
-    }
+  // Initialize quantities stored on the mesh associated with each physics, if necessary.
+  // Also needed when MBs are only redistributed, since these are not sent between ranks
+  // With dynGRMHD, recalculate ADM variables
+  if ((pz4c == nullptr) && (padm != nullptr)) {
+    padm->SetADMVariables(pm->pmb_pack);
+  }
+  // With radiation, compute tetrads and associated mesh arrays
+  if (prad != nullptr) {
+    prad->SetOrthonormalTetrad();
   }
 
   return;
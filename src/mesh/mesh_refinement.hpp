@@ -50,6 +50,7 @@ class MeshRefinement {
   int nmb_created;           // # of MeshBlocks created via AMR across all ranks
   int nmb_deleted;           // # of MeshBlocks deleted via AMR across all ranks
   int nmb_sent_thisrank;     // # of MeshBlocks sent during load balancing on this rank
+  int nrebalance;            // # of times MeshBlocks rebalanced due to measured costs
   int ncyc_check_amr;        // # of cycles between checking mesh for ref/derefinement
   int refinement_interval;   // # of cycles between allowing successive ref/derefinement
   bool prolong_prims;        // flag to enable prolongation of primitive vars
@@ -101,6 +102,7 @@ class MeshRefinement {
   void AdaptiveMeshRefinement(Driver *pdrive, ParameterInput *pin);
   void UpdateMeshBlockTree(int &nnew, int &ndel);
   void RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, int ndel);
+  void InitRedistributedMeshBlocks(Driver *pdriver);
 
   void DerefineCCSameRank(DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
   void DerefineFCSameRank(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb);
@@ -120,6 +122,7 @@ class MeshRefinement {
   void HighOrderRestrictCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
 
   // functions for load balancing (in file load_balance.cpp)
+  void CheckLoadImbalance(Driver *pdriver, ParameterInput *pin);
   void InitRecvAMR(int nleaf);
   void PackAndSendAMR(int nleaf);
   void PackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca, int ncc, int nfc);
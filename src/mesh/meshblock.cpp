@@ -426,5 +426,8 @@ void MeshBlock::SetNeighbors(std::unique_ptr<MeshBlockTree> &ptree, int *ranklis
   nghbr.template modify<HostMemSpace>();
   nghbr.template sync<DevExeSpace>();
 
+  // signal that any tables built from neighbor data (e.g. MPI message offsets) are stale
+  pmy_pack->pmesh->nghbr_version++;
+
   return;
 }
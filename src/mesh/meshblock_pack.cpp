@@ -41,11 +41,10 @@ MeshBlockPack::MeshBlockPack(Mesh *pm, int igids, int igide) :
   gide(igide),
   nmb_thispack(igide - igids + 1) {
   // create map for task lists
-  tl_map.insert(std::make_pair("before_timeintegrator",std::make_shared<TaskList>()));
-  tl_map.insert(std::make_pair("after_timeintegrator",std::make_shared<TaskList>()));
-  tl_map.insert(std::make_pair("before_stagen",std::make_shared<TaskList>()));
-  tl_map.insert(std::make_pair("stagen",std::make_shared<TaskList>()));
-  tl_map.insert(std::make_pair("after_stagen",std::make_shared<TaskList>()));
+  for (auto &name : {"before_timeintegrator", "after_timeintegrator", "before_stagen",
+                     "stagen", "after_stagen"}) {
+    tl_map.insert(std::make_pair(name, std::make_shared<TaskList>(name)));
+  }
 }
 
 //----------------------------------------------------------------------------------------
@@ -295,7 +295,12 @@ void MeshBlockTree::Derefine(int &ndel) {
     }
   }
 
-  gid_ = pleaf_[0]->gid_; // now this is a leaf; inherit the first leaf's GID
+  // now this is a leaf; inherit the GID of the first leaf in the SFC ordering, which
+  // is the smallest GID of all leaves (not necessarily that of leaf 0)
+  gid_ = pleaf_[0]->gid_;
+  for (int n=1; n<nleaf_; n++) {
+    if (pleaf_[n]->gid_ < gid_) {gid_ = pleaf_[n]->gid_;}
+  }
   for (int n=0; n<nleaf_; n++) {
     delete pleaf_[n];
   }
@@ -323,17 +328,19 @@ void MeshBlockTree::CountMeshBlocks(int& count) {
 }
 
 //----------------------------------------------------------------------------------------
-//! \fn void MeshBlockTree::CreateZOrderedLLList(LogicalLocation *list, int *pg, int& cnt)
-//! \brief Creates the Location list for tree sorted by Z-ordering, and creates new MB ids
-//! based on this order.  Should be called from root of tree. Called in BuildTreeXXX()
+//! \fn void MeshBlockTree::CreateOrderedLLList(LogicalLocation *list, int *pg, int& cnt)
+//! \brief Creates the Location list for tree sorted along a space-filling curve (either
+//! Z-ordering, or Hilbert ordering if <mesh>/sfc_ordering=hilbert), and creates new MB
+//! ids based on this order.  Should be called from root of tree. Called in BuildTreeXXX()
 //! functions when tree is constructed for first time, in which case second argument is
-//! 'nullptr' and this function creates gids for all MBs based on Z-ordering. Also called
-//! by ResdistributeAndRefineMeshBlocks() function with AMR with second argument pointing
-//! to an integer array that is used to store old gid of node on old tree, before creating
-//! a new gid based on Z-ordering in the new tree. Thus pglist[n] is a mapping of
+//! 'nullptr' and this function creates gids for all MBs based on this ordering. Also
+//! called by ResdistributeAndRefineMeshBlocks() function with AMR with second argument
+//! pointing to an integer array that is used to store old gid of node on old tree, before
+//! creating a new gid based on ordering of the new tree. Thus pglist[n] is a mapping of
 //! (new gid n) --> (old gid). Also returns total number of MBs in tree in third argument.
+//! With either ordering, all leaves of a node are contiguous in the list.
 
-void MeshBlockTree::CreateZOrderedLLList(LogicalLocation *list, int *pglist, int& count) {
+void MeshBlockTree::CreateOrderedLLList(LogicalLocation *list, int *pglist, int& count) {
   if (lloc_.level == 0) {count=0;}
 
   if (pleaf_ == nullptr) {
@@ -341,14 +348,90 @@ void MeshBlockTree::CreateZOrderedLLList(LogicalLocation *list, int *pglist, int
     if (pglist != nullptr) {pglist[count]=gid_;}
     gid_=count;
     count++;
+  } else if (pmesh_->hilbert_ordering && nleaf_ > 2) {
+    // visit leaves in order of their Hilbert index (insertion sort of at most 8 leaves)
+    int order[8];
+    int nl = 0;
+    for (int n=0; n<nleaf_; n++) {
+      if (pleaf_[n] == nullptr) {continue;}
+      int l = nl++;
+      while ((l > 0) && HilbertLess(pleaf_[n]->lloc_, pleaf_[order[l-1]]->lloc_)) {
+        order[l] = order[l-1];
+        l--;
+      }
+      order[l] = n;
+    }
+    for (int l=0; l<nl; l++) {pleaf_[order[l]]->CreateOrderedLLList(list, pglist, count);}
   } else {
     for (int n=0; n<nleaf_; n++) {
-      if (pleaf_[n] != nullptr) {pleaf_[n]->CreateZOrderedLLList(list, pglist, count);}
+      if (pleaf_[n] != nullptr) {pleaf_[n]->CreateOrderedLLList(list, pglist, count);}
     }
   }
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn bool MeshBlockTree::HilbertLess(LogicalLocation a, LogicalLocation b)
+//! \brief Returns true if MeshBlock at location a precedes that at location b along a
+//! Hilbert curve through the (2D or 3D) logical root domain.  The position of the lower
+//! corner of each MB is mapped onto the Hilbert curve at the finest possible level (31
+//! bits per dimension) using the algorithm of Skilling (2004, AIP Conf. Proc. 707, 381).
+//! Since the curve visits every MB (and all of its children) contiguously, comparing the
+//! index of any one point in each MB suffices to order non-overlapping MBs.
+
+bool MeshBlockTree::HilbertLess(const LogicalLocation &a, const LogicalLocation &b) {
+  constexpr int nbits = 31;
+  const int ndim = (pmesh_->three_d)? 3 : 2;
+  std::uint32_t xa[3] = {static_cast<std::uint32_t>(a.lx1),
+                         static_cast<std::uint32_t>(a.lx2),
+                         static_cast<std::uint32_t>(a.lx3)};
+  std::uint32_t xb[3] = {static_cast<std::uint32_t>(b.lx1),
+                         static_cast<std::uint32_t>(b.lx2),
+                         static_cast<std::uint32_t>(b.lx3)};
+  for (int d=0; d<ndim; ++d) {
+    xa[d] <<= (nbits - a.level);
+    xb[d] <<= (nbits - b.level);
+  }
+
+  // convert coordinates to "transposed" Hilbert index, in which bits of the index are
+  // given by bits of x[0],x[1],..x[ndim-1] interleaved starting from most significant
+  auto transpose = [ndim](std::uint32_t *x) {
+    const std::uint32_t m = 1u << (nbits - 1);
+    // inverse undo excess work
+    for (std::uint32_t q = m; q > 1; q >>= 1) {
+      std::uint32_t p = q - 1;
+      for (int d=0; d<ndim; ++d) {
+        if (x[d] & q) {
+          x[0] ^= p;                          // invert
+        } else {
+          std::uint32_t t = (x[0] ^ x[d]) & p;   // exchange
+          x[0] ^= t;
+          x[d] ^= t;
+        }
+      }
+    }
+    // Gray encode
+    for (int d=1; d<ndim; ++d) {x[d] ^= x[d-1];}
+    std::uint32_t t = 0;
+    for (std::uint32_t q = m; q > 1; q >>= 1) {
+      if (x[ndim-1] & q) {t ^= q - 1;}
+    }
+    for (int d=0; d<ndim; ++d) {x[d] ^= t;}
+  };
+  transpose(xa);
+  transpose(xb);
+
+  // compare interleaved bits, starting from most significant
+  for (int bit=nbits-1; bit>=0; --bit) {
+    for (int d=0; d<ndim; ++d) {
+      std::uint32_t ba = (xa[d] >> bit) & 1u;
+      std::uint32_t bb = (xb[d] >> bit) & 1u;
+      if (ba != bb) {return (ba < bb);}
+    }
+  }
+  return false;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn MeshBlockTree* MeshBlockTree::FindNeighbor(LogicalLocation myloc,
 //!                                   int ox1, int ox2, int ox3, bool amrflag)
@@ -46,7 +46,7 @@ class MeshBlockTree {
   void Derefine(int &ndel);
   MeshBlockTree* FindMeshBlock(LogicalLocation tloc);
   void CountMeshBlocks(int& count);
-  void CreateZOrderedLLList(LogicalLocation *list, int *pglist, int& count);
+  void CreateOrderedLLList(LogicalLocation *list, int *pglist, int& count);
   MeshBlockTree* FindNeighbor(LogicalLocation myloc, int ox1, int ox2, int ox3,
                               bool amrflag=false);
 
@@ -56,6 +56,9 @@ class MeshBlockTree {
   int gid_;                // grid ID
   LogicalLocation lloc_;   // stores logical x1/x2/x3 location, level for node in tree
 
+  // functions
+  static bool HilbertLess(const LogicalLocation &a, const LogicalLocation &b);
+
   static Mesh *pmesh_;           // pointer to Mesh containing Tree
   static MeshBlockTree *proot_;  // pointer to leaf at root level
   static int nleaf_;             // number of leafs (2/4/8 for 1D/2D/3D)
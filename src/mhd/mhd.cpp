@@ -51,6 +51,7 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     fofc_scal("fofc_scal",1,1,1,1,1),
     utest("utest",1,1,1,1,1),
     bcctest("bcctest",1,1,1,1,1),
+    fofc_list("fofc_list",1),
     pmy_pack(ppack),
     e1_cc("e1_cc",1,1,1,1),
     e2_cc("e2_cc",1,1,1,1),
@@ -193,6 +194,48 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     // determine if FOFC is enabled
     use_fofc = pin->GetOrAddBoolean("mhd","fofc",false);
 
+    // determine if split-phase updates are enabled.  Only supported for the basic task
+    // list on a uniform mesh, since the shell/interior split is not applied to fluxes at
+    // fine/coarse boundaries, FOFC, diffusion, shearing box, or source terms.  Runs
+    // with other physics use the task lists of those modules, which are not split.
+    split_phase = pin->GetOrAddBoolean("mhd","split_phase",false);
+    if (split_phase) {
+      bool user_srcs = pin->DoesParameterExist("problem","user_srcs") &&
+                       pin->GetBoolean("problem","user_srcs");
+      bool other_physics = pin->DoesBlockExist("hydro") ||
+                           pin->DoesBlockExist("radiation") ||
+                           pin->DoesBlockExist("ion-neutral") ||
+                           pin->DoesBlockExist("z4c") || pin->DoesBlockExist("adm");
+      if (pmy_pack->pmesh->multilevel || use_fofc || (porb_u != nullptr) ||
+          (pvisc != nullptr) || (pcond != nullptr) || (presist != nullptr) ||
+          (psrc != nullptr) || user_srcs || pmy_pack->pcoord->is_general_relativistic ||
+          other_physics) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "<mhd>/split_phase=true cannot be used with SMR/AMR, FOFC, "
+          << "shearing box, diffusion, resistivity, source terms, GR, or with hydro, "
+          << "radiation, ion-neutral, z4c, or adm physics" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+
+    // with fused update, flux divergence is added to u0 directly in the flux kernels,
+    // as in Hydro, so only the mass fluxes used to upwind E in CornerE() are stored.
+    fused_update = pin->GetOrAddBoolean("mhd","fused_update",false);
+    if (fused_update) {
+      if (pmy_pack->pmesh->multilevel || use_fofc || split_phase ||
+          (pvisc != nullptr) || (pcond != nullptr) || (presist != nullptr) ||
+          pin->DoesBlockExist("turb_driving") ||
+          pmy_pack->pcoord->is_dynamical_relativistic ||
+          (pmy_pack->pcoord->is_general_relativistic &&
+           pmy_pack->pcoord->coord_data.bh_excise)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "<mhd>/fused_update=true cannot be used with SMR/AMR, FOFC, "
+          << "split-phase updates, diffusion, resistivity, turbulence driving, "
+          << "dynamical GR, or excision" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+
     // select reconstruction method (default PLM)
     std::string xorder = pin->GetOrAddString("mhd","reconstruct","plm");
     if (xorder.compare("dc") == 0) {
@@ -327,10 +370,11 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
       Kokkos::realloc(b1.x2f, nmb, ncells3, ncells2+1, ncells1);
       Kokkos::realloc(b1.x3f, nmb, ncells3+1, ncells2, ncells1);
 
-      // allocate fluxes, electric fields
-      Kokkos::realloc(uflx.x1f, nmb, (nmhd+nscalars), ncells3, ncells2, ncells1+1);
-      Kokkos::realloc(uflx.x2f, nmb, (nmhd+nscalars), ncells3, ncells2+1, ncells1);
-      Kokkos::realloc(uflx.x3f, nmb, (nmhd+nscalars), ncells3+1, ncells2, ncells1);
+      // allocate fluxes (only mass fluxes with fused update), electric fields
+      int nflx = (fused_update)? 1 : (nmhd+nscalars);
+      Kokkos::realloc(uflx.x1f, nmb, nflx, ncells3, ncells2, ncells1+1);
+      Kokkos::realloc(uflx.x2f, nmb, nflx, ncells3, ncells2+1, ncells1);
+      Kokkos::realloc(uflx.x3f, nmb, nflx, ncells3+1, ncells2, ncells1);
       Kokkos::realloc(efld.x1e, nmb, ncells3+1, ncells2+1, ncells1);
       Kokkos::realloc(efld.x2e, nmb, ncells3+1, ncells2, ncells1+1);
       Kokkos::realloc(efld.x3e, nmb, ncells3, ncells2+1, ncells1+1);
@@ -358,6 +402,11 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
           Kokkos::deep_copy(fofc_scal, false);
         }
       }
+      // list of flagged cells, also used for cells about the excision in GR
+      if (use_fofc || (pmy_pack->pcoord->is_general_relativistic &&
+                       pmy_pack->pcoord->coord_data.bh_excise)) {
+        Kokkos::realloc(fofc_list, nmb*ncells3*ncells2*ncells1);
+      }
     }
   }
 }
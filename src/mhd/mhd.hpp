@@ -11,6 +11,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "athena.hpp"
 #include "parameter_input.hpp"
@@ -77,6 +78,9 @@ struct MHDTaskIDs {
   TaskID newdt;
   TaskID csend;
   TaskID crecv;
+  TaskID flux_int;    // following only used with split-phase updates
+  TaskID rkupdt_int;
+  TaskID c2p_int;
 };
 
 namespace mhd {
@@ -132,6 +136,9 @@ class MHD {
   DvceArray4D<Real> e1x2, e3x2;
   DvceArray4D<Real> e2x3, e1x3;
   Real dtnew;
+  // if true, MHD::NewTimeStep() also accumulates history sums in hist_sums
+  bool fuse_hist = false;
+  array_sum::GlobalSum hist_sums;
 
   // following used for time derivatives in computation of jcon
   bool wbcc_saved = false;
@@ -142,6 +149,16 @@ class MHD {
   DvceArray4D<bool> fofc;  // flag for each cell to indicate if FOFC is needed
   DvceArray5D<bool> fofc_scal;  // flag to indicate if FOFC for scalar is needed
   bool use_fofc = false;   // flag to enable FOFC
+  // if true, flux divergence is added to u0 in flux kernels, and uflx only stores the
+  // mass fluxes needed by CornerE()
+  bool fused_update = false;
+
+  // following used for split-phase updates, in which the interior of each MeshBlock is
+  // updated while boundary communications are in flight
+  bool split_phase = false;          // flag to enable split-phase updates
+  std::vector<CellRange> shell_rng;  // active cells within ng cells of MeshBlock faces
+  CellRange interior_rng;            // all other active cells (may be empty)
+  std::vector<CellRange> ghost_rng;  // ghost cells
 
   // container to hold names of TaskIDs
   MHDTaskIDs id;
@@ -183,18 +200,32 @@ class MHD {
   TaskStatus Prolongate(Driver* pdrive, int stage);
   TaskStatus ConToPrim(Driver *d, int stage);
   TaskStatus NewTimeStep(Driver *d, int stage);
+  // ...in "stagen_tl" task list with split-phase updates
+  TaskStatus FluxesShell(Driver *d, int stage);
+  TaskStatus FluxesInterior(Driver *d, int stage);
+  TaskStatus RKUpdateShell(Driver *d, int stage);
+  TaskStatus RKUpdateInterior(Driver *d, int stage);
+  TaskStatus ConToPrimActive(Driver *d, int stage);
+  TaskStatus ConToPrimGhost(Driver *d, int stage);
   // ...in "after_stagen_tl" task list
   TaskStatus ClearSend(Driver *d, int stage);
   TaskStatus ClearRecv(Driver *d, int stage);  // also in Driver::Initialize
 
-  // CalculateFluxes function templated over Riemann Solvers
+  // CalculateFluxes function templated over Riemann Solvers (and reconstruction method)
+  // Fluxes are computed on all faces of cells in range rng (plus extra faces needed for
+  // CornerE and FOFC), and RK update is performed over cells in range rng
   template <MHD_RSolver T>
-  void CalculateFluxes(Driver *d, int stage);
+  void CalculateFluxes(Driver *d, int stage, const CellRange &rng);
+  template <MHD_RSolver T, ReconstructionMethod R, bool F>
+  void CalculateFluxes(Driver *d, int stage, const CellRange &rng);
+  void FluxesOverRange(Driver *d, int stage, const CellRange &rng);
+  void RKUpdateOverRange(Driver *d, int stage, const CellRange &rng);
 
   // first-order flux correction
   void FOFC(Driver *d, int stage);
 
   DvceArray5D<Real> utest, bcctest;  // scratch arrays for FOFC
+  DvceArray1D<int> fofc_list;        // compacted list of cells flagged for FOFC
 
  private:
   MeshBlockPack* pmy_pack;   // ptr to MeshBlockPack containing this MHD
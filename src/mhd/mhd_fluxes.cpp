@@ -33,25 +33,36 @@ namespace mhd {
 //----------------------------------------------------------------------------------------
 //! \fn void MHD::CalculateFlux
 //! \brief Calculate fluxes of conserved variables, and face-centered area-averaged EMFs
-//! for evolution of magnetic field
-//! Note this function is templated over RS for better performance on GPUs.
-
-template <MHD_RSolver rsolver_method_>
-void MHD::CalculateFluxes(Driver *pdriver, int stage) {
+//! for evolution of magnetic field, on all faces of the cells in the range rng.  With
+//! FOFC fluxes are also computed on the faces of one extra layer of cells (FOFC is only
+//! used when rng spans all active cells).
+//! Note this function is templated over both RS and reconstruction method, so that each
+//! kernel contains only the code paths it uses, and scratch memory is sized per method.
+//!
+//! With fused_update the fluxes are only stored in scratch memory, and the flux
+//! difference in each direction is added to u0 in the same kernel, as in Hydro.  Only
+//! the mass fluxes are copied to uflx (which then has a single component), since they
+//! are needed to upwind the electric fields in CornerE().
+
+template <MHD_RSolver rsolver_method_, ReconstructionMethod recon_method_,
+          bool fused_update_>
+void MHD::CalculateFluxes(Driver *pdriver, int stage, const CellRange &rng) {
   RegionIndcs &indcs_ = pmy_pack->pmesh->mb_indcs;
-  int is = indcs_.is, ie = indcs_.ie;
-  int js = indcs_.js, je = indcs_.je;
-  int ks = indcs_.ks, ke = indcs_.ke;
+  int is = rng.il, ie = rng.iu;
+  int js = rng.jl, je = rng.ju;
+  int ks = rng.kl, ke = rng.ku;
+  // CornerE requires fluxes on faces one cell beyond the active cells in transverse
+  // directions.  Only extend rng where it coincides with the edge of the active cells, so
+  // calls over disjoint parts of a MeshBlock compute the same faces as a single call.
+  int isx = (is == indcs_.is)? is-1 : is, iex = (ie == indcs_.ie)? ie+1 : ie;
+  int jsx = (js == indcs_.js)? js-1 : js, jex = (je == indcs_.je)? je+1 : je;
+  int ksx = (ks == indcs_.ks)? ks-1 : ks, kex = (ke == indcs_.ke)? ke+1 : ke;
   int ncells1 = indcs_.nx1 + 2*(indcs_.ng);
 
   int &nmhd_ = nmhd;
   int nvars = nmhd + nscalars;
   int nmb1 = pmy_pack->nmb_thispack - 1;
-  const auto recon_method_ = recon_method;
-  bool extrema = false;
-  if (recon_method == ReconstructionMethod::ppmx) {
-    extrema = true;
-  }
+  constexpr bool extrema = (recon_method_ == ReconstructionMethod::ppmx);
 
   auto &eos_ = peos->eos_data;
   auto &size_ = pmy_pack->pmb->mb_size;
@@ -59,11 +70,24 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
   auto &w0_ = w0;
   auto &b0_ = bcc0;
 
+  // weights and fractional time step of RK stage, used with fused update
+  Real gam0 = 0.0, gam1 = 0.0, beta_dt = 0.0;
+  if constexpr (fused_update_) {
+    gam0 = pdriver->gam0[stage-1];
+    gam1 = pdriver->gam1[stage-1];
+    beta_dt = (pdriver->beta[stage-1])*(pmy_pack->pmesh->dt);
+  }
+  auto &u0_ = u0;
+  auto &u1_ = u1;
+  // number of scratch arrays for fluxes with fused update
+  constexpr int nfscr = (fused_update_)? 1 : 0;
+
   //--------------------------------------------------------------------------------------
   // i-direction
 
   size_t scr_size = (ScrArray2D<Real>::shmem_size(nvars, ncells1) +
-                     ScrArray2D<Real>::shmem_size(3, ncells1)) * 2;
+                     ScrArray2D<Real>::shmem_size(3, ncells1)) * 2 +
+                    ScrArray2D<Real>::shmem_size(nvars, ncells1) * nfscr;
   int scr_level = 0;
   auto &flx1_ = uflx.x1f;
   auto &e31_ = e3x1;
@@ -75,9 +99,9 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
   if (pmy_pack->pmesh->one_d) {
     jl = js, ju = je, kl = ks, ku = ke;
   } else if (pmy_pack->pmesh->two_d) {
-    jl = js-1, ju = je+1, kl = ks, ku = ke;
+    jl = jsx, ju = jex, kl = ks, ku = ke;
   } else {
-    jl = js-1, ju = je+1, kl = ks-1, ku = ke+1;
+    jl = jsx, ju = jex, kl = ksx, ku = kex;
   }
   int il = is, iu = ie+1;
   if (use_fofc) { il = is-1, iu = ie+2; }
@@ -88,28 +112,25 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
     ScrArray2D<Real> wr(member.team_scratch(scr_level), nvars, ncells1);
     ScrArray2D<Real> bl(member.team_scratch(scr_level), 3, ncells1);
     ScrArray2D<Real> br(member.team_scratch(scr_level), 3, ncells1);
+    ScrArray2D<Real> fscr;
+    if constexpr (fused_update_) {
+      fscr = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+    }
 
     // Reconstruct qR[i] and qL[i+1], for both W and Bcc
-    switch (recon_method_) {
-      case ReconstructionMethod::dc:
-        DonorCellX1(member, m, k, j, il-1, iu, w0_, wl, wr);
-        DonorCellX1(member, m, k, j, il-1, iu, b0_, bl, br);
-        break;
-      case ReconstructionMethod::plm:
-        PiecewiseLinearX1(member, m, k, j, il-1, iu, w0_, wl, wr);
-        PiecewiseLinearX1(member, m, k, j, il-1, iu, b0_, bl, br);
-        break;
-      case ReconstructionMethod::ppm4:
-      case ReconstructionMethod::ppmx:
-        PiecewiseParabolicX1(member,eos_,extrema,true,  m, k, j, il-1, iu, w0_, wl, wr);
-        PiecewiseParabolicX1(member,eos_,extrema,false, m, k, j, il-1, iu, b0_, bl, br);
-        break;
-      case ReconstructionMethod::wenoz:
-        WENOZX1(member, eos_, true,  m, k, j, il-1, iu, w0_, wl, wr);
-        WENOZX1(member, eos_, false, m, k, j, il-1, iu, b0_, bl, br);
-        break;
-      default:
-        break;
+    if constexpr (recon_method_ == ReconstructionMethod::dc) {
+      DonorCellX1(member, m, k, j, il-1, iu, w0_, wl, wr);
+      DonorCellX1(member, m, k, j, il-1, iu, b0_, bl, br);
+    } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+      PiecewiseLinearX1(member, m, k, j, il-1, iu, w0_, wl, wr);
+      PiecewiseLinearX1(member, m, k, j, il-1, iu, b0_, bl, br);
+    } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                         recon_method_ == ReconstructionMethod::ppmx) {
+      PiecewiseParabolicX1(member,eos_,extrema,true,  m, k, j, il-1, iu, w0_, wl, wr);
+      PiecewiseParabolicX1(member,eos_,extrema,false, m, k, j, il-1, iu, b0_, bl, br);
+    } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+      WENOZX1(member, eos_, true,  m, k, j, il-1, iu, w0_, wl, wr);
+      WENOZX1(member, eos_, false, m, k, j, il-1, iu, b0_, bl, br);
     }
     // Sync all threads in the team so that scratch memory is consistent
     member.team_barrier();
@@ -123,7 +144,7 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
     auto size = size_;
     auto coord = coord_;
     auto bx = bx_;
-    auto flx1 = flx1_;
+    auto flx1 = FluxArray<fused_update_>(flx1_, fscr);
     auto e31 = e31_;
     auto e21 = e21_;
     if constexpr (rsolver_method_ == MHD_RSolver::advect) {
@@ -149,22 +170,41 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
     if (nvars > nmhd_) {
       for (int n=nmhd_; n<nvars; ++n) {
         par_for_inner(member, is, ie+1, [&](const int i) {
-          if (flx1_(m,IDN,k,j,i) >= 0.0) {
-            flx1_(m,n,k,j,i) = flx1_(m,IDN,k,j,i)*wl(n,i);
+          if (flx1(m,IDN,k,j,i) >= 0.0) {
+            flx1(m,n,k,j,i) = flx1(m,IDN,k,j,i)*wl(n,i);
           } else {
-            flx1_(m,n,k,j,i) = flx1_(m,IDN,k,j,i)*wr(n,i);
+            flx1(m,n,k,j,i) = flx1(m,IDN,k,j,i)*wr(n,i);
           }
         });
       }
     }
+
+    // with fused update, store mass flux, apply weighted average and add dF1/dx1 to u0
+    if constexpr (fused_update_) {
+      member.team_barrier();
+      par_for_inner(member, il, iu, [&](const int i) {
+        flx1_(m,IDN,k,j,i) = fscr(IDN,i);
+      });
+      if (j >= js && j <= je && k >= ks && k <= ke) {
+        for (int n=0; n<nvars; ++n) {
+          par_for_inner(member, is, ie, [&](const int i) {
+            u0_(m,n,k,j,i) = gam0*u0_(m,n,k,j,i) + gam1*u1_(m,n,k,j,i)
+                           - beta_dt*(fscr(n,i+1) - fscr(n,i))/size.d_view(m).dx1;
+          });
+        }
+      }
+    }
   });
 
   //--------------------------------------------------------------------------------------
   // j-direction
+  // Three sets of scratch arrays are cycled over j (two are sufficient for donor cell)
 
+  constexpr int nscr = (recon_method_ == ReconstructionMethod::dc)? 2 : 3;
   if (pmy_pack->pmesh->multi_d) {
     scr_size = (ScrArray2D<Real>::shmem_size(nvars, ncells1) +
-                ScrArray2D<Real>::shmem_size(3, ncells1)) * 3;
+                ScrArray2D<Real>::shmem_size(3, ncells1)) * nscr +
+               ScrArray2D<Real>::shmem_size(nvars, ncells1) * 2 * nfscr;
     auto &flx2_ = uflx.x2f;
     auto &by_ = b0.x2f;
     auto &e12_ = e1x2;
@@ -174,7 +214,7 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
     if (pmy_pack->pmesh->two_d) {
       kl = ks, ku = ke;
     } else { // 3D
-      kl = ks-1, ku = ke+1;
+      kl = ksx, ku = kex;
     }
     jl = js-1, ju = je+1;
     if (use_fofc) { jl = js-2, ju = je+2; }
@@ -183,10 +223,21 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
     KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k) {
       ScrArray2D<Real> scr1(member.team_scratch(scr_level), nvars, ncells1);
       ScrArray2D<Real> scr2(member.team_scratch(scr_level), nvars, ncells1);
-      ScrArray2D<Real> scr3(member.team_scratch(scr_level), nvars, ncells1);
+      ScrArray2D<Real> scr3;
+      if constexpr (nscr == 3) {
+        scr3 = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+      }
       ScrArray2D<Real> scr4(member.team_scratch(scr_level), 3, ncells1);
       ScrArray2D<Real> scr5(member.team_scratch(scr_level), 3, ncells1);
-      ScrArray2D<Real> scr6(member.team_scratch(scr_level), 3, ncells1);
+      ScrArray2D<Real> scr6;
+      if constexpr (nscr == 3) {
+        scr6 = ScrArray2D<Real>(member.team_scratch(scr_level), 3, ncells1);
+      }
+      ScrArray2D<Real> fscr1, fscr2;
+      if constexpr (fused_update_) {
+        fscr1 = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+        fscr2 = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+      }
 
       for (int j=jl; j<=ju; ++j) {
         // Permute scratch arrays.
@@ -202,28 +253,33 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
           bl     = scr5;
           bl_jp1 = scr4;
         }
+        // with donor cell, qR[j] = qL[j+1], so both share the same array
+        if constexpr (nscr == 2) {
+          wr = wl_jp1;
+          br = bl_jp1;
+        }
+        // with fused update, fluxes on faces j and j-1 are kept in scratch
+        auto fj   = fscr1;
+        auto fjm1 = fscr2;
+        if ((j%2) == 0) {
+          fj   = fscr2;
+          fjm1 = fscr1;
+        }
 
         // Reconstruct qR[j] and qL[j+1], for both W and Bcc
-        switch (recon_method_) {
-          case ReconstructionMethod::dc:
-            DonorCellX2(member, m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
-            DonorCellX2(member, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
-            break;
-          case ReconstructionMethod::plm:
-            PiecewiseLinearX2(member, m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
-            PiecewiseLinearX2(member, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
-            break;
-          case ReconstructionMethod::ppm4:
-          case ReconstructionMethod::ppmx:
-            PiecewiseParabolicX2(member,eos_,extrema,true, m,k,j,is-1,ie+1,w0_,wl_jp1,wr);
-            PiecewiseParabolicX2(member,eos_,extrema,false,m,k,j,is-1,ie+1,b0_,bl_jp1,br);
-            break;
-          case ReconstructionMethod::wenoz:
-            WENOZX2(member, eos_, true,  m, k, j, is-1, ie+1, w0_, wl_jp1, wr);
-            WENOZX2(member, eos_, false, m, k, j, is-1, ie+1, b0_, bl_jp1, br);
-            break;
-          default:
-            break;
+        if constexpr (recon_method_ == ReconstructionMethod::dc) {
+          DonorCellX2(member, m, k, j, isx, iex, w0_, wl_jp1, wr);
+          DonorCellX2(member, m, k, j, isx, iex, b0_, bl_jp1, br);
+        } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+          PiecewiseLinearX2(member, m, k, j, isx, iex, w0_, wl_jp1, wr);
+          PiecewiseLinearX2(member, m, k, j, isx, iex, b0_, bl_jp1, br);
+        } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                             recon_method_ == ReconstructionMethod::ppmx) {
+          PiecewiseParabolicX2(member,eos_,extrema,true, m,k,j,isx,iex,w0_,wl_jp1,wr);
+          PiecewiseParabolicX2(member,eos_,extrema,false,m,k,j,isx,iex,b0_,bl_jp1,br);
+        } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+          WENOZX2(member, eos_, true,  m, k, j, isx, iex, w0_, wl_jp1, wr);
+          WENOZX2(member, eos_, false, m, k, j, isx, iex, b0_, bl_jp1, br);
         }
         member.team_barrier();
 
@@ -237,47 +293,63 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
           auto size = size_;
           auto coord = coord_;
           auto by = by_;
-          auto flx2 = flx2_;
+          auto flx2 = FluxArray<fused_update_>(flx2_, fj);
           auto e12 = e12_;
           auto e32 = e32_;
           if constexpr (rsolver_method_ == MHD_RSolver::advect) {
             Advect(member,eos,indcs,size,coord,
-                    m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+                    m,k,j,isx,iex,IVY,wl,wr,bl,br,by,flx2,e12,e32);
           } else if constexpr (rsolver_method_ == MHD_RSolver::llf) {
             LLF(member,eos,indcs,size,coord,
-                    m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+                    m,k,j,isx,iex,IVY,wl,wr,bl,br,by,flx2,e12,e32);
           } else if constexpr (rsolver_method_ == MHD_RSolver::hlle) {
             HLLE(member,eos,indcs,size,coord,
-                    m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+                    m,k,j,isx,iex,IVY,wl,wr,bl,br,by,flx2,e12,e32);
           } else if constexpr (rsolver_method_ == MHD_RSolver::hlld) {
             HLLD(member,eos,indcs,size,coord,
-                    m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+                    m,k,j,isx,iex,IVY,wl,wr,bl,br,by,flx2,e12,e32);
           } else if constexpr (rsolver_method_ == MHD_RSolver::llf_sr) {
             LLF_SR(member,eos,indcs,size,coord,
-                    m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+                    m,k,j,isx,iex,IVY,wl,wr,bl,br,by,flx2,e12,e32);
           } else if constexpr (rsolver_method_ == MHD_RSolver::hlle_sr) {
             HLLE_SR(member,eos,indcs,size,coord,
-                    m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+                    m,k,j,isx,iex,IVY,wl,wr,bl,br,by,flx2,e12,e32);
           } else if constexpr (rsolver_method_ == MHD_RSolver::llf_gr) {
             LLF_GR(member,eos,indcs,size,coord,
-                    m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+                    m,k,j,isx,iex,IVY,wl,wr,bl,br,by,flx2,e12,e32);
           } else if constexpr (rsolver_method_ == MHD_RSolver::hlle_gr) {
             HLLE_GR(member,eos,indcs,size,coord,
-                    m,k,j,is-1,ie+1,IVY,wl,wr,bl,br,by,flx2,e12,e32);
+                    m,k,j,isx,iex,IVY,wl,wr,bl,br,by,flx2,e12,e32);
           }
           member.team_barrier();
-        }
 
-        // calculate fluxes of scalars (if any)
-        if (nvars > nmhd_) {
-          for (int n=nmhd_; n<nvars; ++n) {
-            par_for_inner(member, is, ie, [&](const int i) {
-              if (flx2_(m,IDN,k,j,i) >= 0.0) {
-                flx2_(m,n,k,j,i) = flx2_(m,IDN,k,j,i)*wl(n,i);
-              } else {
-                flx2_(m,n,k,j,i) = flx2_(m,IDN,k,j,i)*wr(n,i);
-              }
+          // calculate fluxes of scalars (if any)
+          if (nvars > nmhd_) {
+            for (int n=nmhd_; n<nvars; ++n) {
+              par_for_inner(member, is, ie, [&](const int i) {
+                if (flx2(m,IDN,k,j,i) >= 0.0) {
+                  flx2(m,n,k,j,i) = flx2(m,IDN,k,j,i)*wl(n,i);
+                } else {
+                  flx2(m,n,k,j,i) = flx2(m,IDN,k,j,i)*wr(n,i);
+                }
+              });
+            }
+          }
+
+          // with fused update, store mass flux and add dF2/dx2 to u0 in cell j-1
+          if constexpr (fused_update_) {
+            member.team_barrier();
+            par_for_inner(member, isx, iex, [&](const int i) {
+              flx2_(m,IDN,k,j,i) = fj(IDN,i);
             });
+            if (j > js && k >= ks && k <= ke) {
+              for (int n=0; n<nvars; ++n) {
+                par_for_inner(member, is, ie, [&](const int i) {
+                  u0_(m,n,k,j-1,i) -= beta_dt*(fj(n,i) - fjm1(n,i))/
+                                      size.d_view(m).dx2;
+                });
+              }
+            }
           }
         }
       } // end of loop over j
@@ -289,7 +361,8 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
 
   if (pmy_pack->pmesh->three_d) {
     scr_size = (ScrArray2D<Real>::shmem_size(nvars, ncells1) +
-                ScrArray2D<Real>::shmem_size(3, ncells1)) * 3;
+                ScrArray2D<Real>::shmem_size(3, ncells1)) * nscr +
+               ScrArray2D<Real>::shmem_size(nvars, ncells1) * 2 * nfscr;
     auto &flx3_ = uflx.x3f;
     auto &bz_ = b0.x3f;
     auto &e23_ = e2x3;
@@ -299,14 +372,25 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
     kl = ks-1, ku = ke+1;
     if (use_fofc) { kl = ks-2, ku = ke+2; }
 
-    par_for_outer("mhd_flux3",DevExeSpace(), scr_size, scr_level, 0, nmb1, js-1, je+1,
+    par_for_outer("mhd_flux3",DevExeSpace(), scr_size, scr_level, 0, nmb1, jsx, jex,
     KOKKOS_LAMBDA(TeamMember_t member, const int m, const int j) {
       ScrArray2D<Real> scr1(member.team_scratch(scr_level), nvars, ncells1);
       ScrArray2D<Real> scr2(member.team_scratch(scr_level), nvars, ncells1);
-      ScrArray2D<Real> scr3(member.team_scratch(scr_level), nvars, ncells1);
+      ScrArray2D<Real> scr3;
+      if constexpr (nscr == 3) {
+        scr3 = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+      }
       ScrArray2D<Real> scr4(member.team_scratch(scr_level), 3, ncells1);
       ScrArray2D<Real> scr5(member.team_scratch(scr_level), 3, ncells1);
-      ScrArray2D<Real> scr6(member.team_scratch(scr_level), 3, ncells1);
+      ScrArray2D<Real> scr6;
+      if constexpr (nscr == 3) {
+        scr6 = ScrArray2D<Real>(member.team_scratch(scr_level), 3, ncells1);
+      }
+      ScrArray2D<Real> fscr1, fscr2;
+      if constexpr (fused_update_) {
+        fscr1 = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+        fscr2 = ScrArray2D<Real>(member.team_scratch(scr_level), nvars, ncells1);
+      }
 
       for (int k=kl; k<=ku; ++k) {
         // Permute scratch arrays.
@@ -322,28 +406,33 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
           bl     = scr5;
           bl_kp1 = scr4;
         }
+        // with donor cell, qR[k] = qL[k+1], so both share the same array
+        if constexpr (nscr == 2) {
+          wr = wl_kp1;
+          br = bl_kp1;
+        }
+        // with fused update, fluxes on faces k and k-1 are kept in scratch
+        auto fk   = fscr1;
+        auto fkm1 = fscr2;
+        if ((k%2) == 0) {
+          fk   = fscr2;
+          fkm1 = fscr1;
+        }
 
         // Reconstruct qR[k] and qL[k+1], for both W and Bcc
-        switch (recon_method_) {
-          case ReconstructionMethod::dc:
-            DonorCellX3(member, m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
-            DonorCellX3(member, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
-            break;
-          case ReconstructionMethod::plm:
-            PiecewiseLinearX3(member, m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
-            PiecewiseLinearX3(member, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
-            break;
-          case ReconstructionMethod::ppm4:
-          case ReconstructionMethod::ppmx:
-            PiecewiseParabolicX3(member,eos_,extrema,true, m,k,j,is-1,ie+1,w0_,wl_kp1,wr);
-            PiecewiseParabolicX3(member,eos_,extrema,false,m,k,j,is-1,ie+1,b0_,bl_kp1,br);
-            break;
-          case ReconstructionMethod::wenoz:
-            WENOZX3(member, eos_, true,  m, k, j, is-1, ie+1, w0_, wl_kp1, wr);
-            WENOZX3(member, eos_, false, m, k, j, is-1, ie+1, b0_, bl_kp1, br);
-            break;
-          default:
-            break;
+        if constexpr (recon_method_ == ReconstructionMethod::dc) {
+          DonorCellX3(member, m, k, j, isx, iex, w0_, wl_kp1, wr);
+          DonorCellX3(member, m, k, j, isx, iex, b0_, bl_kp1, br);
+        } else if constexpr (recon_method_ == ReconstructionMethod::plm) {
+          PiecewiseLinearX3(member, m, k, j, isx, iex, w0_, wl_kp1, wr);
+          PiecewiseLinearX3(member, m, k, j, isx, iex, b0_, bl_kp1, br);
+        } else if constexpr (recon_method_ == ReconstructionMethod::ppm4 ||
+                             recon_method_ == ReconstructionMethod::ppmx) {
+          PiecewiseParabolicX3(member,eos_,extrema,true, m,k,j,isx,iex,w0_,wl_kp1,wr);
+          PiecewiseParabolicX3(member,eos_,extrema,false,m,k,j,isx,iex,b0_,bl_kp1,br);
+        } else if constexpr (recon_method_ == ReconstructionMethod::wenoz) {
+          WENOZX3(member, eos_, true,  m, k, j, isx, iex, w0_, wl_kp1, wr);
+          WENOZX3(member, eos_, false, m, k, j, isx, iex, b0_, bl_kp1, br);
         }
         member.team_barrier();
 
@@ -357,47 +446,63 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
           auto size = size_;
           auto coord = coord_;
           auto bz = bz_;
-          auto flx3 = flx3_;
+          auto flx3 = FluxArray<fused_update_>(flx3_, fk);
           auto e23 = e23_;
           auto e13 = e13_;
           if constexpr (rsolver_method_ == MHD_RSolver::advect) {
             Advect(member,eos,indcs,size,coord,
-                    m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+                    m,k,j,isx,iex,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
           } else if constexpr (rsolver_method_ == MHD_RSolver::llf) {
             LLF(member,eos,indcs,size,coord,
-                    m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+                    m,k,j,isx,iex,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
           } else if constexpr (rsolver_method_ == MHD_RSolver::hlle) {
             HLLE(member,eos,indcs,size,coord,
-                    m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+                    m,k,j,isx,iex,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
           } else if constexpr (rsolver_method_ == MHD_RSolver::hlld) {
             HLLD(member,eos,indcs,size,coord,
-                    m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+                    m,k,j,isx,iex,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
           } else if constexpr (rsolver_method_ == MHD_RSolver::llf_sr) {
             LLF_SR(member,eos,indcs,size,coord,
-                    m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+                    m,k,j,isx,iex,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
           } else if constexpr (rsolver_method_ == MHD_RSolver::hlle_sr) {
             HLLE_SR(member,eos,indcs,size,coord,
-                    m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+                    m,k,j,isx,iex,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
           } else if constexpr (rsolver_method_ == MHD_RSolver::llf_gr) {
             LLF_GR(member,eos,indcs,size,coord,
-                    m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+                    m,k,j,isx,iex,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
           } else if constexpr (rsolver_method_ == MHD_RSolver::hlle_gr) {
             HLLE_GR(member,eos,indcs,size,coord,
-                    m,k,j,is-1,ie+1,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
+                    m,k,j,isx,iex,IVZ,wl,wr,bl,br,bz,flx3,e23,e13);
           }
           member.team_barrier();
-        }
 
-        // calculate fluxes of scalars (if any)
-        if (nvars > nmhd_) {
-          for (int n=nmhd_; n<nvars; ++n) {
-            par_for_inner(member, is, ie, [&](const int i) {
-              if (flx3_(m,IDN,k,j,i) >= 0.0) {
-                flx3_(m,n,k,j,i) = flx3_(m,IDN,k,j,i)*wl(n,i);
-              } else {
-                flx3_(m,n,k,j,i) = flx3_(m,IDN,k,j,i)*wr(n,i);
-              }
+          // calculate fluxes of scalars (if any)
+          if (nvars > nmhd_) {
+            for (int n=nmhd_; n<nvars; ++n) {
+              par_for_inner(member, is, ie, [&](const int i) {
+                if (flx3(m,IDN,k,j,i) >= 0.0) {
+                  flx3(m,n,k,j,i) = flx3(m,IDN,k,j,i)*wl(n,i);
+                } else {
+                  flx3(m,n,k,j,i) = flx3(m,IDN,k,j,i)*wr(n,i);
+                }
+              });
+            }
+          }
+
+          // with fused update, store mass flux and add dF3/dx3 to u0 in cell k-1
+          if constexpr (fused_update_) {
+            member.team_barrier();
+            par_for_inner(member, isx, iex, [&](const int i) {
+              flx3_(m,IDN,k,j,i) = fk(IDN,i);
             });
+            if (k > ks && j >= js && j <= je) {
+              for (int n=0; n<nvars; ++n) {
+                par_for_inner(member, is, ie, [&](const int i) {
+                  u0_(m,n,k-1,j,i) -= beta_dt*(fk(n,i) - fkm1(n,i))/
+                                      size.d_view(m).dx3;
+                });
+              }
+            }
           }
         }
       } // end loop over k
@@ -407,14 +512,73 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void MHD::CalculateFluxes
+//! \brief Selects CalculateFluxes function specialized for reconstruction method (and
+//! fused update).  The choice is made once per call, rather than inside every team of
+//! each flux kernel.
+
+template <MHD_RSolver rsolver_method_>
+void MHD::CalculateFluxes(Driver *pdriver, int stage, const CellRange &rng) {
+  using RM = ReconstructionMethod;
+  switch (recon_method) {
+    case RM::dc:
+      if (fused_update) {
+        CalculateFluxes<rsolver_method_, RM::dc, true>(pdriver, stage, rng);
+      } else {
+        CalculateFluxes<rsolver_method_, RM::dc, false>(pdriver, stage, rng);
+      }
+      break;
+    case RM::plm:
+      if (fused_update) {
+        CalculateFluxes<rsolver_method_, RM::plm, true>(pdriver, stage, rng);
+      } else {
+        CalculateFluxes<rsolver_method_, RM::plm, false>(pdriver, stage, rng);
+      }
+      break;
+    case RM::ppm4:
+      if (fused_update) {
+        CalculateFluxes<rsolver_method_, RM::ppm4, true>(pdriver, stage, rng);
+      } else {
+        CalculateFluxes<rsolver_method_, RM::ppm4, false>(pdriver, stage, rng);
+      }
+      break;
+    case RM::ppmx:
+      if (fused_update) {
+        CalculateFluxes<rsolver_method_, RM::ppmx, true>(pdriver, stage, rng);
+      } else {
+        CalculateFluxes<rsolver_method_, RM::ppmx, false>(pdriver, stage, rng);
+      }
+      break;
+    case RM::wenoz:
+      if (fused_update) {
+        CalculateFluxes<rsolver_method_, RM::wenoz, true>(pdriver, stage, rng);
+      } else {
+        CalculateFluxes<rsolver_method_, RM::wenoz, false>(pdriver, stage, rng);
+      }
+      break;
+    default:
+      break;
+  }
+  return;
+}
+
 // function definitions for each template parameter
-template void MHD::CalculateFluxes<MHD_RSolver::advect>(Driver *pdriver, int stage);
-template void MHD::CalculateFluxes<MHD_RSolver::llf>(Driver *pdriver, int stage);
-template void MHD::CalculateFluxes<MHD_RSolver::hlle>(Driver *pdriver, int stage);
-template void MHD::CalculateFluxes<MHD_RSolver::hlld>(Driver *pdriver, int stage);
-template void MHD::CalculateFluxes<MHD_RSolver::llf_sr>(Driver *pdriver, int stage);
-template void MHD::CalculateFluxes<MHD_RSolver::hlle_sr>(Driver *pdriver, int stage);
-template void MHD::CalculateFluxes<MHD_RSolver::llf_gr>(Driver *pdriver, int stage);
-template void MHD::CalculateFluxes<MHD_RSolver::hlle_gr>(Driver *pdriver, int stage);
+template void MHD::CalculateFluxes<MHD_RSolver::advect>(Driver *pdriver, int stage,
+                                                        const CellRange &rng);
+template void MHD::CalculateFluxes<MHD_RSolver::llf>(Driver *pdriver, int stage,
+                                                     const CellRange &rng);
+template void MHD::CalculateFluxes<MHD_RSolver::hlle>(Driver *pdriver, int stage,
+                                                      const CellRange &rng);
+template void MHD::CalculateFluxes<MHD_RSolver::hlld>(Driver *pdriver, int stage,
+                                                      const CellRange &rng);
+template void MHD::CalculateFluxes<MHD_RSolver::llf_sr>(Driver *pdriver, int stage,
+                                                        const CellRange &rng);
+template void MHD::CalculateFluxes<MHD_RSolver::hlle_sr>(Driver *pdriver, int stage,
+                                                         const CellRange &rng);
+template void MHD::CalculateFluxes<MHD_RSolver::llf_gr>(Driver *pdriver, int stage,
+                                                        const CellRange &rng);
+template void MHD::CalculateFluxes<MHD_RSolver::hlle_gr>(Driver *pdriver, int stage,
+                                                         const CellRange &rng);
 
 } // namespace mhd
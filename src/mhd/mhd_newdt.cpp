@@ -21,6 +21,7 @@
 #include "diffusion/viscosity.hpp"
 #include "diffusion/resistivity.hpp"
 #include "srcterms/srcterms.hpp"
+#include "outputs/history_sums.hpp"
 
 namespace mhd {
 
@@ -53,9 +54,85 @@ TaskStatus MHD::NewTimeStep(Driver *pdriver, int stage) {
   const int nkji = nx3*nx2*nx1;
   const int nji  = nx2*nx1;
 
-  if (pdriver->time_evolution == TimeEvolution::kinematic) {
-    // find smallest (dx/v) in each direction for advection problems
-    Kokkos::parallel_reduce("MHDNudt1",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  // find smallest (dx/v) in each direction for advection problems, and smallest
+  // dx/(v +/- Cf) in each direction for mhd problems
+  bool kinematic = (pdriver->time_evolution == TimeEvolution::kinematic);
+  auto &bcc0_ = bcc0;
+  auto cell_dt = KOKKOS_LAMBDA(const int m, const int k, const int j, const int i,
+                               Real &min_dt1, Real &min_dt2, Real &min_dt3) {
+    Real max_dv1 = 0.0, max_dv2 = 0.0, max_dv3 = 0.0;
+
+    if (kinematic) {
+      max_dv1 = fabs(w0_(m,IVX,k,j,i));
+      max_dv2 = fabs(w0_(m,IVY,k,j,i));
+      max_dv3 = fabs(w0_(m,IVZ,k,j,i));
+    // timestep in GR MHD
+    } else if (is_general_relativistic_ || is_dynamical_relativistic_) {
+      max_dv1 = 1.0;
+      max_dv2 = 1.0;
+      max_dv3 = 1.0;
+    // timestep in SR MHD
+    } else if (is_special_relativistic_) {
+      Real &wd = w0_(m,IDN,k,j,i);
+      Real &ux = w0_(m,IVX,k,j,i);
+      Real &uy = w0_(m,IVY,k,j,i);
+      Real &uz = w0_(m,IVZ,k,j,i);
+      Real &bcc1 = bcc0_(m,IBX,k,j,i);
+      Real &bcc2 = bcc0_(m,IBY,k,j,i);
+      Real &bcc3 = bcc0_(m,IBZ,k,j,i);
+
+      Real v2 = SQR(ux) + SQR(uy) + SQR(uz);
+      Real lor = sqrt(1.0 + v2);
+      // FIXME ERM: Ideal fluid for now
+      Real p = eos.IdealGasPressure(w0_(m,IEN,k,j,i));
+      // Calculate 4-magnetic field in left state
+      Real b_0 = bcc1*ux + bcc2*uy + bcc3*uz;
+      Real b_1 = (bcc1 + b_0 * ux) / lor;
+      Real b_2 = (bcc2 + b_0 * uy) / lor;
+      Real b_3 = (bcc3 + b_0 * uz) / lor;
+      Real b_sq = -SQR(b_0) + SQR(b_1) + SQR(b_2) + SQR(b_3);
+
+      Real lm, lp;
+      eos.IdealSRMHDFastSpeeds(wd, p, ux, lor, b_sq, lp, lm);
+      max_dv1 = fmax(fabs(lm), lp);
+
+      eos.IdealSRMHDFastSpeeds(wd, p, uy, lor, b_sq, lp, lm);
+      max_dv2 = fmax(fabs(lm), lp);
+
+      eos.IdealSRMHDFastSpeeds(wd, p, uz, lor, b_sq, lp, lm);
+      max_dv3 = fmax(fabs(lm), lp);
+    // timestep in Newtonian MHD
+    } else {
+      Real &w_d = w0_(m,IDN,k,j,i);
+      Real &w_bx = bcc0_(m,IBX,k,j,i);
+      Real &w_by = bcc0_(m,IBY,k,j,i);
+      Real &w_bz = bcc0_(m,IBZ,k,j,i);
+      Real cf;
+      if (eos.is_ideal) {
+        Real p = eos.IdealGasPressure(w0_(m,IEN,k,j,i));
+        cf = eos.IdealMHDFastSpeed(w_d, p, w_bx, w_by, w_bz);
+        max_dv1 = fabs(w0_(m,IVX,k,j,i)) + cf;
+        cf = eos.IdealMHDFastSpeed(w_d, p, w_by, w_bz, w_bx);
+        max_dv2 = fabs(w0_(m,IVY,k,j,i)) + cf;
+        cf = eos.IdealMHDFastSpeed(w_d, p, w_bz, w_bx, w_by);
+        max_dv3 = fabs(w0_(m,IVZ,k,j,i)) + cf;
+      } else {
+        cf = eos.IdealMHDFastSpeed(w_d, w_bx, w_by, w_bz);
+        max_dv1 = fabs(w0_(m,IVX,k,j,i)) + cf;
+        cf = eos.IdealMHDFastSpeed(w_d, w_by, w_bz, w_bx);
+        max_dv2 = fabs(w0_(m,IVY,k,j,i)) + cf;
+        cf = eos.IdealMHDFastSpeed(w_d, w_bz, w_bx, w_by);
+        max_dv3 = fabs(w0_(m,IVZ,k,j,i)) + cf;
+      }
+    }
+
+    min_dt1 = fmin((mbsize.d_view(m).dx1/max_dv1), min_dt1);
+    min_dt2 = fmin((mbsize.d_view(m).dx2/max_dv2), min_dt2);
+    min_dt3 = fmin((mbsize.d_view(m).dx3/max_dv3), min_dt3);
+  };
+
+  if (!fuse_hist) {
+    Kokkos::parallel_reduce("MHDNudt",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
     KOKKOS_LAMBDA(const int &idx, Real &min_dt1, Real &min_dt2, Real &min_dt3) {
       // compute m,k,j,i indices of thread and call function
       int m = (idx)/nkji;
@@ -64,17 +141,19 @@ TaskStatus MHD::NewTimeStep(Driver *pdriver, int stage) {
       int i = (idx - m*nkji - k*nji - j*nx1) + is;
       k += ks;
       j += js;
-
-      min_dt1 = fmin((mbsize.d_view(m).dx1/fabs(w0_(m,IVX,k,j,i))), min_dt1);
-      min_dt2 = fmin((mbsize.d_view(m).dx2/fabs(w0_(m,IVY,k,j,i))), min_dt2);
-      min_dt3 = fmin((mbsize.d_view(m).dx3/fabs(w0_(m,IVZ,k,j,i))), min_dt3);
+      cell_dt(m, k, j, i, min_dt1, min_dt2, min_dt3);
     }, Kokkos::Min<Real>(dt1), Kokkos::Min<Real>(dt2),Kokkos::Min<Real>(dt3));
   } else {
-    // find smallest dx/(v +/- Cf) in each direction for mhd problems
-    auto &bcc0_ = bcc0;
-
-    Kokkos::parallel_reduce("MHDNudt2",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-    KOKKOS_LAMBDA(const int &idx, Real &min_dt1, Real &min_dt2, Real &min_dt3) {
+    // history output is due at end of this cycle, so accumulate history sums over
+    // conserved variables in the same sweep (see HistoryOutput::LoadMHDHistoryData)
+    auto &u0_ = u0;
+    auto &b0_ = b0;
+    int nmhd_ = nmhd, nscalars_ = nscalars;
+    bool is_ideal = eos.is_ideal;
+    hist_sums = array_sum::GlobalSum();
+    Kokkos::parallel_reduce("MHDNudtHist",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+    KOKKOS_LAMBDA(const int &idx, Real &min_dt1, Real &min_dt2, Real &min_dt3,
+                  array_sum::GlobalSum &hsum) {
       // compute m,k,j,i indices of thread and call function
       int m = (idx)/nkji;
       int k = (idx - m*nkji)/nji;
@@ -82,72 +161,11 @@ TaskStatus MHD::NewTimeStep(Driver *pdriver, int stage) {
       int i = (idx - m*nkji - k*nji - j*nx1) + is;
       k += ks;
       j += js;
-      Real max_dv1 = 0.0, max_dv2 = 0.0, max_dv3 = 0.0;
-
-      // timestep in GR MHD
-      if (is_general_relativistic_ || is_dynamical_relativistic_) {
-        max_dv1 = 1.0;
-        max_dv2 = 1.0;
-        max_dv3 = 1.0;
-      // timestep in SR MHD
-      } else if (is_special_relativistic_) {
-        Real &wd = w0_(m,IDN,k,j,i);
-        Real &ux = w0_(m,IVX,k,j,i);
-        Real &uy = w0_(m,IVY,k,j,i);
-        Real &uz = w0_(m,IVZ,k,j,i);
-        Real &bcc1 = bcc0_(m,IBX,k,j,i);
-        Real &bcc2 = bcc0_(m,IBY,k,j,i);
-        Real &bcc3 = bcc0_(m,IBZ,k,j,i);
-
-        Real v2 = SQR(ux) + SQR(uy) + SQR(uz);
-        Real lor = sqrt(1.0 + v2);
-        // FIXME ERM: Ideal fluid for now
-        Real p = eos.IdealGasPressure(w0_(m,IEN,k,j,i));
-        // Calculate 4-magnetic field in left state
-        Real b_0 = bcc1*ux + bcc2*uy + bcc3*uz;
-        Real b_1 = (bcc1 + b_0 * ux) / lor;
-        Real b_2 = (bcc2 + b_0 * uy) / lor;
-        Real b_3 = (bcc3 + b_0 * uz) / lor;
-        Real b_sq = -SQR(b_0) + SQR(b_1) + SQR(b_2) + SQR(b_3);
-
-        Real lm, lp;
-        eos.IdealSRMHDFastSpeeds(wd, p, ux, lor, b_sq, lp, lm);
-        max_dv1 = fmax(fabs(lm), lp);
-
-        eos.IdealSRMHDFastSpeeds(wd, p, uy, lor, b_sq, lp, lm);
-        max_dv2 = fmax(fabs(lm), lp);
-
-        eos.IdealSRMHDFastSpeeds(wd, p, uz, lor, b_sq, lp, lm);
-        max_dv3 = fmax(fabs(lm), lp);
-      // timestep in Newtonian MHD
-      } else {
-        Real &w_d = w0_(m,IDN,k,j,i);
-        Real &w_bx = bcc0_(m,IBX,k,j,i);
-        Real &w_by = bcc0_(m,IBY,k,j,i);
-        Real &w_bz = bcc0_(m,IBZ,k,j,i);
-        Real cf;
-        if (eos.is_ideal) {
-          Real p = eos.IdealGasPressure(w0_(m,IEN,k,j,i));
-          cf = eos.IdealMHDFastSpeed(w_d, p, w_bx, w_by, w_bz);
-          max_dv1 = fabs(w0_(m,IVX,k,j,i)) + cf;
-          cf = eos.IdealMHDFastSpeed(w_d, p, w_by, w_bz, w_bx);
-          max_dv2 = fabs(w0_(m,IVY,k,j,i)) + cf;
-          cf = eos.IdealMHDFastSpeed(w_d, p, w_bz, w_bx, w_by);
-          max_dv3 = fabs(w0_(m,IVZ,k,j,i)) + cf;
-        } else {
-          cf = eos.IdealMHDFastSpeed(w_d, w_bx, w_by, w_bz);
-          max_dv1 = fabs(w0_(m,IVX,k,j,i)) + cf;
-          cf = eos.IdealMHDFastSpeed(w_d, w_by, w_bz, w_bx);
-          max_dv2 = fabs(w0_(m,IVY,k,j,i)) + cf;
-          cf = eos.IdealMHDFastSpeed(w_d, w_bz, w_bx, w_by);
-          max_dv3 = fabs(w0_(m,IVZ,k,j,i)) + cf;
-        }
-      }
-
-      min_dt1 = fmin((mbsize.d_view(m).dx1/max_dv1), min_dt1);
-      min_dt2 = fmin((mbsize.d_view(m).dx2/max_dv2), min_dt2);
-      min_dt3 = fmin((mbsize.d_view(m).dx3/max_dv3), min_dt3);
-    }, Kokkos::Min<Real>(dt1), Kokkos::Min<Real>(dt2),Kokkos::Min<Real>(dt3));
+      cell_dt(m, k, j, i, min_dt1, min_dt2, min_dt3);
+      Real vol = mbsize.d_view(m).dx1*mbsize.d_view(m).dx2*mbsize.d_view(m).dx3;
+      MHDHistorySums(u0_, b0_, m, k, j, i, vol, nmhd_, nscalars_, is_ideal, hsum);
+    }, Kokkos::Min<Real>(dt1), Kokkos::Min<Real>(dt2),Kokkos::Min<Real>(dt3),
+       Kokkos::Sum<array_sum::GlobalSum>(hist_sums));
   }
 
   // compute minimum of dt1/dt2/dt3 for 1D/2D/3D problems
@@ -34,51 +34,106 @@ namespace mhd {
 //! \brief Adds mhd tasks to appropriate task lists used by time integrators.
 //! Called by MeshBlockPack::AddPhysics() function directly after MHD constructor
 //! See comments Hydro::AssembleHydroTasks() function for more details.
+//!
+//! With <mhd>/split_phase=true the fluxes and update of the interior cells, and the
+//! EMFs and CT, are computed while U for the shell of active cells within ng cells of
+//! MeshBlock faces is being communicated.  ConsToPrim of the active cells then overlaps
+//! the communication of B.
 
 void MHD::AssembleMHDTasks(std::map<std::string, std::shared_ptr<TaskList>> tl) {
   TaskID none(0);
 
   // assemble "before_timeintegrator" task list
-  id.savest = tl["before_timeintegrator"]->AddTask(&MHD::SaveMHDState, this, none);
+  id.savest = tl["before_timeintegrator"]->AddTask(&MHD::SaveMHDState, this, none,
+                                                   "MHD::SaveMHDState");
 
   // assemble "before_stagen" task list
-  id.irecv = tl["before_stagen"]->AddTask(&MHD::InitRecv, this, none);
+  id.irecv = tl["before_stagen"]->AddTask(&MHD::InitRecv, this, none, "MHD::InitRecv");
+
+  // assemble "stagen" task list with split-phase updates.  Note id.flux and id.rkupdt
+  // refer to the shell, so that tasks inserted between them (e.g. turbulence driving)
+  // still precede the update of all active cells.
+  if (split_phase) {
+    pmy_pack->pmesh->SplitPhaseRanges(shell_rng, interior_rng, ghost_rng);
+    id.copyu      = tl["stagen"]->AddTask(&MHD::CopyCons, this, none, "MHD::CopyCons");
+    id.flux       = tl["stagen"]->AddTask(&MHD::FluxesShell, this, id.copyu,
+                                          "MHD::FluxesShell");
+    id.rkupdt     = tl["stagen"]->AddTask(&MHD::RKUpdateShell, this, id.flux,
+                                          "MHD::RKUpdateShell");
+    id.sendu      = tl["stagen"]->AddTask(&MHD::SendU, this, id.rkupdt, "MHD::SendU");
+    id.flux_int   = tl["stagen"]->AddTask(&MHD::FluxesInterior, this, id.sendu,
+                                          "MHD::FluxesInterior");
+    id.rkupdt_int = tl["stagen"]->AddTask(&MHD::RKUpdateInterior, this, id.flux_int,
+                                          "MHD::RKUpdateInterior");
+    id.efld       = tl["stagen"]->AddTask(&MHD::EField, this, id.rkupdt_int,
+                                          "MHD::EField");
+    id.sende      = tl["stagen"]->AddTask(&MHD::SendE, this, id.efld, "MHD::SendE");
+    id.recve      = tl["stagen"]->AddTask(&MHD::RecvE, this, id.sende, "MHD::RecvE");
+    id.ct         = tl["stagen"]->AddTask(&MHD::CT, this, id.recve, "MHD::CT");
+    id.sendb      = tl["stagen"]->AddTask(&MHD::SendB, this, id.ct, "MHD::SendB");
+    id.c2p_int    = tl["stagen"]->AddTask(&MHD::ConToPrimActive, this, id.sendb,
+                                          "MHD::ConToPrimActive");
+    id.recvu      = tl["stagen"]->AddTask(&MHD::RecvU, this, id.c2p_int, "MHD::RecvU");
+    id.recvb      = tl["stagen"]->AddTask(&MHD::RecvB, this, id.recvu, "MHD::RecvB");
+    id.bcs        = tl["stagen"]->AddTask(&MHD::ApplyPhysicalBCs, this, id.recvb,
+                                          "MHD::ApplyPhysicalBCs");
+    id.c2p        = tl["stagen"]->AddTask(&MHD::ConToPrimGhost, this, id.bcs,
+                                          "MHD::ConToPrimGhost");
+    id.newdt      = tl["stagen"]->AddTask(&MHD::NewTimeStep, this, id.c2p,
+                                          "MHD::NewTimeStep");
+
+    // assemble "after_stagen" task list
+    id.csend = tl["after_stagen"]->AddTask(&MHD::ClearSend, this, none, "MHD::ClearSend");
+    id.crecv = tl["after_stagen"]->AddTask(&MHD::ClearRecv, this, id.csend,
+                                           "MHD::ClearRecv");
+    return;
+  }
 
   // assemble "stagen" task list
-  id.copyu     = tl["stagen"]->AddTask(&MHD::CopyCons, this, none);
-  id.flux      = tl["stagen"]->AddTask(&MHD::Fluxes, this, id.copyu);
-  id.sendf     = tl["stagen"]->AddTask(&MHD::SendFlux, this, id.flux);
-  id.recvf     = tl["stagen"]->AddTask(&MHD::RecvFlux, this, id.sendf);
-  id.rkupdt    = tl["stagen"]->AddTask(&MHD::RKUpdate, this, id.recvf);
-  id.srctrms   = tl["stagen"]->AddTask(&MHD::MHDSrcTerms, this, id.rkupdt);
-  id.sendu_oa  = tl["stagen"]->AddTask(&MHD::SendU_OA, this, id.srctrms);
-  id.recvu_oa  = tl["stagen"]->AddTask(&MHD::RecvU_OA, this, id.sendu_oa);
-  id.restu     = tl["stagen"]->AddTask(&MHD::RestrictU, this, id.recvu_oa);
-  id.sendu     = tl["stagen"]->AddTask(&MHD::SendU, this, id.restu);
-  id.recvu     = tl["stagen"]->AddTask(&MHD::RecvU, this, id.sendu);
-  id.sendu_shr = tl["stagen"]->AddTask(&MHD::SendU_Shr, this, id.recvu);
-  id.recvu_shr = tl["stagen"]->AddTask(&MHD::RecvU_Shr, this, id.sendu_shr);
-  id.efld      = tl["stagen"]->AddTask(&MHD::EField, this, id.recvu_shr);
-  id.sende     = tl["stagen"]->AddTask(&MHD::SendE, this, id.efld);
-  id.recve     = tl["stagen"]->AddTask(&MHD::RecvE, this, id.sende);
-  id.ct        = tl["stagen"]->AddTask(&MHD::CT, this, id.recve);
-  id.sendb_oa  = tl["stagen"]->AddTask(&MHD::SendB_OA, this, id.ct);
-  id.recvb_oa  = tl["stagen"]->AddTask(&MHD::RecvB_OA, this, id.sendb_oa);
-  id.restb     = tl["stagen"]->AddTask(&MHD::RestrictB, this, id.recvb_oa);
-  id.sendb     = tl["stagen"]->AddTask(&MHD::SendB, this, id.restb);
-  id.recvb     = tl["stagen"]->AddTask(&MHD::RecvB, this, id.sendb);
-  id.sendb_shr = tl["stagen"]->AddTask(&MHD::SendB_Shr, this, id.recvb);
-  id.recvb_shr = tl["stagen"]->AddTask(&MHD::RecvB_Shr, this, id.sendb_shr);
-  id.bcs       = tl["stagen"]->AddTask(&MHD::ApplyPhysicalBCs, this, id.recvb_shr);
-  id.prol      = tl["stagen"]->AddTask(&MHD::Prolongate, this, id.bcs);
-  id.c2p       = tl["stagen"]->AddTask(&MHD::ConToPrim, this, id.prol);
-  id.newdt     = tl["stagen"]->AddTask(&MHD::NewTimeStep, this, id.c2p);
+  id.copyu     = tl["stagen"]->AddTask(&MHD::CopyCons, this, none, "MHD::CopyCons");
+  id.flux      = tl["stagen"]->AddTask(&MHD::Fluxes, this, id.copyu, "MHD::Fluxes");
+  id.sendf     = tl["stagen"]->AddTask(&MHD::SendFlux, this, id.flux, "MHD::SendFlux");
+  id.recvf     = tl["stagen"]->AddTask(&MHD::RecvFlux, this, id.sendf, "MHD::RecvFlux");
+  id.rkupdt    = tl["stagen"]->AddTask(&MHD::RKUpdate, this, id.recvf, "MHD::RKUpdate");
+  id.srctrms   = tl["stagen"]->AddTask(&MHD::MHDSrcTerms, this, id.rkupdt,
+                                       "MHD::MHDSrcTerms");
+  id.sendu_oa  = tl["stagen"]->AddTask(&MHD::SendU_OA, this, id.srctrms, "MHD::SendU_OA");
+  id.recvu_oa  = tl["stagen"]->AddTask(&MHD::RecvU_OA, this, id.sendu_oa,
+                                       "MHD::RecvU_OA");
+  id.restu     = tl["stagen"]->AddTask(&MHD::RestrictU, this, id.recvu_oa,
+                                       "MHD::RestrictU");
+  id.sendu     = tl["stagen"]->AddTask(&MHD::SendU, this, id.restu, "MHD::SendU");
+  id.recvu     = tl["stagen"]->AddTask(&MHD::RecvU, this, id.sendu, "MHD::RecvU");
+  id.sendu_shr = tl["stagen"]->AddTask(&MHD::SendU_Shr, this, id.recvu, "MHD::SendU_Shr");
+  id.recvu_shr = tl["stagen"]->AddTask(&MHD::RecvU_Shr, this, id.sendu_shr,
+                                       "MHD::RecvU_Shr");
+  id.efld      = tl["stagen"]->AddTask(&MHD::EField, this, id.recvu_shr, "MHD::EField");
+  id.sende     = tl["stagen"]->AddTask(&MHD::SendE, this, id.efld, "MHD::SendE");
+  id.recve     = tl["stagen"]->AddTask(&MHD::RecvE, this, id.sende, "MHD::RecvE");
+  id.ct        = tl["stagen"]->AddTask(&MHD::CT, this, id.recve, "MHD::CT");
+  id.sendb_oa  = tl["stagen"]->AddTask(&MHD::SendB_OA, this, id.ct, "MHD::SendB_OA");
+  id.recvb_oa  = tl["stagen"]->AddTask(&MHD::RecvB_OA, this, id.sendb_oa,
+                                       "MHD::RecvB_OA");
+  id.restb     = tl["stagen"]->AddTask(&MHD::RestrictB, this, id.recvb_oa,
+                                       "MHD::RestrictB");
+  id.sendb     = tl["stagen"]->AddTask(&MHD::SendB, this, id.restb, "MHD::SendB");
+  id.recvb     = tl["stagen"]->AddTask(&MHD::RecvB, this, id.sendb, "MHD::RecvB");
+  id.sendb_shr = tl["stagen"]->AddTask(&MHD::SendB_Shr, this, id.recvb, "MHD::SendB_Shr");
+  id.recvb_shr = tl["stagen"]->AddTask(&MHD::RecvB_Shr, this, id.sendb_shr,
+                                       "MHD::RecvB_Shr");
+  id.bcs       = tl["stagen"]->AddTask(&MHD::ApplyPhysicalBCs, this, id.recvb_shr,
+                                       "MHD::ApplyPhysicalBCs");
+  id.prol      = tl["stagen"]->AddTask(&MHD::Prolongate, this, id.bcs, "MHD::Prolongate");
+  id.c2p       = tl["stagen"]->AddTask(&MHD::ConToPrim, this, id.prol, "MHD::ConToPrim");
+  id.newdt     = tl["stagen"]->AddTask(&MHD::NewTimeStep, this, id.c2p,
+                                       "MHD::NewTimeStep");
 
   // assemble "after_stagen" task list
-  id.csend = tl["after_stagen"]->AddTask(&MHD::ClearSend, this, none);
+  id.csend = tl["after_stagen"]->AddTask(&MHD::ClearSend, this, none, "MHD::ClearSend");
   // although RecvFlux/U/E/B functions check that all recvs complete, add ClearRecv to
   // task list anyways to catch potential bugs in MPI communication logic
-  id.crecv = tl["after_stagen"]->AddTask(&MHD::ClearRecv, this, id.csend);
+  id.crecv = tl["after_stagen"]->AddTask(&MHD::ClearRecv, this, id.csend,
+                                         "MHD::ClearRecv");
 
   return;
 }
@@ -175,24 +230,9 @@ TaskStatus MHD::CopyCons(Driver *pdrive, int stage) {
 //! of conserved variables
 
 TaskStatus MHD::Fluxes(Driver *pdrive, int stage) {
-  // select which calculate_flux function to call based on rsolver_method
-  if (rsolver_method == MHD_RSolver::advect) {
-    CalculateFluxes<MHD_RSolver::advect>(pdrive, stage);
-  } else if (rsolver_method == MHD_RSolver::llf) {
-    CalculateFluxes<MHD_RSolver::llf>(pdrive, stage);
-  } else if (rsolver_method == MHD_RSolver::hlle) {
-    CalculateFluxes<MHD_RSolver::hlle>(pdrive, stage);
-  } else if (rsolver_method == MHD_RSolver::hlld) {
-    CalculateFluxes<MHD_RSolver::hlld>(pdrive, stage);
-  } else if (rsolver_method == MHD_RSolver::llf_sr) {
-    CalculateFluxes<MHD_RSolver::llf_sr>(pdrive, stage);
-  } else if (rsolver_method == MHD_RSolver::hlle_sr) {
-    CalculateFluxes<MHD_RSolver::hlle_sr>(pdrive, stage);
-  } else if (rsolver_method == MHD_RSolver::llf_gr) {
-    CalculateFluxes<MHD_RSolver::llf_gr>(pdrive, stage);
-  } else if (rsolver_method == MHD_RSolver::hlle_gr) {
-    CalculateFluxes<MHD_RSolver::hlle_gr>(pdrive, stage);
-  }
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  CellRange active = {indcs.is, indcs.ie, indcs.js, indcs.je, indcs.ks, indcs.ke};
+  FluxesOverRange(pdrive, stage, active);
 
   // Add diffusive fluxes
   if (pcond != nullptr) {
@@ -217,6 +257,81 @@ TaskStatus MHD::Fluxes(Driver *pdrive, int stage) {
   return TaskStatus::complete;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void MHD::FluxesOverRange
+//! \brief Calls CalculateFluxes function appropriate to rsolver_method over all faces of
+//! cells in range rng
+
+void MHD::FluxesOverRange(Driver *pdrive, int stage, const CellRange &rng) {
+  // select which calculate_flux function to call based on rsolver_method
+  if (rsolver_method == MHD_RSolver::advect) {
+    CalculateFluxes<MHD_RSolver::advect>(pdrive, stage, rng);
+  } else if (rsolver_method == MHD_RSolver::llf) {
+    CalculateFluxes<MHD_RSolver::llf>(pdrive, stage, rng);
+  } else if (rsolver_method == MHD_RSolver::hlle) {
+    CalculateFluxes<MHD_RSolver::hlle>(pdrive, stage, rng);
+  } else if (rsolver_method == MHD_RSolver::hlld) {
+    CalculateFluxes<MHD_RSolver::hlld>(pdrive, stage, rng);
+  } else if (rsolver_method == MHD_RSolver::llf_sr) {
+    CalculateFluxes<MHD_RSolver::llf_sr>(pdrive, stage, rng);
+  } else if (rsolver_method == MHD_RSolver::hlle_sr) {
+    CalculateFluxes<MHD_RSolver::hlle_sr>(pdrive, stage, rng);
+  } else if (rsolver_method == MHD_RSolver::llf_gr) {
+    CalculateFluxes<MHD_RSolver::llf_gr>(pdrive, stage, rng);
+  } else if (rsolver_method == MHD_RSolver::hlle_gr) {
+    CalculateFluxes<MHD_RSolver::hlle_gr>(pdrive, stage, rng);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::FluxesShell
+//! \brief Wrapper task list function used with split-phase updates that computes fluxes
+//! and face-centered EMFs for active cells within ng cells of MeshBlock faces
+
+TaskStatus MHD::FluxesShell(Driver *pdrive, int stage) {
+  for (auto &rng : shell_rng) {
+    FluxesOverRange(pdrive, stage, rng);
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::FluxesInterior
+//! \brief Wrapper task list function used with split-phase updates that computes fluxes
+//! and face-centered EMFs for interior active cells (not in shell)
+
+TaskStatus MHD::FluxesInterior(Driver *pdrive, int stage) {
+  if (!(interior_rng.IsEmpty())) {
+    FluxesOverRange(pdrive, stage, interior_rng);
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::RKUpdateShell
+//! \brief Wrapper task list function used with split-phase updates that performs RK
+//! update of active cells within ng cells of MeshBlock faces
+
+TaskStatus MHD::RKUpdateShell(Driver *pdrive, int stage) {
+  for (auto &rng : shell_rng) {
+    RKUpdateOverRange(pdrive, stage, rng);
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::RKUpdateInterior
+//! \brief Wrapper task list function used with split-phase updates that performs RK
+//! update of interior active cells (not in shell)
+
+TaskStatus MHD::RKUpdateInterior(Driver *pdrive, int stage) {
+  if (!(interior_rng.IsEmpty())) {
+    RKUpdateOverRange(pdrive, stage, interior_rng);
+  }
+  return TaskStatus::complete;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn TaskStatus MHD::SendFlux
 //! \brief Wrapper task list function to pack/send restricted values of fluxes of
@@ -553,6 +668,31 @@ TaskStatus MHD::ConToPrim(Driver *pdrive, int stage) {
   return TaskStatus::complete;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::ConToPrimActive
+//! \brief Wrapper task list function used with split-phase updates to call ConsToPrim
+//! over active cells, while boundary communications are in flight
+
+TaskStatus MHD::ConToPrimActive(Driver *pdrive, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  peos->ConsToPrim(u0, b0, w0, bcc0, false, indcs.is, indcs.ie, indcs.js, indcs.je,
+                   indcs.ks, indcs.ke);
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::ConToPrimGhost
+//! \brief Wrapper task list function used with split-phase updates to call ConsToPrim
+//! over ghost cells, after boundary values have been received and set
+
+TaskStatus MHD::ConToPrimGhost(Driver *pdrive, int stage) {
+  for (auto &rng : ghost_rng) {
+    peos->ConsToPrim(u0, b0, w0, bcc0, false, rng.il, rng.iu, rng.jl, rng.ju,
+                     rng.kl, rng.ku);
+  }
+  return TaskStatus::complete;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn TaskStatus MHD::ClearSend
 //! \brief Wrapper task list function that checks all MPI sends have completed. Used in
@@ -191,12 +191,13 @@ void SingleStateLLF_SRMHD(const MHDPrim1D &wl, const MHDPrim1D &wr, const Real &
 
 //----------------------------------------------------------------------------------------
 //! \fn void SingleStateLLF_GRMHD
-//! \brief The LLF Riemann solver for GR MHD for a single L/R state
+//! \brief The LLF Riemann solver for GR MHD for a single L/R state, given the metric
+//! at the interface
 
 KOKKOS_INLINE_FUNCTION
 void SingleStateLLF_GRMHD(const MHDPrim1D wl, const MHDPrim1D wr, const Real bx,
-                          const Real x1v, const Real x2v, const Real x3v, const int ivx,
-                          const CoordData &coord, const EOS_Data &eos, MHDCons1D &flux) {
+                          const Real glower[][4], const Real gupper[][4], const int ivx,
+                          const EOS_Data &eos, MHDCons1D &flux) {
   // Cyclic permutation of array indices
   int ivy = IVX + ((ivx-IVX)+1)%3;
   int ivz = IVX + ((ivx-IVX)+2)%3;
@@ -225,10 +226,6 @@ void SingleStateLLF_GRMHD(const MHDPrim1D wl, const MHDPrim1D wr, const Real bx,
   // reference to longitudinal field
   const Real &bxi = bx;
 
-  // Extract components of metric
-  Real glower[4][4], gupper[4][4];
-  ComputeMetricAndInverse(x1v,x2v,x3v,coord.is_minkowski, coord.bh_spin, glower, gupper);
-
   // Calculate 4-velocity in left state (contravariant compt)
   Real q = glower[ivx][ivx] * SQR(wl_ivx) + glower[ivy][ivy] * SQR(wl_ivy) +
            glower[ivz][ivz] * SQR(wl_ivz) + 2.0*glower[ivx][ivy] * wl_ivx * wl_ivy +
@@ -395,5 +392,19 @@ void SingleStateLLF_GRMHD(const MHDPrim1D wl, const MHDPrim1D wr, const Real bx,
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void SingleStateLLF_GRMHD
+//! \brief As above, but computes the metric at the given interface position
+
+KOKKOS_INLINE_FUNCTION
+void SingleStateLLF_GRMHD(const MHDPrim1D wl, const MHDPrim1D wr, const Real bx,
+                          const Real x1v, const Real x2v, const Real x3v, const int ivx,
+                          const CoordData &coord, const EOS_Data &eos, MHDCons1D &flux) {
+  Real glower[4][4], gupper[4][4];
+  ComputeMetricAndInverse(x1v,x2v,x3v,coord.is_minkowski, coord.bh_spin, glower, gupper);
+  SingleStateLLF_GRMHD(wl, wr, bx, glower, gupper, ivx, eos, flux);
+  return;
+}
+
 } // namespace mhd
 #endif // MHD_RSOLVERS_LLF_MHD_SINGLESTATE_HPP_
@@ -708,6 +708,20 @@ BaseTypeOutput::BaseTypeOutput(ParameterInput *pin, Mesh *pm, OutputParameters o
   noutmbs.assign(global_variable::nranks, 0);
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn bool BaseTypeOutput::OutputDue()
+//! \brief returns true if output should be made at the given time and cycle, either
+//! because time has reached next output time, or cycle is a multiple of dcycle
+
+bool BaseTypeOutput::OutputDue(Real time, int ncycle, Real tlim) {
+  // compare at floating point (32-bit) precision to reduce effect of round off
+  float time_32 = static_cast<float>(time);
+  float next_32 = static_cast<float>(out_params.last_time + out_params.dt);
+  float tlim_32 = static_cast<float>(tlim);
+  return (((out_params.dt > 0.0) && ((time_32 >= next_32) && (time_32 < tlim_32))) ||
+          ((out_params.dcycle > 0) && (ncycle%(out_params.dcycle) == 0)));
+}
+
 //----------------------------------------------------------------------------------------
 // BaseTypeOutput::LoadOutputData()
 // create std::vector of HostArray3Ds containing data specified in <output> block for
@@ -717,7 +731,60 @@ void BaseTypeOutput::LoadOutputData(Mesh *pm) {
   // out_data_ vector (indexed over # of output MBs) stores 4D array of variables
   // so start iteration over number of MeshBlocks
   // TODO(@user): get this working for multiple physics, which may be either defined/undef
+  SetOutputMeshBlocks(pm);
+
+  // get number of output vars and MBs, then realloc outarray (HostArray)
+  int nout_vars = outvars.size();
+  int nout_mbs = outmbs.size();
+  // note that while ois,oie,etc. can be different on each MB, the number of cells output
+  // on each MeshBlock, i.e. (ois-ois+1), etc. is the same.
+  if (nout_mbs > 0) {
+    int nout1 = (outmbs[0].oie - outmbs[0].ois + 1);
+    int nout2 = (outmbs[0].oje - outmbs[0].ojs + 1);
+    int nout3 = (outmbs[0].oke - outmbs[0].oks + 1);
+    // NB: outarray stores all output data on Host
+    Kokkos::realloc(outarray, nout_vars, nout_mbs, nout3, nout2, nout1);
+  }
+
+  // Calculate derived variables, if required
+  if (out_params.contains_derived) {
+    ComputeDerivedVariable(out_params.variable, pm);
+  }
 
+  // Now copy data to host (outarray) over all variables and MeshBlocks
+  for (int n=0; n<nout_vars; ++n) {
+    for (int m=0; m<nout_mbs; ++m) {
+      int mbi = pm->FindMeshBlockIndex(outmbs[m].mb_gid);
+      std::pair<int,int> irange = std::make_pair(outmbs[m].ois, outmbs[m].oie+1);
+      std::pair<int,int> jrange = std::make_pair(outmbs[m].ojs, outmbs[m].oje+1);
+      std::pair<int,int> krange = std::make_pair(outmbs[m].oks, outmbs[m].oke+1);
+      int nout1 = (outmbs[0].oie - outmbs[0].ois + 1);
+      int nout2 = (outmbs[0].oje - outmbs[0].ojs + 1);
+      int nout3 = (outmbs[0].oke - outmbs[0].oks + 1);
+
+      // copy output variable to new device View
+      DvceArray3D<Real> d_output_var("d_out_var",nout3,nout2,nout1);
+      auto d_slice = Kokkos::subview(*(outvars[n].data_ptr), mbi, outvars[n].data_index,
+                                     krange,jrange,irange);
+      Kokkos::deep_copy(d_output_var,d_slice);
+
+      // copy new device View to host mirror View
+      DvceArray3D<Real>::HostMirror h_output_var = Kokkos::create_mirror(d_output_var);
+      Kokkos::deep_copy(h_output_var,d_output_var);
+
+      // copy host mirror to 5D host View containing all output variables
+      auto h_slice = Kokkos::subview(outarray,n,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
+      Kokkos::deep_copy(h_slice,h_output_var);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------
+// BaseTypeOutput::SetOutputMeshBlocks()
+// computes list of output MeshBlocks (outmbs) on this rank, including the range of
+// indices output on each, and number of output MeshBlocks on every rank (noutmbs)
+
+void BaseTypeOutput::SetOutputMeshBlocks(Mesh *pm) {
   // With AMR, number and location of output MBs can change between output times.
   // So start with clean vector of output MeshBlock info, and re-compute
   outmbs.clear();
@@ -800,50 +867,75 @@ void BaseTypeOutput::LoadOutputData(Mesh *pm) {
 #endif
   noutmbs_min = *std::min_element(noutmbs.begin(), noutmbs.end());
   noutmbs_max = *std::max_element(noutmbs.begin(), noutmbs.end());
+}
 
-
-  // get number of output vars and MBs, then realloc outarray (HostArray)
+//----------------------------------------------------------------------------------------
+// BaseTypeOutput::PackOutputData()
+// converts all output variables on all output MeshBlocks to float on the device, stored
+// as 32-bit words in d_outwords with dims (m,word).  Variable n of output MB m starts at
+// word nhead + n*(# of output cells per MB), leaving the first nhead words of each MB
+// for a header to be filled on the host.  Words are byte-swapped if swap_bytes=true.
+// The packed data is then copied to the pinned host buffer h_outwords in one transfer.
+// Both buffers are only reallocated when the size of the output changes.
+
+void BaseTypeOutput::PackOutputData(Mesh *pm, int nhead, bool swap_bytes) {
   int nout_vars = outvars.size();
   int nout_mbs = outmbs.size();
-  // note that while ois,oie,etc. can be different on each MB, the number of cells output
-  // on each MeshBlock, i.e. (ois-ois+1), etc. is the same.
-  if (nout_mbs > 0) {
-    int nout1 = (outmbs[0].oie - outmbs[0].ois + 1);
-    int nout2 = (outmbs[0].oje - outmbs[0].ojs + 1);
-    int nout3 = (outmbs[0].oke - outmbs[0].oks + 1);
-    // NB: outarray stores all output data on Host
-    Kokkos::realloc(outarray, nout_vars, nout_mbs, nout3, nout2, nout1);
+  if (nout_mbs == 0) return;
+  int nout1 = (outmbs[0].oie - outmbs[0].ois + 1);
+  int nout2 = (outmbs[0].oje - outmbs[0].ojs + 1);
+  int nout3 = (outmbs[0].oke - outmbs[0].oks + 1);
+  int ncells = nout1*nout2*nout3;
+  int nwords = nhead + nout_vars*ncells;
+  if (d_outwords.extent_int(0) != nout_mbs || d_outwords.extent_int(1) != nwords) {
+    Kokkos::realloc(d_outwords, nout_mbs, nwords);
+    Kokkos::realloc(h_outwords, nout_mbs, nwords);
   }
 
-  // Calculate derived variables, if required
-  if (out_params.contains_derived) {
-    ComputeDerivedVariable(out_params.variable, pm);
+  // index of each output MB in MeshBlockPack, and start indices of output data
+  DualArray2D<int> omb("out_mbs", nout_mbs, 4);
+  for (int m=0; m<nout_mbs; ++m) {
+    omb.h_view(m,0) = pm->FindMeshBlockIndex(outmbs[m].mb_gid);
+    omb.h_view(m,1) = outmbs[m].ois;
+    omb.h_view(m,2) = outmbs[m].ojs;
+    omb.h_view(m,3) = outmbs[m].oks;
   }
-
-  // Now copy data to host (outarray) over all variables and MeshBlocks
-  for (int n=0; n<nout_vars; ++n) {
-    for (int m=0; m<nout_mbs; ++m) {
-      int mbi = pm->FindMeshBlockIndex(outmbs[m].mb_gid);
-      std::pair<int,int> irange = std::make_pair(outmbs[m].ois, outmbs[m].oie+1);
-      std::pair<int,int> jrange = std::make_pair(outmbs[m].ojs, outmbs[m].oje+1);
-      std::pair<int,int> krange = std::make_pair(outmbs[m].oks, outmbs[m].oke+1);
-      int nout1 = (outmbs[0].oie - outmbs[0].ois + 1);
-      int nout2 = (outmbs[0].oje - outmbs[0].ojs + 1);
-      int nout3 = (outmbs[0].oke - outmbs[0].oks + 1);
-
-      // copy output variable to new device View
-      DvceArray3D<Real> d_output_var("d_out_var",nout3,nout2,nout1);
-      auto d_slice = Kokkos::subview(*(outvars[n].data_ptr), mbi, outvars[n].data_index,
-                                     krange,jrange,irange);
-      Kokkos::deep_copy(d_output_var,d_slice);
-
-      // copy new device View to host mirror View
-      DvceArray3D<Real>::HostMirror h_output_var = Kokkos::create_mirror(d_output_var);
-      Kokkos::deep_copy(h_output_var,d_output_var);
-
-      // copy host mirror to 5D host View containing all output variables
-      auto h_slice = Kokkos::subview(outarray,n,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
-      Kokkos::deep_copy(h_slice,h_output_var);
-    }
+  omb.template modify<HostMemSpace>();
+  omb.template sync<DevExeSpace>();
+
+  // launch one kernel for each distinct device array containing output variables, which
+  // packs all variables stored in that array (usually all variables in one kernel)
+  std::vector<bool> packed(nout_vars, false);
+  auto words = d_outwords;
+  for (int n0=0; n0<nout_vars; ++n0) {
+    if (packed[n0]) continue;
+    std::vector<int> vars;
+    for (int n=n0; n<nout_vars; ++n) {
+      if (outvars[n].data_ptr == outvars[n0].data_ptr) {vars.push_back(n);}
+    }
+    int nvars = vars.size();
+    DualArray2D<int> ovar("out_vars", nvars, 2);
+    for (int v=0; v<nvars; ++v) {
+      ovar.h_view(v,0) = vars[v];
+      ovar.h_view(v,1) = outvars[vars[v]].data_index;
+      packed[vars[v]] = true;
+    }
+    ovar.template modify<HostMemSpace>();
+    ovar.template sync<DevExeSpace>();
+
+    auto src = *(outvars[n0].data_ptr);
+    par_for("out_pack", DevExeSpace(), 0, nout_mbs-1, 0, nvars-1, 0, nout3-1, 0, nout2-1,
+            0, nout1-1, KOKKOS_LAMBDA(int m, int v, int k, int j, int i) {
+      float var = static_cast<float>(src(omb.d_view(m,0), ovar.d_view(v,1),
+                                         k + omb.d_view(m,3), j + omb.d_view(m,2),
+                                         i + omb.d_view(m,1)));
+      uint32_t word = Kokkos::bit_cast<uint32_t>(var);
+      if (swap_bytes) {
+        word = (word >> 24) | ((word >> 8) & 0x0000ff00u) |
+               ((word << 8) & 0x00ff0000u) | (word << 24);
+      }
+      words(m, nhead + ovar.d_view(v,0)*ncells + (k*nout2 + j)*nout1 + i) = word;
+    });
   }
+  Kokkos::deep_copy(h_outwords, d_outwords);
 }
@@ -0,0 +1,212 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file bin_prtcl.cpp
+//! \brief writes particle data in binary format.
+//!
+//! The selected particles are packed on the device, and written directly from a pinned
+//! host buffer by all ranks into a single file with collective MPI-IO.  The offset of
+//! each rank is given by an exclusive scan of the number of particles output by ranks.
+//! The file consists of a text header, followed by each field as an array of 4-byte
+//! values (float for real data, int32 for integer data) over all output particles, in
+//! order of rank and then index of particle on the rank.
+
+#include <sys/stat.h>  // mkdir
+
+#include <cstdint>
+#include <cstdio>      // snprintf
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "parameter_input.hpp"
+#include "mesh/mesh.hpp"
+#include "particles/particles.hpp"
+#include "outputs.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+//----------------------------------------------------------------------------------------
+// ctor: also calls BaseTypeOutput base class constructor
+// Parses list of output fields and particle selection
+
+ParticleBinaryOutput::ParticleBinaryOutput(ParameterInput *pin, Mesh *pm,
+                                           OutputParameters op) :
+  BaseTypeOutput(pin, pm, op) {
+  mkdir("pbin",0775);
+  particles::Particles *pp = pm->pmb_pack->ppart;
+
+  // names of real and integer particle data, in order of ParticlesIndex
+  const char *rnames[6] = {"x", "vx", "y", "vy", "z", "vz"};
+  const char *inames[2] = {"gid", "tag"};
+  std::string fields = pin->GetOrAddString(op.block_name, "fields", "all");
+  if (fields.compare("all") == 0) {
+    for (int n=0; n<pp->nrdata; ++n) {field_names.push_back(rnames[n]);}
+    for (int n=0; n<pp->nidata; ++n) {field_names.push_back(inames[n]);}
+  } else {
+    std::stringstream ss(fields);
+    std::string name;
+    while (std::getline(ss, name, ',')) {
+      name.erase(0, name.find_first_not_of(" \t"));
+      name.erase(name.find_last_not_of(" \t") + 1);
+      if (!name.empty()) {field_names.push_back(name);}
+    }
+  }
+  for (auto &name : field_names) {
+    int index = std::numeric_limits<int>::min();
+    for (int n=0; n<pp->nrdata; ++n) {
+      if (name.compare(rnames[n]) == 0) {index = n;}
+    }
+    for (int n=0; n<pp->nidata; ++n) {
+      if (name.compare(inames[n]) == 0) {index = -(1+n);}
+    }
+    if (index == std::numeric_limits<int>::min()) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "Particle field '" << name << "' in <output> block '"
+          << op.block_name << "' is not defined for this particle type" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    field_index.push_back(index);
+  }
+
+  tag_min = pin->GetOrAddInteger(op.block_name, "tag_min", 0);
+  tag_max = pin->GetOrAddInteger(op.block_name, "tag_max",
+                                 std::numeric_limits<int>::max());
+  stride = pin->GetOrAddInteger(op.block_name, "stride", 1);
+  if (stride < 1 || tag_max < tag_min) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "<output> block '" << op.block_name << "' must have stride >= 1"
+        << " and tag_max >= tag_min" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ParticleBinaryOutput::LoadOutputData()
+//! \brief selects particles and packs their data into 4-byte words on the device, then
+//! copies them to the pinned host buffer in a single transfer.
+
+void ParticleBinaryOutput::LoadOutputData(Mesh *pm) {
+  particles::Particles *pp = pm->pmb_pack->ppart;
+  int npart = pm->nprtcl_thisrank;
+  int nfield = field_index.size();
+  auto &pr = pp->prtcl_rdata;
+  auto &pi = pp->prtcl_idata;
+  int tmin = tag_min, tmax = tag_max, strd = stride;
+
+  // exclusive scan over selected particles gives their index in output arrays
+  DvceArray1D<int> d_index("pbin_index", npart);
+  int nsel = 0;
+  Kokkos::parallel_scan("pbin_scan", Kokkos::RangePolicy<DevExeSpace>(0, npart),
+  KOKKOS_LAMBDA(const int p, int &partial, const bool final) {
+    int tag = pi(PTAG,p);
+    bool sel = (tag >= tmin) && (tag <= tmax) && ((tag - tmin) % strd == 0);
+    if (final) {d_index(p) = sel ? partial : -1;}
+    if (sel) {partial += 1;}
+  }, nsel);
+  npout_thisrank = nsel;
+
+  // pack selected fields, as floats or ints, into output array
+  DualArray1D<int> findex("pbin_fields", nfield);
+  for (int f=0; f<nfield; ++f) {findex.h_view(f) = field_index[f];}
+  findex.template modify<HostMemSpace>();
+  findex.template sync<DevExeSpace>();
+  DvceArray2D<uint32_t> d_outprtcl("d_outprtcl", nfield, npout_thisrank);
+  par_for("pbin_pack", DevExeSpace(), 0, nfield-1, 0, npart-1,
+  KOKKOS_LAMBDA(const int f, const int p) {
+    int q = d_index(p);
+    if (q < 0) return;
+    int index = findex.d_view(f);
+    if (index >= 0) {
+      d_outprtcl(f,q) = Kokkos::bit_cast<uint32_t>(static_cast<float>(pr(index,p)));
+    } else {
+      d_outprtcl(f,q) = Kokkos::bit_cast<uint32_t>(
+                          static_cast<std::int32_t>(pi(-(1+index),p)));
+    }
+  });
+  Kokkos::realloc(h_outprtcl, nfield, npout_thisrank);
+  Kokkos::deep_copy(h_outprtcl, d_outprtcl);
+
+  // offset of this rank in output arrays, and total number of output particles
+  std::int64_t nout = npout_thisrank;
+  npout_offset = 0;
+  npout_total = nout;
+#if MPI_PARALLEL_ENABLED
+  MPI_Exscan(&nout, &npout_offset, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+  if (global_variable::my_rank == 0) {npout_offset = 0;}
+  MPI_Allreduce(&nout, &npout_total, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ParticleBinaryOutput::WriteOutputFile()
+//! \brief writes header, then each rank writes its particles for each field with
+//! collective MPI-IO.
+
+void ParticleBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
+  // create filename: "pbin/file_basename"."file_id"."XXXXX".pbin
+  // where XXXXX = 5-digit file_number
+  char number[6];
+  std::snprintf(number, sizeof(number), "%05d", out_params.file_number);
+  std::string fname = std::string("pbin/") + out_params.file_basename + "."
+                    + out_params.file_id + "." + number + ".pbin";
+  IOWrapper partfile;
+  partfile.Open(fname.c_str(), IOWrapper::FileMode::write);
+
+  int nfield = field_index.size();
+  std::stringstream msg;
+  msg << "Athena particle binary output version=1.0" << std::endl
+      << std::scientific
+      << std::setprecision(std::numeric_limits<Real>::max_digits10 - 1)
+      << "  time=" << pm->time << std::endl
+      << "  cycle=" << pm->ncycle << std::endl
+      << "  number of particles=" << npout_total << std::endl
+      << "  tag range=" << tag_min << " " << tag_max << std::endl
+      << "  stride=" << stride << std::endl
+      << "  size of field=4" << std::endl
+      << "  number of fields=" << nfield << std::endl
+      << "  fields:  ";
+  for (int f=0; f<nfield; ++f) {msg << field_names[f] << "  ";}
+  msg << std::endl << "  types:  ";
+  for (int f=0; f<nfield; ++f) {msg << ((field_index[f] >= 0) ? "f  " : "i  ");}
+  msg << std::endl;
+  std::string header = msg.str();
+  if (global_variable::my_rank == 0) {
+    partfile.Write_any_type(header.c_str(), header.size(), "byte");
+  }
+
+  // write data of each field at offset of this rank
+  for (int f=0; f<nfield; ++f) {
+    std::size_t offset = header.size() + sizeof(uint32_t)*
+                         (static_cast<std::size_t>(f)*npout_total + npout_offset);
+    std::size_t nbytes = sizeof(uint32_t)*npout_thisrank;
+    const uint32_t *data = h_outprtcl.data() + static_cast<std::size_t>(f)*npout_thisrank;
+    if (partfile.Write_any_type_at_all(data, nbytes, offset, "byte") != nbytes) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "particle data not written correctly to binary particle file, "
+          << "file is broken." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  partfile.Close();
+
+  // increment counters
+  out_params.file_number++;
+  if (out_params.last_time < 0.0) {
+    out_params.last_time = pm->time;
+  } else {
+    out_params.last_time += out_params.dt;
+  }
+  pin->SetInteger(out_params.block_name, "file_number", out_params.file_number);
+  pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
+}
@@ -6,9 +6,24 @@
 //! \file binary.cpp
 //! \brief writes output data in binary format, which simply consists of each MeshBlock
 //! written contiguously in order of "gid" in binary format.
+//!
+//! With <output>/indexed=true (file format version=1.2) an index is appended after the
+//! MeshBlock records, so that readers can locate any MeshBlock or variable directly:
+//!   - magic "AKBINIDX", number of MeshBlock records N, number of variables nvar
+//!   - nvar offsets of each variable from the start of a MeshBlock record
+//!   - N entries of: record offset from start of file, gid, level, lx1, lx2, lx3,
+//!     ois, oie, ojs, oje, oks, oke, x1min, x1max, x2min, x2max, x3min, x3max
+//!   - trailer: offset of index from start of file, magic "AKBINIDX"
+//! All integers are int32 except offsets and counts (uint64), bounds are Real.
+//!
+//! With <output>/compression=lossy (file format version=1.3) each variable in a record
+//! is replaced by a compressed chunk (see lossy_compress.hpp), so records differ in size.
+//! The index is then always written, and the nvar offsets of the variables are stored at
+//! the end of each index entry instead of once after the number of variables.
 
 #include <sys/stat.h>  // mkdir
 
+#include <cstdint>
 #include <cstdio>      // fwrite(), fclose(), fopen(), fnprintf(), snprintf()
 #include <cstdlib>
 #include <iomanip>
@@ -25,6 +40,11 @@
 #include "coordinates/cell_locations.hpp"
 #include "mesh/mesh.hpp"
 #include "outputs.hpp"
+#include "lossy_compress.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
 
 //----------------------------------------------------------------------------------------
 // Constructor: also calls BaseTypeOutput base class constructor
@@ -44,6 +64,23 @@ MeshBinaryOutput::MeshBinaryOutput(ParameterInput *pin, Mesh *pm, OutputParamete
   }
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBinaryOutput::LoadOutputData(Mesh *pm)
+//! \brief Packs output data of all MeshBlocks into binary records on the device, and
+//! copies them to host with a single transfer.  Headers of the records are filled in by
+//! WriteOutputFile().
+
+void MeshBinaryOutput::LoadOutputData(Mesh *pm) {
+  SetOutputMeshBlocks(pm);
+  if (out_params.contains_derived) {
+    ComputeDerivedVariable(out_params.variable, pm);
+  }
+  // ois, oie, ojs, oje, oks, oke + il1, il2, il3, level +
+  // x1min, x1max, x2min, x2max, x3min, x3max
+  int nhead = (10*sizeof(int32_t) + 6*sizeof(Real))/sizeof(float);
+  PackOutputData(pm, nhead, false);
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void MeshBinaryOutput:::WriteOutputFile(Mesh *pm)
 //  \brief Cycles over all MeshBlocks and writes OutputData in binary format
@@ -74,54 +111,6 @@ void MeshBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
           + "." + out_params.file_id + number + ".bin";
   }
 
-  IOWrapper binfile;
-  std::size_t header_offset=0;
-  binfile.Open(fname.c_str(), IOWrapper::FileMode::write, single_file_per_rank);
-
-  // Basic parts of the format:
-  // 1. Size of the header
-  // 2. Current time
-  // 3. List of variables in the file
-  // 4. Header (input file information)
-  {
-    std::stringstream msg;
-    const int time_precision = std::numeric_limits<Real>::max_digits10 - 1;
-    msg << "Athena binary output version=1.1" << std::endl
-        // preheader size includes "size of preheader" line up to "number of variables"
-        << "  size of preheader=5" << std::endl
-        << std::scientific << std::setprecision(time_precision)
-        << "  time=" << pm->time << std::endl
-        << "  cycle=" << pm->ncycle << std::endl
-        << "  size of location=" << sizeof(Real) << std::endl
-        << "  size of variable=" << sizeof(float) << std::endl
-        << "  number of variables=" << outvars.size() << std::endl
-        << "  variables:  ";
-    for (size_t n=0; n<outvars.size(); n++) {
-      msg << outvars[n].label.c_str() << "  ";
-    }
-    msg << std::endl;
-    if (global_variable::my_rank == 0 || single_file_per_rank) {
-      binfile.Write_any_type(msg.str().c_str(),msg.str().size(),"byte",
-                             single_file_per_rank);
-    }
-    header_offset += msg.str().size();
-  }
-  {
-    std::stringstream msg;
-    // prepare the input parameters
-    std::stringstream ost;
-    pin->ParameterDump(ost);
-    std::string sbuf=ost.str();
-    msg << "  header offset=" << sbuf.size()*sizeof(char)  << std::endl;
-    if (global_variable::my_rank == 0 || single_file_per_rank) {
-      binfile.Write_any_type(msg.str().c_str(),msg.str().size(),"byte",
-                             single_file_per_rank);
-      binfile.Write_any_type(sbuf.c_str(),sbuf.size(),"byte", single_file_per_rank);
-    }
-    header_offset += sbuf.size()*sizeof(char);
-    header_offset += msg.str().size();
-  }
-
   //  5. Data.  An arbitrary number of scalars and vectors can be written (every element
   //  of the outvars vector), all in binary floats format
 
@@ -141,11 +130,10 @@ void MeshBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
                         + (cells*nout_vars)*sizeof(float);
 
   int ns_mbs = pm->gids_eachrank[global_variable::my_rank];
-  int nb_mbs = pm->nmb_eachrank[global_variable::my_rank];
 
-  // allocate 1D vector of floats used to convert and output data
-  char *data = new char[nb_mbs*data_size];
-  float *single_data = new float[cells];
+  // data of each MeshBlock was converted to float and packed into a record on the device
+  // by LoadOutputData(), leaving room for the header of each record, filled in below
+  char *data = reinterpret_cast<char *>(h_outwords.data());
 
   // Loop over MeshBlocks
   for (int m=0; m<nout_mbs; ++m) {
@@ -212,28 +200,120 @@ void MeshBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     pdata+=sizeof(xv);
     xv = outmbs[m].x3max;
     memcpy(pdata,&(xv),sizeof(xv));
-    pdata+=sizeof(xv);
+  }
 
-    // output variables
-    float tmp_data;
-    for (int n=0; n<nout_vars; n++) {
-      int cnt=0;
-      for (int k=oks; k<=oke; k++) {
-        for (int j=ojs; j<=oje; j++) {
-          for (int i=ois; i<=oie; i++) {
-            tmp_data = static_cast<float>(outarray(n,m,k-oks,j-ojs,i-ois));
-            single_data[cnt] = tmp_data;
-            cnt++;
-          }
-        }
+  // with lossy compression, compress each variable of each MeshBlock into variable
+  // size records, and find largest error over all ranks for the header
+  std::vector<char> cdata;
+  std::vector<std::uint64_t> rec_offset, var_offset;
+  double max_error = 0.0;
+  if (out_params.lossy) {
+    for (int m=0; m<nout_mbs; ++m) {
+      char *pdata=&(data[m*data_size]);
+      rec_offset.push_back(cdata.size());
+      std::size_t var_start = data_size - cells*nout_vars*sizeof(float);
+      cdata.insert(cdata.end(), pdata, pdata + var_start);
+      int nout1 = outmbs[m].oie - outmbs[m].ois + 1;
+      int nout2 = outmbs[m].oje - outmbs[m].ojs + 1;
+      int nout3 = outmbs[m].oke - outmbs[m].oks + 1;
+      const float *pvars = reinterpret_cast<const float *>(pdata + var_start);
+      for (int n=0; n<nout_vars; ++n) {
+        var_offset.push_back(cdata.size() - rec_offset[m]);
+        double err = lossy_compress::CompressChunk(&(pvars[n*cells]), nout1, nout2, nout3,
+                       out_params.error_bound, out_params.relative_error, cdata);
+        max_error = std::max(max_error, err);
       }
-      memcpy(pdata,single_data,cells*sizeof(float));
-      pdata+=cells*sizeof(float);
     }
+#if MPI_PARALLEL_ENABLED
+    MPI_Allreduce(MPI_IN_PLACE, &max_error, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#endif
+  }
+
+  IOWrapper binfile;
+  binfile.SetAsync(pasync_writer);  // nullptr unless <output>/async=true
+  std::size_t header_offset=0;
+  binfile.Open(fname.c_str(), IOWrapper::FileMode::write, single_file_per_rank);
+
+  // Basic parts of the format:
+  // 1. Size of the header
+  // 2. Current time
+  // 3. List of variables in the file
+  // 4. Header (input file information)
+  {
+    std::stringstream msg;
+    const int time_precision = std::numeric_limits<Real>::max_digits10 - 1;
+    const char *version = out_params.lossy ? "1.3" : (out_params.indexed ? "1.2" : "1.1");
+    msg << "Athena binary output version=" << version << std::endl
+        // preheader size includes "size of preheader" line up to "number of variables"
+        << "  size of preheader=" << (out_params.lossy ? 9 : 5) << std::endl
+        << std::scientific << std::setprecision(time_precision)
+        << "  time=" << pm->time << std::endl
+        << "  cycle=" << pm->ncycle << std::endl
+        << "  size of location=" << sizeof(Real) << std::endl
+        << "  size of variable=" << sizeof(float) << std::endl;
+    if (out_params.lossy) {
+      msg << "  compression=lossy" << std::endl
+          << "  error bound=" << out_params.error_bound << std::endl
+          << "  error type=" << (out_params.relative_error ? "relative" : "absolute")
+          << std::endl
+          << "  max error=" << max_error << std::endl;
+    }
+    msg << "  number of variables=" << outvars.size() << std::endl
+        << "  variables:  ";
+    for (size_t n=0; n<outvars.size(); n++) {
+      msg << outvars[n].label.c_str() << "  ";
+    }
+    msg << std::endl;
+    if (global_variable::my_rank == 0 || single_file_per_rank) {
+      binfile.Write_any_type(msg.str().c_str(),msg.str().size(),"byte",
+                             single_file_per_rank);
+    }
+    header_offset += msg.str().size();
+  }
+  {
+    std::stringstream msg;
+    // prepare the input parameters
+    std::stringstream ost;
+    pin->ParameterDump(ost);
+    std::string sbuf=ost.str();
+    msg << "  header offset=" << sbuf.size()*sizeof(char)  << std::endl;
+    if (global_variable::my_rank == 0 || single_file_per_rank) {
+      binfile.Write_any_type(msg.str().c_str(),msg.str().size(),"byte",
+                             single_file_per_rank);
+      binfile.Write_any_type(sbuf.c_str(),sbuf.size(),"byte", single_file_per_rank);
+    }
+    header_offset += sbuf.size()*sizeof(char);
+    header_offset += msg.str().size();
   }
 
   // now write binary data
-  if (bin_slice) {
+  std::uint64_t index_offset = 0;
+  if (out_params.lossy) {
+    // offset of records of this rank, and total size of records of all ranks
+    std::uint64_t mysize = cdata.size(), myoffset = 0, total_size = mysize;
+#if MPI_PARALLEL_ENABLED
+    if (!single_file_per_rank) {
+      std::vector<std::uint64_t> rank_size(global_variable::nranks);
+      MPI_Allgather(&mysize, 1, MPI_UINT64_T, rank_size.data(), 1, MPI_UINT64_T,
+                    MPI_COMM_WORLD);
+      myoffset = std::accumulate(rank_size.begin(),
+                                 rank_size.begin() + global_variable::my_rank,
+                                 static_cast<std::uint64_t>(0));
+      total_size = std::accumulate(rank_size.begin(), rank_size.end(),
+                                   static_cast<std::uint64_t>(0));
+    }
+#endif
+    myoffset += header_offset;
+    if (noutmbs_min > 0) {
+      binfile.Write_any_type_at_all(cdata.data(), cdata.size(), myoffset, "byte",
+                                    single_file_per_rank);
+    } else if (nout_mbs > 0) {
+      binfile.Write_any_type_at(cdata.data(), cdata.size(), myoffset, "byte",
+                                single_file_per_rank);
+    }
+    for (auto &offset : rec_offset) {offset += myoffset;}
+    index_offset = header_offset + total_size;
+  } else if (bin_slice) {
     std::vector<int> rank_offset(global_variable::nranks, 0);
     std::partial_sum(noutmbs.begin(),std::prev(noutmbs.end()),
                      std::next(rank_offset.begin()));
@@ -254,13 +334,13 @@ void MeshBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     }
   } else {
     // check if elements larger than 2^31
-    if (data_size*nb_mbs<=2147483648) {
+    if (data_size*nout_mbs<=2147483648) {
       // now write binary data in parallel
       std::size_t myoffset = header_offset;
       if (!single_file_per_rank) {
         myoffset += data_size*ns_mbs;
       }
-      binfile.Write_any_type_at_all(data,(data_size*nb_mbs),myoffset,"byte",
+      binfile.Write_any_type_at_all(data,(data_size*nout_mbs),myoffset,"byte",
                                     single_file_per_rank);
     } else {
       // write data over each MeshBlock sequentially and in parallel
@@ -300,10 +380,28 @@ void MeshBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     }
   }
 
+  if (out_params.indexed) {
+    if (!(out_params.lossy)) {
+      // records of fixed size, so offsets of records and variables follow from data_size
+      std::uint64_t first_mb = 0, nfile_mbs = nout_mbs;
+      if (!single_file_per_rank) {
+        first_mb = std::accumulate(noutmbs.begin(),
+                                   noutmbs.begin() + global_variable::my_rank, 0);
+        nfile_mbs = std::accumulate(noutmbs.begin(), noutmbs.end(), 0);
+      }
+      for (int m=0; m<nout_mbs; ++m) {
+        rec_offset.push_back(header_offset + data_size*(first_mb + m));
+      }
+      for (int n=0; n<nout_vars; ++n) {
+        var_offset.push_back(data_size - (nout_vars - n)*cells*sizeof(float));
+      }
+      index_offset = header_offset + data_size*nfile_mbs;
+    }
+    WriteIndex(pm, binfile, index_offset, rec_offset, var_offset);
+  }
+
   // close the output file and clean up ptrs to data
   binfile.Close(single_file_per_rank);
-  delete [] data;
-  delete [] single_data;
 
   // increment counters
   out_params.file_number++;
@@ -317,3 +415,87 @@ void MeshBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
 
   return;
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBinaryOutput::WriteIndex()
+//! \brief writes index of MeshBlock records starting at index_offset.  Each rank writes
+//! the index entries of its own MeshBlocks, in the same order as the records.
+//! rec_offset holds the offset of each record of this rank in the file, and var_offset
+//! the offset of each variable from the start of a record: one per variable, or with
+//! lossy compression one per variable for every record.
+
+void MeshBinaryOutput::WriteIndex(Mesh *pm, IOWrapper &binfile,
+                                  std::uint64_t index_offset,
+                                  const std::vector<std::uint64_t> &rec_offset,
+                                  const std::vector<std::uint64_t> &var_offset) {
+  bool single_file_per_rank = out_params.single_file_per_rank;
+  const char magic[8] = {'A','K','B','I','N','I','D','X'};
+  int nout_vars = outvars.size();
+  int nout_mbs = outmbs.size();
+
+  // position of first MB of this rank in file, and total number of MBs in file
+  std::uint64_t first_mb = 0, nfile_mbs = nout_mbs;
+  if (!single_file_per_rank) {
+    first_mb = std::accumulate(noutmbs.begin(),
+                               noutmbs.begin() + global_variable::my_rank, 0);
+    nfile_mbs = std::accumulate(noutmbs.begin(), noutmbs.end(), 0);
+  }
+  // variable offsets are stored in the header, or with lossy compression in each entry
+  int nhead_vars = (out_params.lossy) ? 0 : nout_vars;
+  int nentry_vars = (out_params.lossy) ? nout_vars : 0;
+  std::size_t head_size = sizeof(magic) + (2 + nhead_vars)*sizeof(std::uint64_t);
+  std::size_t entry_size = sizeof(std::uint64_t) + 11*sizeof(int32_t) + 6*sizeof(Real)
+                         + nentry_vars*sizeof(std::uint64_t);
+
+  // index header and trailer, written by root (or every rank for file-per-rank)
+  if (global_variable::my_rank == 0 || single_file_per_rank) {
+    std::vector<char> head(head_size);
+    char *phead = head.data();
+    memcpy(phead, magic, sizeof(magic));
+    phead += sizeof(magic);
+    std::uint64_t nx[2] = {nfile_mbs, static_cast<std::uint64_t>(nout_vars)};
+    memcpy(phead, nx, sizeof(nx));
+    phead += sizeof(nx);
+    memcpy(phead, var_offset.data(), nhead_vars*sizeof(std::uint64_t));
+    binfile.Write_any_type_at(head.data(), head_size, index_offset, "byte",
+                              single_file_per_rank);
+
+    char trailer[sizeof(std::uint64_t) + sizeof(magic)];
+    memcpy(trailer, &index_offset, sizeof(index_offset));
+    memcpy(trailer + sizeof(index_offset), magic, sizeof(magic));
+    binfile.Write_any_type_at(trailer, sizeof(trailer),
+                              index_offset + head_size + entry_size*nfile_mbs, "byte",
+                              single_file_per_rank);
+  }
+
+  // index entries of MBs on this rank
+  std::vector<char> entries(nout_mbs*entry_size);
+  for (int m=0; m<nout_mbs; ++m) {
+    char *pdata = &(entries[m*entry_size]);
+    LogicalLocation loc = pm->lloc_eachmb[outmbs[m].mb_gid];
+    memcpy(pdata, &(rec_offset[m]), sizeof(std::uint64_t));
+    pdata += sizeof(std::uint64_t);
+    int32_t ix[11] = {outmbs[m].mb_gid, loc.level - pm->root_level,
+                      loc.lx1, loc.lx2, loc.lx3,
+                      outmbs[m].ois, outmbs[m].oie, outmbs[m].ojs, outmbs[m].oje,
+                      outmbs[m].oks, outmbs[m].oke};
+    memcpy(pdata, ix, sizeof(ix));
+    pdata += sizeof(ix);
+    Real xv[6] = {outmbs[m].x1min, outmbs[m].x1max, outmbs[m].x2min,
+                  outmbs[m].x2max, outmbs[m].x3min, outmbs[m].x3max};
+    memcpy(pdata, xv, sizeof(xv));
+    pdata += sizeof(xv);
+    if (nentry_vars > 0) {
+      memcpy(pdata, &(var_offset[m*nout_vars]), nentry_vars*sizeof(std::uint64_t));
+    }
+  }
+  std::size_t myoffset = index_offset + head_size + entry_size*first_mb;
+  if (noutmbs_min > 0) {
+    binfile.Write_any_type_at_all(entries.data(), entries.size(), myoffset, "byte",
+                                  single_file_per_rank);
+  } else if (nout_mbs > 0) {
+    binfile.Write_any_type_at(entries.data(), entries.size(), myoffset, "byte",
+                              single_file_per_rank);
+  }
+  return;
+}
@@ -0,0 +1,185 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file burst_buffer.cpp
+//! \brief implements BurstBuffer class, which drains restart files written to a
+//! node-local directory to the shared filesystem on a background thread.
+
+#include <unistd.h>  // fsync
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "burst_buffer.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+//----------------------------------------------------------------------------------------
+//! \fn BurstBuffer::BurstBuffer()
+//! \brief constructor, starts the drain thread.  'first_file_number' is the number of
+//! the first checkpoint that will be drained by this run.
+
+BurstBuffer::BurstBuffer(const std::string &manifest_fname, int first_file_number) :
+  manifest_fname_(manifest_fname),
+  last_in_manifest_(first_file_number - 1),
+  last_drained_(first_file_number - 1) {
+  thread_ = std::thread(&BurstBuffer::Run, this);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn BurstBuffer::~BurstBuffer()
+//! \brief destructor, finishes draining all queued files and stops the drain thread.
+//! Checkpoints drained after the last call to UpdateManifest() are not recorded in the
+//! manifest, since that requires communication between ranks.
+
+BurstBuffer::~BurstBuffer() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  thread_.join();
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BurstBuffer::Submit()
+//! \brief queues a file to be drained.  Files are drained in the order submitted.
+
+void BurstBuffer::Submit(const std::string &local_fname, const std::string &shared_fname,
+                         int file_number) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push_back({local_fname, shared_fname, file_number});
+  }
+  if (global_variable::my_rank == 0) {pending_[file_number] = shared_fname;}
+  cv_.notify_all();
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BurstBuffer::UpdateManifest()
+//! \brief finds newest checkpoint drained by every rank, and root process appends all
+//! checkpoints up to it to the manifest.  Must be called by all ranks.
+
+void BurstBuffer::UpdateManifest(bool wait) {
+  int drained;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (wait) {cv_.wait(lock, [this] {return queue_.empty();});}
+    drained = last_drained_;
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Allreduce(MPI_IN_PLACE, &drained, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+#endif
+  if (drained <= last_in_manifest_) return;
+  if (global_variable::my_rank == 0) {
+    std::ofstream manifest(manifest_fname_, std::ios::app);
+    for (auto it = pending_.begin(); it != pending_.end() && it->first <= drained; ) {
+      manifest << it->second << std::endl;
+      it = pending_.erase(it);
+    }
+    if (!manifest.good()) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Could not append to checkpoint manifest '"
+                << manifest_fname_ << "'" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+  }
+  last_in_manifest_ = drained;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BurstBuffer::Run()
+//! \brief main loop of drain thread: drains each queued file in turn
+
+void BurstBuffer::Run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cv_.wait(lock, [this] {return !queue_.empty() || stop_;});
+    if (queue_.empty()) break;
+    // copy without holding lock; job stays at front of queue until it is drained
+    DrainJob job = queue_.front();
+    lock.unlock();
+    auto start = std::chrono::steady_clock::now();
+    Drain(job);
+    std::chrono::duration<double> dt = std::chrono::steady_clock::now() - start;
+    lock.lock();
+    drain_time += dt.count();
+    nfiles++;
+    last_drained_ = job.file_number;
+    queue_.pop_front();
+    cv_.notify_all();
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BurstBuffer::Drain()
+//! \brief copies local file to a temporary file on the shared filesystem, which is
+//! renamed once it is complete and synced, and then deletes the local file.
+
+void BurstBuffer::Drain(const DrainJob &job) {
+  std::string tmp_fname = job.shared_fname + ".part";
+  FILE *in = std::fopen(job.local_fname.c_str(), "rb");
+  FILE *out = std::fopen(tmp_fname.c_str(), "wb");
+  if (in == nullptr || out == nullptr) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Could not open '" << job.local_fname << "' or '"
+              << tmp_fname << "' to drain checkpoint" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  std::vector<char> buf(16*1024*1024);
+  std::size_t nread;
+  bool ok = true;
+  while ((nread = std::fread(buf.data(), 1, buf.size(), in)) > 0) {
+    if (std::fwrite(buf.data(), 1, nread, out) != nread) {ok = false; break;}
+  }
+  ok = ok && !std::ferror(in) && (std::fflush(out) == 0) && (fsync(fileno(out)) == 0);
+  std::fclose(in);
+  ok = (std::fclose(out) == 0) && ok;
+  if (!ok || std::rename(tmp_fname.c_str(), job.shared_fname.c_str()) != 0) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Failed to drain checkpoint '" << job.local_fname
+              << "' to '" << job.shared_fname << "'" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  std::remove(job.local_fname.c_str());
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn std::string LatestCheckpoint()
+//! \brief returns the newest (last) checkpoint listed in a manifest.  Called by all
+//! ranks; only the root process reads the manifest.
+
+std::string LatestCheckpoint(const std::string &manifest_fname) {
+  std::string latest;
+  if (global_variable::my_rank == 0) {
+    std::ifstream manifest(manifest_fname);
+    std::string line;
+    while (std::getline(manifest, line)) {
+      if (!line.empty()) {latest = line;}
+    }
+  }
+#if MPI_PARALLEL_ENABLED
+  int len = latest.size();
+  MPI_Bcast(&len, 1, MPI_INT, 0, MPI_COMM_WORLD);
+  latest.resize(len);
+  MPI_Bcast(&(latest[0]), len, MPI_CHAR, 0, MPI_COMM_WORLD);
+#endif
+  if (latest.empty()) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "No complete checkpoint found in manifest '"
+              << manifest_fname << "'" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  return latest;
+}
@@ -0,0 +1,65 @@
+#ifndef OUTPUTS_BURST_BUFFER_HPP_
+#define OUTPUTS_BURST_BUFFER_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file burst_buffer.hpp
+//  \brief node-local checkpoint tier for restart files.
+//
+// With <output>/local_dir set in the restart output block, each rank writes its restart
+// file to a node-local directory (e.g. /tmp or a local NVMe), and the run continues
+// immediately.  A background thread on each rank then copies ("drains") the file to the
+// shared rst/rank_XXXXXXXX/ directory and deletes the local copy.  Once a checkpoint has
+// been drained by all ranks, its name is appended to the manifest rst/basename.manifest.
+// Starting a run with '-r rst/basename.manifest' restarts from the newest checkpoint in
+// the manifest, i.e. the newest checkpoint that is complete on the shared filesystem.
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+//----------------------------------------------------------------------------------------
+//! \class BurstBuffer
+//  \brief owns the drain thread of one rank, and the manifest of drained checkpoints
+
+class BurstBuffer {
+ public:
+  BurstBuffer(const std::string &manifest_fname, int first_file_number);
+  ~BurstBuffer();
+
+  // queue copy of local file to shared filesystem; does not block
+  void Submit(const std::string &local_fname, const std::string &shared_fname,
+              int file_number);
+  // collective: appends checkpoints drained on all ranks to manifest, after waiting for
+  // all queued copies to complete if wait=true
+  void UpdateManifest(bool wait);
+
+  int nfiles = 0;              // number of files drained by this rank
+  double drain_time = 0.0;     // time spent by drain thread copying files
+
+ private:
+  struct DrainJob {
+    std::string local_fname, shared_fname;
+    int file_number;
+  };
+  std::string manifest_fname_;
+  std::map<int, std::string> pending_;  // checkpoints not yet in manifest (root only)
+  int last_in_manifest_;                // newest file_number written to manifest
+  int last_drained_;                    // newest file_number drained by this rank
+  std::deque<DrainJob> queue_;
+  bool stop_ = false;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::thread thread_;
+  void Run();
+  void Drain(const DrainJob &job);
+};
+
+std::string LatestCheckpoint(const std::string &manifest_fname);
+
+#endif // OUTPUTS_BURST_BUFFER_HPP_
@@ -9,9 +9,9 @@
 #include <sys/stat.h>  // mkdir
 
 #include <cstdio> // snprintf
-#include <fstream>
 #include <string>
 #include <sstream>
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -74,24 +74,27 @@ void CartesianGridOutput::LoadOutputData(Mesh *pm) {
         Kokkos::subview(outarray, n, 0, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL);
     Kokkos::deep_copy(v_slice, pcart->interp_vals.h_view);
   }
-#if MPI_PARALLEL_ENABLED
-  // Note that InterpolateToGrid will set zero values for points not owned by
-  // current rank
-  int count = nout_vars * md.numpoints[0] * md.numpoints[1] * md.numpoints[2];
-  if (0 == global_variable::my_rank) {
-    MPI_Reduce(MPI_IN_PLACE, outarray.data(), count, MPI_ATHENA_REAL, MPI_SUM,
-               0, MPI_COMM_WORLD);
-  } else {
-    MPI_Reduce(outarray.data(), outarray.data(), count, MPI_ATHENA_REAL,
-               MPI_SUM, 0, MPI_COMM_WORLD);
+
+  // send values at points interpolated on this rank to root as (index, values) pairs.
+  // The gather is completed by root in WriteOutputFile(); other ranks do not wait.
+  std::vector<int> owned;
+  for (int i = 0; i < md.numpoints[0]; ++i) {
+    for (int j = 0; j < md.numpoints[1]; ++j) {
+      for (int k = 0; k < md.numpoints[2]; ++k) {
+        if (pcart->IsOwned(i, j, k)) {
+          owned.push_back((i * md.numpoints[1] + j) * md.numpoints[2] + k);
+        }
+      }
+    }
   }
-#endif
+  gather.Start(outarray.data(), nout_vars,
+               md.numpoints[0] * md.numpoints[1] * md.numpoints[2], owned);
 }
 
 void CartesianGridOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
-#if MPI_PARALLEL_ENABLED
   if (0 == global_variable::my_rank) {
-#endif
+    // assemble data received from all ranks
+    gather.Finish(outarray.data());
 
     // Assemble filename
     char fname[BUFSIZ];
@@ -99,8 +102,8 @@ void CartesianGridOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
                   out_params.file_basename.c_str(), out_params.file_id.c_str(),
                   out_params.file_number);
 
-    // Open file
-    std::ofstream ofile(fname, std::ios::binary);
+    // Assemble file in memory
+    std::ostringstream ofile;
 
     // Write metadata
     md.cycle = pm->ncycle;
@@ -136,9 +139,14 @@ void CartesianGridOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
       }
     }
 
-#if MPI_PARALLEL_ENABLED
+    // Write file, on I/O thread if async=true
+    std::string buf = ofile.str();
+    IOWrapper cartfile;
+    cartfile.SetAsync(pasync_writer);
+    cartfile.Open(fname, IOWrapper::FileMode::write, true);
+    cartfile.Write_any_type(buf.data(), buf.size(), "byte", true);
+    cartfile.Close(true);
   }
-#endif
 
   // increment counters
   out_params.file_number++;
@@ -150,3 +158,8 @@ void CartesianGridOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   pin->SetInteger(out_params.block_name, "file_number", out_params.file_number);
   pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
 }
+
+// Complete gather of data from last output on ranks other than root
+void CartesianGridOutput::Finish(Mesh *pm) {
+  gather.Finish(outarray.data());
+}
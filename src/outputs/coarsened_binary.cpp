@@ -323,6 +323,7 @@ void CoarsenedBinaryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   fname.append(".cbin");
 
   IOWrapper cbinfile;
+  cbinfile.SetAsync(pasync_writer);  // nullptr unless <output>/async=true
   std::size_t header_offset=0;
   cbinfile.Open(fname.c_str(), IOWrapper::FileMode::write, single_file_per_rank);
 
@@ -8,6 +8,8 @@
 //! throughout the code to a log file.  Checks whether there is data to be written
 //! every time step, but only writes data if one or more counters are non-zero
 
+#include <cinttypes>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <iomanip>
@@ -42,6 +44,8 @@ void EventLogOutput::LoadOutputData(Mesh *pm) {
   int* pfail   = &(pm->ecounter.neos_fail);
   int* pmaxit  = &(pm->ecounter.maxit_c2p);
   int* pfofc   = &(pm->ecounter.nfofc);
+  std::int64_t* pc2pfst = &(pm->ecounter.nc2p_fast);
+  std::int64_t* pc2pslw = &(pm->ecounter.nc2p_slow);
   MPI_Allreduce(MPI_IN_PLACE, pdfloor, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
   MPI_Allreduce(MPI_IN_PLACE, pefloor, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
   MPI_Allreduce(MPI_IN_PLACE, ptfloor, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
@@ -49,9 +53,12 @@ void EventLogOutput::LoadOutputData(Mesh *pm) {
   MPI_Allreduce(MPI_IN_PLACE, pfail,   1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
   MPI_Allreduce(MPI_IN_PLACE, pmaxit,  1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
   MPI_Allreduce(MPI_IN_PLACE, pfofc,   1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, pc2pfst, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, pc2pslw, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
 #endif
 
-  // check if there is any data to be written
+  // check if there is any data to be written.  Cells inverted in the fast pass of
+  // two-pass C2P are counted every step, so they alone do not trigger output.
   no_output = true;
   if (pm->ecounter.neos_dfloor > 0 ||
       pm->ecounter.neos_efloor > 0 ||
@@ -59,6 +66,7 @@ void EventLogOutput::LoadOutputData(Mesh *pm) {
       pm->ecounter.neos_vceil  > 0 ||
       pm->ecounter.neos_fail   > 0 ||
       pm->ecounter.nfofc > 0 ||
+      pm->ecounter.nc2p_slow > 0 ||
       pm->ecounter.maxit_c2p > 0) {
     no_output=false;
   }
@@ -91,7 +99,7 @@ void EventLogOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     if (!(header_written)) {
       std::fprintf(pfile,"# Athena event counter data\n");
       std::fprintf(pfile,"#  cycle eos_dfloor eos_efloor eos_tfloor eos_vceil");
-      std::fprintf(pfile," eos_fail c2p_it fofc");
+      std::fprintf(pfile," eos_fail c2p_it fofc c2p_fast c2p_slow");
       std::fprintf(pfile,"\n");  // terminate line
       header_written = true;
     }
@@ -106,6 +114,8 @@ void EventLogOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
       std::fprintf(pfile, " %8d", pm->ecounter.neos_fail);
       std::fprintf(pfile, " %6d", pm->ecounter.maxit_c2p);
       std::fprintf(pfile, " %8d", pm->ecounter.nfofc);
+      std::fprintf(pfile, " %8" PRId64, pm->ecounter.nc2p_fast);
+      std::fprintf(pfile, " %8" PRId64, pm->ecounter.nc2p_slow);
       std::fprintf(pfile,"\n"); // terminate line
     }
     std::fclose(pfile);
@@ -119,6 +129,8 @@ void EventLogOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   pm->ecounter.neos_fail = 0;
   pm->ecounter.maxit_c2p = 0;
   pm->ecounter.nfofc = 0;
+  pm->ecounter.nc2p_fast = 0;
+  pm->ecounter.nc2p_slow = 0;
 
   // increment output time, clean up
   if (out_params.last_time < 0.0) {
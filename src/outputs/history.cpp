@@ -23,6 +23,7 @@
 #include "z4c/z4c.hpp"
 #include "coordinates/adm.hpp"
 #include "outputs.hpp"
+#include "history_sums.hpp"
 
 //----------------------------------------------------------------------------------------
 // Constructor: also calls BaseTypeOutput base class constructor
@@ -105,10 +106,19 @@ void HistoryOutput::LoadHydroHistoryData(HistoryData *pdata, Mesh *pm) {
     pdata->label[nhydro_+3+s] = labelSS.str();
   }
 
+  // use sums accumulated by Hydro::NewTimeStep() this cycle, if available
+  hydro::Hydro *phydro = pm->pmb_pack->phydro;
+  if (fused_due && phydro->fuse_hist) {
+    for (int n=0; n<pdata->nhist; ++n) {
+      pdata->hdata[n] = phydro->hist_sums.the_array[n];
+    }
+    return;
+  }
+
   // capture class variables for kernel
   auto &u0_ = pm->pmb_pack->phydro->u0;
   auto &size = pm->pmb_pack->pmb->mb_size;
-  int &nhist_ = pdata->nhist;
+  bool is_ideal = eos_data.is_ideal;
 
   // loop over all MeshBlocks in this pack
   auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
@@ -131,33 +141,8 @@ void HistoryOutput::LoadHydroHistoryData(HistoryData *pdata, Mesh *pm) {
 
     Real vol = size.d_view(m).dx1*size.d_view(m).dx2*size.d_view(m).dx3;
 
-    // Hydro conserved variables:
-    array_sum::GlobalSum hvars;
-    hvars.the_array[IDN] = vol*u0_(m,IDN,k,j,i);
-    hvars.the_array[IM1] = vol*u0_(m,IM1,k,j,i);
-    hvars.the_array[IM2] = vol*u0_(m,IM2,k,j,i);
-    hvars.the_array[IM3] = vol*u0_(m,IM3,k,j,i);
-    if (eos_data.is_ideal) {
-      hvars.the_array[IEN] = vol*u0_(m,IEN,k,j,i);
-    }
-
-    // Hydro KE
-    hvars.the_array[nhydro_  ] = vol*0.5*SQR(u0_(m,IM1,k,j,i))/u0_(m,IDN,k,j,i);
-    hvars.the_array[nhydro_+1] = vol*0.5*SQR(u0_(m,IM2,k,j,i))/u0_(m,IDN,k,j,i);
-    hvars.the_array[nhydro_+2] = vol*0.5*SQR(u0_(m,IM3,k,j,i))/u0_(m,IDN,k,j,i);
-
-    // Scalar masses
-    for (int s=0; s<nscalars_; ++s) {
-      hvars.the_array[nhydro_+3+s] = vol*u0_(m,nhydro_+s,k,j,i);
-    }
-
-    // fill rest of the_array with zeros, if nhist < NHISTORY_VARIABLES
-    for (int n=nhist_; n<NHISTORY_VARIABLES; ++n) {
-      hvars.the_array[n] = 0.0;
-    }
-
-    // sum into parallel reduce
-    mb_sum += hvars;
+    // Hydro conserved variables, KE, and scalar masses summed into parallel reduce
+    HydroHistorySums(u0_, m, k, j, i, vol, nhydro_, nscalars_, is_ideal, mb_sum);
   }, Kokkos::Sum<array_sum::GlobalSum>(sum_this_mb));
 
   // store data into hdata array
@@ -303,13 +288,20 @@ void HistoryOutput::LoadMHDHistoryData(HistoryData *pdata, Mesh *pm) {
     pdata->label[nmhd_+6+s] = labelSS.str();
   }
 
+  // use sums accumulated by MHD::NewTimeStep() this cycle, if available
+  mhd::MHD *pmhd = pm->pmb_pack->pmhd;
+  if (fused_due && pmhd->fuse_hist) {
+    for (int n=0; n<pdata->nhist; ++n) {
+      pdata->hdata[n] = pmhd->hist_sums.the_array[n];
+    }
+    return;
+  }
+
   // capture class variabels for kernel
   auto &u0_ = pm->pmb_pack->pmhd->u0;
-  auto &bx1f = pm->pmb_pack->pmhd->b0.x1f;
-  auto &bx2f = pm->pmb_pack->pmhd->b0.x2f;
-  auto &bx3f = pm->pmb_pack->pmhd->b0.x3f;
+  auto &b0_ = pm->pmb_pack->pmhd->b0;
   auto &size = pm->pmb_pack->pmb->mb_size;
-  int &nhist_ = pdata->nhist;
+  bool is_ideal = eos_data.is_ideal;
 
   // loop over all MeshBlocks in this pack
   auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
@@ -332,38 +324,8 @@ void HistoryOutput::LoadMHDHistoryData(HistoryData *pdata, Mesh *pm) {
 
     Real vol = size.d_view(m).dx1*size.d_view(m).dx2*size.d_view(m).dx3;
 
-    // MHD conserved variables:
-    array_sum::GlobalSum hvars;
-    hvars.the_array[IDN] = vol*u0_(m,IDN,k,j,i);
-    hvars.the_array[IM1] = vol*u0_(m,IM1,k,j,i);
-    hvars.the_array[IM2] = vol*u0_(m,IM2,k,j,i);
-    hvars.the_array[IM3] = vol*u0_(m,IM3,k,j,i);
-    if (eos_data.is_ideal) {
-      hvars.the_array[IEN] = vol*u0_(m,IEN,k,j,i);
-    }
-
-    // MHD KE
-    hvars.the_array[nmhd_  ] = vol*0.5*SQR(u0_(m,IM1,k,j,i))/u0_(m,IDN,k,j,i);
-    hvars.the_array[nmhd_+1] = vol*0.5*SQR(u0_(m,IM2,k,j,i))/u0_(m,IDN,k,j,i);
-    hvars.the_array[nmhd_+2] = vol*0.5*SQR(u0_(m,IM3,k,j,i))/u0_(m,IDN,k,j,i);
-
-    // MHD ME
-    hvars.the_array[nmhd_+3] = vol*0.25*(SQR(bx1f(m,k,j,i+1)) + SQR(bx1f(m,k,j,i)));
-    hvars.the_array[nmhd_+4] = vol*0.25*(SQR(bx2f(m,k,j+1,i)) + SQR(bx2f(m,k,j,i)));
-    hvars.the_array[nmhd_+5] = vol*0.25*(SQR(bx3f(m,k+1,j,i)) + SQR(bx3f(m,k,j,i)));
-
-    // Scalar masses
-    for (int s=0; s<nscalars_; ++s) {
-      hvars.the_array[nmhd_+6+s] = vol*u0_(m,nmhd_+s,k,j,i);
-    }
-
-    // fill rest of the_array with zeros, if nhist < NHISTORY_VARIABLES
-    for (int n=nhist_; n<NHISTORY_VARIABLES; ++n) {
-      hvars.the_array[n] = 0.0;
-    }
-
-    // sum into parallel reduce
-    mb_sum += hvars;
+    // MHD conserved variables, KE, ME, and scalar masses summed into parallel reduce
+    MHDHistorySums(u0_, b0_, m, k, j, i, vol, nmhd_, nscalars_, is_ideal, mb_sum);
   }, Kokkos::Sum<array_sum::GlobalSum>(sum_this_mb));
   Kokkos::fence();
 
@@ -375,76 +337,60 @@ void HistoryOutput::LoadMHDHistoryData(HistoryData *pdata, Mesh *pm) {
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void HistoryOutput::PrepareCycle()
+//  \brief With fused=true, requests that hydro/MHD history sums are accumulated by the
+//  NewTimeStep() task in the last stage of a cycle at the end of which output is due.
+
+void HistoryOutput::PrepareCycle(Mesh *pm, bool due) {
+  fused_due = out_params.fused_hist && due;
+  if (pm->pmb_pack->phydro != nullptr) {pm->pmb_pack->phydro->fuse_hist = fused_due;}
+  if (pm->pmb_pack->pmhd != nullptr) {pm->pmb_pack->pmhd->fuse_hist = fused_due;}
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void HistoryOutput::WriteOutputFile()
-//  \brief Cycles through hist_data vector and writes history file for each component
+//  \brief Sums hist_data over all MPI ranks, and writes history file for each component.
+//  With fused=true the sum is non-blocking, and the line for this output is written when
+//  the sum is completed at the next output (or at the end of the run in Finish()).
 
 void HistoryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
-  for (auto &data : hist_data) {
-    // first, perform in-place sum over all MPI ranks
-#if MPI_PARALLEL_ENABLED
-    if (global_variable::my_rank == 0) {
-      MPI_Reduce(MPI_IN_PLACE, &(data.hdata[0]), data.nhist, MPI_ATHENA_REAL,
-         MPI_SUM, 0, MPI_COMM_WORLD);
-    } else {
-      MPI_Reduce(&(data.hdata[0]), &(data.hdata[0]), data.nhist,
-         MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD);
-    }
-#endif
+  // sums from NewTimeStep() have been used (if they were requested)
+  PrepareCycle(pm, false);
 
-    // only the master rank writes the file
-    if (global_variable::my_rank == 0) {
-      // create filename: "file_basename" + ".physics" + ".hst"
-      // There is no file number or id in history output filenames.
-      std::string fname;
-      fname.assign(out_params.file_basename);
-      switch (data.physics) {
-        case PhysicsModule::HydroDynamics:
-          fname.append(".hydro");
-          break;
-        case PhysicsModule::MagnetoHydroDynamics:
-          fname.append(".mhd");
-          break;
-        case PhysicsModule::SpaceTimeDynamics:
-          fname.append(".z4c");
-        case PhysicsModule::UserDefined:
-          fname.append(".user");
-          break;
-        default:
-          break;
-      }
-      fname.append(".hst");
-
-      // open file for output
-      FILE *pfile;
-      if ((pfile = std::fopen(fname.c_str(),"a")) == nullptr) {
-        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
-        exit(EXIT_FAILURE);
+#if MPI_PARALLEL_ENABLED
+  if (out_params.fused_hist) {
+    // complete sums started at previous output and write them, then start new sums
+    Finish(pm);
+    pend_data = hist_data;
+    pend_time = pm->time;
+    pend_dt = pm->dt;
+    pend_req.resize(pend_data.size());
+    for (std::size_t n=0; n<pend_data.size(); ++n) {
+      if (global_variable::my_rank == 0) {
+        MPI_Ireduce(MPI_IN_PLACE, &(pend_data[n].hdata[0]), pend_data[n].nhist,
+                    MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD, &(pend_req[n]));
+      } else {
+        MPI_Ireduce(&(pend_data[n].hdata[0]), nullptr, pend_data[n].nhist,
+                    MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD, &(pend_req[n]));
       }
-
-      // Write header, if it has not been written already
-      if (!(data.header_written)) {
-        int iout = 1;
-        std::fprintf(pfile,"# Athena++ history data\n");
-        std::fprintf(pfile,"#  [%d]=time      ", iout++);
-        std::fprintf(pfile,"[%d]=dt       ", iout++);
-        for (int n=0; n<data.nhist; ++n) {
-          std::fprintf(pfile,"[%d]=%.10s    ", iout++, data.label[n].c_str());
-        }
-        std::fprintf(pfile,"\n");                              // terminate line
-        data.header_written = true;
+    }
+  } else {
+    // perform in-place sum over all MPI ranks
+    for (auto &data : hist_data) {
+      if (global_variable::my_rank == 0) {
+        MPI_Reduce(MPI_IN_PLACE, &(data.hdata[0]), data.nhist, MPI_ATHENA_REAL,
+           MPI_SUM, 0, MPI_COMM_WORLD);
+      } else {
+        MPI_Reduce(&(data.hdata[0]), &(data.hdata[0]), data.nhist,
+           MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD);
       }
-
-      // write history variables
-      std::fprintf(pfile, out_params.data_format.c_str(), pm->time);
-      std::fprintf(pfile, out_params.data_format.c_str(), pm->dt);
-      for (int n=0; n<data.nhist; ++n)
-        std::fprintf(pfile, out_params.data_format.c_str(), data.hdata[n]);
-      std::fprintf(pfile,"\n"); // terminate line
-      std::fclose(pfile);
     }
-  } // End loop over hist_data vector
+    WriteHistoryLines(hist_data, pm->time, pm->dt);
+  }
+#else
+  WriteHistoryLines(hist_data, pm->time, pm->dt);
+#endif
 
   // increment counters, clean up
   if (out_params.last_time < 0.0) {
@@ -455,3 +401,80 @@ void HistoryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
   return;
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn void HistoryOutput::Finish()
+//  \brief Completes non-blocking sums over MPI ranks started by WriteOutputFile() (if
+//  any), and writes their line to the history files.
+
+void HistoryOutput::Finish(Mesh *pm) {
+#if MPI_PARALLEL_ENABLED
+  if (pend_req.empty()) return;
+  MPI_Waitall(pend_req.size(), pend_req.data(), MPI_STATUSES_IGNORE);
+  pend_req.clear();
+  WriteHistoryLines(pend_data, pend_time, pend_dt);
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void HistoryOutput::WriteHistoryLines()
+//  \brief Writes one line of (already summed) data to history file for each component
+
+void HistoryOutput::WriteHistoryLines(const std::vector<HistoryData> &data_list,
+                                      Real time, Real dt) {
+  // only the master rank writes the file
+  if (global_variable::my_rank != 0) return;
+  for (std::size_t l=0; l<data_list.size(); ++l) {
+    const HistoryData &data = data_list[l];
+    // create filename: "file_basename" + ".physics" + ".hst"
+    // There is no file number or id in history output filenames.
+    std::string fname;
+    fname.assign(out_params.file_basename);
+    switch (data.physics) {
+      case PhysicsModule::HydroDynamics:
+        fname.append(".hydro");
+        break;
+      case PhysicsModule::MagnetoHydroDynamics:
+        fname.append(".mhd");
+        break;
+      case PhysicsModule::SpaceTimeDynamics:
+        fname.append(".z4c");
+      case PhysicsModule::UserDefined:
+        fname.append(".user");
+        break;
+      default:
+        break;
+    }
+    fname.append(".hst");
+
+    // open file for output
+    FILE *pfile;
+    if ((pfile = std::fopen(fname.c_str(),"a")) == nullptr) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
+      exit(EXIT_FAILURE);
+    }
+
+    // Write header, if it has not been written already
+    if (!(hist_data[l].header_written)) {
+      int iout = 1;
+      std::fprintf(pfile,"# Athena++ history data\n");
+      std::fprintf(pfile,"#  [%d]=time      ", iout++);
+      std::fprintf(pfile,"[%d]=dt       ", iout++);
+      for (int n=0; n<data.nhist; ++n) {
+        std::fprintf(pfile,"[%d]=%.10s    ", iout++, data.label[n].c_str());
+      }
+      std::fprintf(pfile,"\n");                              // terminate line
+      hist_data[l].header_written = true;
+    }
+
+    // write history variables
+    std::fprintf(pfile, out_params.data_format.c_str(), time);
+    std::fprintf(pfile, out_params.data_format.c_str(), dt);
+    for (int n=0; n<data.nhist; ++n)
+      std::fprintf(pfile, out_params.data_format.c_str(), data.hdata[n]);
+    std::fprintf(pfile,"\n"); // terminate line
+    std::fclose(pfile);
+  } // End loop over hist_data vector
+}
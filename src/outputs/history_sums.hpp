@@ -0,0 +1,69 @@
+#ifndef OUTPUTS_HISTORY_SUMS_HPP_
+#define OUTPUTS_HISTORY_SUMS_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file history_sums.hpp
+//  \brief inline functions that compute contribution of one cell to hydro and MHD
+//  history sums.  Used both by the history output, and by the NewTimeStep() kernels when
+//  history sums are accumulated in the same sweep as the timestep (fused=true).
+
+#include "athena.hpp"
+
+//----------------------------------------------------------------------------------------
+//! \fn void HydroHistorySums()
+//! \brief adds volume-weighted conserved variables, kinetic energies, and scalar masses
+//! of cell (m,k,j,i) to hvars, in order of labels set in LoadHydroHistoryData()
+
+KOKKOS_INLINE_FUNCTION
+void HydroHistorySums(const DvceArray5D<Real> &u0, const int m, const int k,
+                      const int j, const int i, const Real vol, const int nhydro,
+                      const int nscalars, const bool is_ideal,
+                      array_sum::GlobalSum &hvars) {
+  hvars.the_array[IDN] += vol*u0(m,IDN,k,j,i);
+  hvars.the_array[IM1] += vol*u0(m,IM1,k,j,i);
+  hvars.the_array[IM2] += vol*u0(m,IM2,k,j,i);
+  hvars.the_array[IM3] += vol*u0(m,IM3,k,j,i);
+  if (is_ideal) {
+    hvars.the_array[IEN] += vol*u0(m,IEN,k,j,i);
+  }
+  hvars.the_array[nhydro  ] += vol*0.5*SQR(u0(m,IM1,k,j,i))/u0(m,IDN,k,j,i);
+  hvars.the_array[nhydro+1] += vol*0.5*SQR(u0(m,IM2,k,j,i))/u0(m,IDN,k,j,i);
+  hvars.the_array[nhydro+2] += vol*0.5*SQR(u0(m,IM3,k,j,i))/u0(m,IDN,k,j,i);
+  for (int s=0; s<nscalars; ++s) {
+    hvars.the_array[nhydro+3+s] += vol*u0(m,nhydro+s,k,j,i);
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MHDHistorySums()
+//! \brief adds volume-weighted conserved variables, kinetic and magnetic energies, and
+//! scalar masses of cell (m,k,j,i) to hvars, in order of labels set in
+//! LoadMHDHistoryData()
+
+KOKKOS_INLINE_FUNCTION
+void MHDHistorySums(const DvceArray5D<Real> &u0, const DvceFaceFld4D<Real> &b0,
+                    const int m, const int k, const int j, const int i, const Real vol,
+                    const int nmhd, const int nscalars, const bool is_ideal,
+                    array_sum::GlobalSum &hvars) {
+  hvars.the_array[IDN] += vol*u0(m,IDN,k,j,i);
+  hvars.the_array[IM1] += vol*u0(m,IM1,k,j,i);
+  hvars.the_array[IM2] += vol*u0(m,IM2,k,j,i);
+  hvars.the_array[IM3] += vol*u0(m,IM3,k,j,i);
+  if (is_ideal) {
+    hvars.the_array[IEN] += vol*u0(m,IEN,k,j,i);
+  }
+  hvars.the_array[nmhd  ] += vol*0.5*SQR(u0(m,IM1,k,j,i))/u0(m,IDN,k,j,i);
+  hvars.the_array[nmhd+1] += vol*0.5*SQR(u0(m,IM2,k,j,i))/u0(m,IDN,k,j,i);
+  hvars.the_array[nmhd+2] += vol*0.5*SQR(u0(m,IM3,k,j,i))/u0(m,IDN,k,j,i);
+  hvars.the_array[nmhd+3] += vol*0.25*(SQR(b0.x1f(m,k,j,i+1)) + SQR(b0.x1f(m,k,j,i)));
+  hvars.the_array[nmhd+4] += vol*0.25*(SQR(b0.x2f(m,k,j+1,i)) + SQR(b0.x2f(m,k,j,i)));
+  hvars.the_array[nmhd+5] += vol*0.25*(SQR(b0.x3f(m,k+1,j,i)) + SQR(b0.x3f(m,k,j,i)));
+  for (int s=0; s<nscalars; ++s) {
+    hvars.the_array[nmhd+6+s] += vol*u0(m,nmhd+s,k,j,i);
+  }
+}
+
+#endif // OUTPUTS_HISTORY_SUMS_HPP_
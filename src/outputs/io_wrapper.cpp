@@ -6,13 +6,16 @@
 //! \file io_wrapper.cpp
 //! \brief functions that provide wrapper for MPI-IO versus serial input/output
 
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 #include "athena.hpp"
 #include "io_wrapper.hpp"
@@ -23,6 +26,21 @@
 //! This function must not be called by multiple threads in shared memory parallel regions
 
 int IOWrapper::Open(const char* fname, FileMode rw, bool single_file_per_rank) {
+  // in asynchronous mode the file is opened by the I/O thread, only writes are staged
+  if (pasync_ != nullptr) {
+    if (rw != FileMode::write) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Asynchronous I/O only supports writing new files, "
+                << "cannot open '" << fname << "'" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    pbatch_ = std::make_shared<AsyncWriteBatch>();
+    pbatch_->fname = fname;
+    pbatch_->single_file_per_rank = single_file_per_rank;
+    async_pos_ = 0;
+    return true;
+  }
+
   const char* mode;
   switch (rw) {
     case FileMode::read:
@@ -295,6 +313,9 @@ std::size_t IOWrapper::Read_Reals_at_all(void *buf, IOWrapperSizeT cnt,
 
 std::size_t IOWrapper::Write_any_type(const void *buf, IOWrapperSizeT cnt,
                                       std::string datatype, bool single_file_per_rank) {
+  if (pasync_ != nullptr) {
+    return Stage(buf, cnt, async_pos_, datatype, false, true, single_file_per_rank);
+  }
 #if MPI_PARALLEL_ENABLED
   if (single_file_per_rank) {
     // Use standard C file handling
@@ -390,6 +411,9 @@ std::size_t IOWrapper::Write_any_type(const void *buf, IOWrapperSizeT cnt,
 std::size_t IOWrapper::Write_any_type_at(const void *buf, IOWrapperSizeT cnt,
                                          IOWrapperSizeT offset, std::string datatype,
                                          bool single_file_per_rank) {
+  if (pasync_ != nullptr) {
+    return Stage(buf, cnt, offset, datatype, false, false, single_file_per_rank);
+  }
 #if MPI_PARALLEL_ENABLED
   if (single_file_per_rank) {
     // set appropriate datasize
@@ -488,6 +512,9 @@ std::size_t IOWrapper::Write_any_type_at(const void *buf, IOWrapperSizeT cnt,
 std::size_t IOWrapper::Write_any_type_at_all(const void *buf, IOWrapperSizeT cnt,
                                             IOWrapperSizeT offset, std::string datatype,
                                             bool single_file_per_rank) {
+  if (pasync_ != nullptr) {
+    return Stage(buf, cnt, offset, datatype, true, false, single_file_per_rank);
+  }
 #if MPI_PARALLEL_ENABLED
   if (single_file_per_rank) {
     // set appropriate datasize
@@ -582,6 +609,10 @@ std::size_t IOWrapper::Write_any_type_at_all(const void *buf, IOWrapperSizeT cnt
 //  \brief wrapper for {MPI_File_close} versus {std::fclose}
 
 int IOWrapper::Close(bool single_file_per_rank) {
+  if (pasync_ != nullptr) {
+    pasync_->Submit(std::move(pbatch_));
+    return 0;
+  }
 #if MPI_PARALLEL_ENABLED
   if (!single_file_per_rank) {
     return MPI_File_close(&fh_);
@@ -598,6 +629,10 @@ int IOWrapper::Close(bool single_file_per_rank) {
 //  \brief wrapper for {MPI_File_seek} versus {std::fseek}
 
 int IOWrapper::Seek(IOWrapperSizeT offset, bool single_file_per_rank) {
+  if (pasync_ != nullptr) {
+    async_pos_ = offset;
+    return 0;
+  }
 #if MPI_PARALLEL_ENABLED
   if (!single_file_per_rank) {
     return MPI_File_seek(fh_, offset, MPI_SEEK_SET);
@@ -614,6 +649,7 @@ int IOWrapper::Seek(IOWrapperSizeT offset, bool single_file_per_rank) {
 //  \brief wrapper for {MPI_File_get_position} versus {ftell}
 
 IOWrapperSizeT IOWrapper::GetPosition(bool single_file_per_rank) {
+  if (pasync_ != nullptr) {return async_pos_;}
 #if MPI_PARALLEL_ENABLED
   if (!single_file_per_rank) {
     MPI_Offset position;
@@ -628,3 +664,168 @@ IOWrapperSizeT IOWrapper::GetPosition(bool single_file_per_rank) {
   return pos;
 #endif
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn std::size_t IOWrapper::Stage()
+//! \brief Copies data of a write into the staging buffer of the current batch, and
+//! records where it is to be written.  Returns number of data elements staged.
+
+std::size_t IOWrapper::Stage(const void *buf, IOWrapperSizeT cnt, IOWrapperSizeT offset,
+                             std::string datatype, bool collective, bool sequential,
+                             bool single_file_per_rank) {
+  std::size_t datasize;
+  if (datatype.compare("byte") == 0) {
+    datasize = sizeof(char);
+  } else if (datatype.compare("int") == 0) {
+    datasize = sizeof(int);
+  } else if (datatype.compare("float") == 0) {
+    datasize = sizeof(float);
+  } else if (datatype.compare("double") == 0) {
+    datasize = sizeof(double);
+  } else if (datatype.compare("Real") == 0) {
+    datasize = sizeof(Real);
+  } else {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Unrecognized datatype '" << datatype << "'" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  if (pbatch_ == nullptr) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Asynchronous write to a file that is not open"
+              << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  IOWrapperSizeT nbytes = cnt*datasize;
+  std::size_t pos = pbatch_->data.size();
+  pbatch_->data.resize(pos + nbytes);
+  if (nbytes > 0) {std::memcpy(&(pbatch_->data[pos]), buf, nbytes);}
+  pbatch_->ops.push_back({offset, nbytes, pos, collective});
+
+  // emulate file pointer of synchronous writes: std::fwrite() always advances it, while
+  // with MPI-IO only sequential writes (not MPI_File_write_at) do
+  bool advance = true;
+#if MPI_PARALLEL_ENABLED
+  if (!single_file_per_rank) {advance = sequential;}
+#endif
+  if (advance) {async_pos_ = offset + nbytes;}
+  return cnt;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn AsyncOutputWriter::AsyncOutputWriter()
+//! \brief constructor, starts the I/O thread.  Must be called by all ranks.
+
+AsyncOutputWriter::AsyncOutputWriter() :
+  nfiles(0),
+  wait_time(0.0),
+  quit_(false) {
+#if MPI_PARALLEL_ENABLED
+  int provided;
+  MPI_Query_thread(&provided);
+  if (provided < MPI_THREAD_MULTIPLE) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Asynchronous outputs require MPI_THREAD_MULTIPLE, which "
+              << "is only requested with the -a command line option, and may not be "
+              << "supported by this MPI library" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  MPI_Comm_dup(MPI_COMM_WORLD, &comm_);
+#endif
+  thread_ = std::thread(&AsyncOutputWriter::Run, this);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn AsyncOutputWriter::~AsyncOutputWriter()
+//! \brief destructor, finishes any write in progress and stops the I/O thread.  Must be
+//! called by all ranks before MPI_Finalize().
+
+AsyncOutputWriter::~AsyncOutputWriter() {
+  Wait();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    quit_ = true;
+  }
+  cv_.notify_all();
+  thread_.join();
+#if MPI_PARALLEL_ENABLED
+  MPI_Comm_free(&comm_);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void AsyncOutputWriter::Submit()
+//! \brief hands a staged batch of writes to the I/O thread, waiting first for the
+//! previous batch to be written (back-pressure).
+
+void AsyncOutputWriter::Submit(std::shared_ptr<AsyncWriteBatch> pbatch) {
+  auto start = std::chrono::steady_clock::now();
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this] {return pbatch_ == nullptr;});
+  std::chrono::duration<double> dt = std::chrono::steady_clock::now() - start;
+  wait_time += dt.count();
+  pbatch_ = std::move(pbatch);
+  nfiles++;
+  lock.unlock();
+  cv_.notify_all();
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void AsyncOutputWriter::Wait()
+//! \brief blocks until the I/O thread has finished writing the current batch (if any)
+
+void AsyncOutputWriter::Wait() {
+  auto start = std::chrono::steady_clock::now();
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this] {return pbatch_ == nullptr;});
+  std::chrono::duration<double> dt = std::chrono::steady_clock::now() - start;
+  wait_time += dt.count();
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void AsyncOutputWriter::Run()
+//! \brief main loop of I/O thread: writes each batch as it is submitted
+
+void AsyncOutputWriter::Run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cv_.wait(lock, [this] {return (pbatch_ != nullptr) || quit_;});
+    if (pbatch_ == nullptr) break;
+    // write without holding lock; pbatch_ is not modified by Submit() until reset
+    lock.unlock();
+    WriteBatch(*pbatch_);
+    lock.lock();
+    pbatch_.reset();
+    cv_.notify_all();
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void AsyncOutputWriter::WriteBatch()
+//! \brief opens file, performs all staged writes in the order they were made, and closes
+//! the file.  Since every rank stages the same sequence of collective writes, they are
+//! also matched across ranks by the I/O threads.
+
+void AsyncOutputWriter::WriteBatch(const AsyncWriteBatch &batch) {
+  IOWrapper file;
+#if MPI_PARALLEL_ENABLED
+  file.SetCommunicator(comm_);
+#endif
+  bool sfpr = batch.single_file_per_rank;
+  file.Open(batch.fname.c_str(), IOWrapper::FileMode::write, sfpr);
+  for (auto &op : batch.ops) {
+    const char *buf = batch.data.data() + op.pos;
+    std::size_t nwritten;
+    if (op.collective) {
+      nwritten = file.Write_any_type_at_all(buf, op.nbytes, op.offset, "byte", sfpr);
+    } else {
+      nwritten = file.Write_any_type_at(buf, op.nbytes, op.offset, "byte", sfpr);
+    }
+    if (nwritten != op.nbytes) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Data not written correctly to file '" << batch.fname
+                << "' by asynchronous I/O thread" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+  }
+  file.Close(sfpr);
+}
@@ -7,8 +7,15 @@
 //========================================================================================
 //! \file io_wrapper.hpp
 //  \brief defines a set of small wrapper functions for MPI versus serial outputs.
+//  Also defines AsyncOutputWriter, which performs the writes of an IOWrapper on a
+//  dedicated I/O thread so that the solver can continue while a file is written.
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 #include <cstdio>
 #include "athena.hpp"
 
@@ -21,6 +28,32 @@ using  IOWrapperFile = FILE*;
 
 using IOWrapperSizeT = std::uint64_t;
 
+class AsyncOutputWriter;
+
+//----------------------------------------------------------------------------------------
+//! \struct AsyncWriteBatch
+//  \brief copy of all data written to one file by an IOWrapper in asynchronous mode,
+//  together with the list of writes (offset in file, location in data) to be performed
+
+struct AsyncWriteBatch {
+  struct WriteOp {
+    IOWrapperSizeT offset;   // offset of write in file
+    IOWrapperSizeT nbytes;   // number of bytes written
+    std::size_t pos;         // position of bytes in data
+    bool collective;         // write uses Write_any_type_at_all()
+  };
+  std::string fname;
+  bool single_file_per_rank;
+  std::vector<char> data;
+  std::vector<WriteOp> ops;
+};
+
+//----------------------------------------------------------------------------------------
+//! \class IOWrapper
+//  \brief wrapper for MPI-IO versus serial I/O.  If SetAsync() is called before Open(),
+//  writes are not performed immediately.  Instead the data is copied into a staging
+//  buffer, and the complete set of writes is handed to an AsyncOutputWriter by Close().
+
 class IOWrapper {
  public:
 #if MPI_PARALLEL_ENABLED
@@ -57,11 +90,55 @@ class IOWrapper {
   int Close(bool single_file_per_rank = false);
   int Seek(IOWrapperSizeT offset, bool single_file_per_rank = false);
   IOWrapperSizeT GetPosition(bool single_file_per_rank = false);
+  // defer writes to an I/O thread (no effect if pwriter is nullptr)
+  void SetAsync(AsyncOutputWriter *pwriter) {pasync_ = pwriter;}
 
  private:
   IOWrapperFile fh_;
 #if MPI_PARALLEL_ENABLED
   MPI_Comm comm_;
 #endif
+  AsyncOutputWriter *pasync_ = nullptr;     // I/O thread for asynchronous writes
+  std::shared_ptr<AsyncWriteBatch> pbatch_; // writes staged since Open() (async only)
+  IOWrapperSizeT async_pos_ = 0;            // emulated file pointer (async only)
+  std::size_t Stage(const void *buf, IOWrapperSizeT cnt, IOWrapperSizeT offset,
+                    std::string datatype, bool collective, bool sequential,
+                    bool single_file_per_rank);
+};
+
+//----------------------------------------------------------------------------------------
+//! \class AsyncOutputWriter
+//  \brief performs batches of writes staged by IOWrapper on a dedicated I/O thread.
+//  At most one batch is written at a time, while the next is staged (double-buffering).
+//  If a batch is submitted while the previous one is still being written, the calling
+//  thread blocks until the write completes (back-pressure).  With MPI, the I/O thread
+//  uses a duplicate of MPI_COMM_WORLD so its collective writes cannot interleave with
+//  communication by the main thread, which requires MPI_THREAD_MULTIPLE (requested when
+//  the code is run with the -a command line option).
+
+class AsyncOutputWriter {
+ public:
+  AsyncOutputWriter();
+  ~AsyncOutputWriter();
+  AsyncOutputWriter(const AsyncOutputWriter&) = delete;
+  AsyncOutputWriter &operator=(const AsyncOutputWriter&) = delete;
+
+  void Submit(std::shared_ptr<AsyncWriteBatch> pbatch);
+  void Wait();         // blocks until no batch is being written
+
+  int nfiles;          // number of files written
+  double wait_time;    // time [s] callers were blocked waiting for I/O thread
+
+ private:
+  std::thread thread_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::shared_ptr<AsyncWriteBatch> pbatch_;  // batch being written (nullptr if idle)
+  bool quit_;
+#if MPI_PARALLEL_ENABLED
+  MPI_Comm comm_;
+#endif
+  void Run();
+  void WriteBatch(const AsyncWriteBatch &batch);
 };
 #endif // OUTPUTS_IO_WRAPPER_HPP_
@@ -0,0 +1,176 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file lossy_compress.cpp
+//! \brief implements error-bounded lossy compression of output variables.  The format
+//! is described in lossy_compress.hpp.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "lossy_compress.hpp"
+
+namespace lossy_compress {
+
+namespace {
+//----------------------------------------------------------------------------------------
+//! \fn void Append()
+//! \brief appends bytes of a value to the output buffer
+
+template <typename T>
+void Append(const T &val, std::vector<char> &out) {
+  const char *p = reinterpret_cast<const char *>(&val);
+  out.insert(out.end(), p, p + sizeof(T));
+}
+
+//----------------------------------------------------------------------------------------
+//! \class BitWriter
+//  \brief appends values of arbitrary width (<=64 bits) to a byte buffer, least
+//  significant bit first
+
+class BitWriter {
+ public:
+  explicit BitWriter(std::vector<char> &out) : out_(out) {}
+  void Put(std::uint64_t val, int width) {
+    if (width == 0) return;
+    acc_ |= val << nacc_;
+    if (nacc_ + width < 64) {
+      nacc_ += width;
+      return;
+    }
+    Emit(8);
+    int used = 64 - nacc_;
+    acc_ = (used < 64) ? (val >> used) : 0;
+    nacc_ = width - used;
+  }
+  void Flush() {
+    Emit((nacc_ + 7)/8);
+    acc_ = 0;
+    nacc_ = 0;
+  }
+
+ private:
+  std::vector<char> &out_;
+  std::uint64_t acc_ = 0;
+  int nacc_ = 0;
+  void Emit(int nbytes) {
+    for (int b=0; b<nbytes; ++b) {
+      out_.push_back(static_cast<char>((acc_ >> (8*b)) & 0xff));
+    }
+  }
+};
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn double CompressChunk()
+//! \brief appends compressed chunk of nx1*nx2*nx3 floats (stored with i fastest) to out.
+//! Returns largest error of reconstructed values in the units of the error bound, i.e.
+//! relative to the range of values if relative=true.
+
+double CompressChunk(const float *in, int nx1, int nx2, int nx3, double bound,
+                     bool relative, std::vector<char> &out) {
+  std::size_t ncells = static_cast<std::size_t>(nx1)*nx2*nx3;
+
+  // range of values, and check for values that cannot be quantized
+  bool quantize = true;
+  double vmin = in[0], vmax = in[0];
+  for (std::size_t c=0; c<ncells; ++c) {
+    if (!std::isfinite(in[c])) {
+      quantize = false;
+      break;
+    }
+    vmin = std::min(vmin, static_cast<double>(in[c]));
+    vmax = std::max(vmax, static_cast<double>(in[c]));
+  }
+  double eps = relative ? bound*(vmax - vmin) : bound;
+  double step = (eps > 0.0) ? 2.0*eps : 1.0;
+  quantize = quantize && ((vmax - vmin)/step < 1.0e15);
+
+  // quantize, and check error bound is satisfied after rounding to float
+  std::vector<std::int64_t> q;
+  double max_err = 0.0;
+  if (quantize) {
+    q.resize(ncells);
+    for (std::size_t c=0; c<ncells; ++c) {
+      q[c] = std::llround((in[c] - vmin)/step);
+      float val = static_cast<float>(vmin + q[c]*step);
+      max_err = std::max(max_err, std::abs(static_cast<double>(val) - in[c]));
+    }
+    quantize = (max_err <= eps);
+  }
+
+  if (!quantize) {
+    Append(static_cast<std::uint32_t>(0), out);
+    Append(static_cast<std::uint32_t>(ncells*sizeof(float)), out);
+    Append(0.0, out);
+    Append(0.0, out);
+    Append(0.0, out);
+    const char *p = reinterpret_cast<const char *>(in);
+    out.insert(out.end(), p, p + ncells*sizeof(float));
+    return 0.0;
+  }
+
+  // residuals of 3D Lorenzo predictor, computed as successive differences in i, j, k
+  for (int k=0; k<nx3; ++k) {
+    for (int j=0; j<nx2; ++j) {
+      std::int64_t *row = &(q[(static_cast<std::size_t>(k)*nx2 + j)*nx1]);
+      for (int i=nx1-1; i>0; --i) {row[i] -= row[i-1];}
+    }
+  }
+  for (int k=0; k<nx3; ++k) {
+    for (int j=nx2-1; j>0; --j) {
+      std::int64_t *row = &(q[(static_cast<std::size_t>(k)*nx2 + j)*nx1]);
+      for (int i=0; i<nx1; ++i) {row[i] -= row[i-nx1];}
+    }
+  }
+  std::size_t nplane = static_cast<std::size_t>(nx1)*nx2;
+  for (int k=nx3-1; k>0; --k) {
+    std::int64_t *plane = &(q[k*nplane]);
+    for (std::size_t c=0; c<nplane; ++c) {plane[c] -= plane[c - nplane];}
+  }
+
+  // zigzag encode, and find width of each block
+  std::vector<std::uint64_t> z(ncells);
+  for (std::size_t c=0; c<ncells; ++c) {
+    z[c] = (static_cast<std::uint64_t>(q[c]) << 1) ^
+           static_cast<std::uint64_t>(q[c] >> 63);
+  }
+  std::size_t nblocks = (ncells + kBlockSize - 1)/kBlockSize;
+  std::vector<std::uint8_t> width(nblocks);
+  for (std::size_t b=0; b<nblocks; ++b) {
+    std::uint64_t zmax = 0;
+    for (std::size_t c=b*kBlockSize; c<std::min(ncells, (b+1)*kBlockSize); ++c) {
+      zmax |= z[c];
+    }
+    int w = 0;
+    while (w < 64 && (zmax >> w) != 0) {w++;}
+    width[b] = static_cast<std::uint8_t>(w);
+  }
+
+  // write header (payload size is filled in once known), block widths and packed bits
+  std::size_t head = out.size();
+  Append(static_cast<std::uint32_t>(1), out);
+  Append(static_cast<std::uint32_t>(0), out);
+  Append(vmin, out);
+  Append(step, out);
+  Append(max_err, out);
+  out.insert(out.end(), width.begin(), width.end());
+  BitWriter bits(out);
+  for (std::size_t c=0; c<ncells; ++c) {
+    bits.Put(z[c], width[c/kBlockSize]);
+  }
+  bits.Flush();
+  std::uint32_t nbytes = out.size() - head - kChunkHeader;
+  std::memcpy(&(out[head + sizeof(std::uint32_t)]), &nbytes, sizeof(nbytes));
+  if (relative) {
+    return (vmax > vmin) ? max_err/(vmax - vmin) : 0.0;
+  }
+  return max_err;
+}
+
+} // namespace lossy_compress
@@ -0,0 +1,38 @@
+#ifndef OUTPUTS_LOSSY_COMPRESS_HPP_
+#define OUTPUTS_LOSSY_COMPRESS_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file lossy_compress.hpp
+//  \brief error-bounded lossy compression of the variables in binary outputs
+//
+// With <output>/compression=lossy each variable of each MeshBlock is compressed as one
+// chunk.  Values are quantized with step 2*eps relative to the minimum value, where eps
+// is the (absolute, or relative to the range of values in the chunk) error bound.  The
+// quantized integers are replaced by their residuals from the 3D Lorenzo predictor (i.e.
+// mixed differences in i, j and k), which are zigzag encoded and bit packed in blocks of
+// kBlockSize values, with the width in bits of each block set by its largest value.
+// Chunks containing non-finite values, or which would violate the error bound after
+// rounding to float, are stored uncompressed.  Each chunk consists of:
+//   method (uint32, 0=uncompressed floats, 1=quantized), size of payload (uint32),
+//   vmin, step, max_error (double), payload
+// The payload of a quantized chunk is the width of each block (uint8), followed by the
+// packed bits (least significant bit first).  Reconstructed values are vmin + q*step,
+// rounded to float, and max_error is the largest absolute error of these values.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace lossy_compress {
+
+constexpr int kBlockSize = 64;        // number of values in each bit-packed block
+constexpr std::size_t kChunkHeader = 2*sizeof(std::uint32_t) + 3*sizeof(double);
+
+double CompressChunk(const float *in, int nx1, int nx2, int nx3, double bound,
+                     bool relative, std::vector<char> &out);
+
+} // namespace lossy_compress
+#endif // OUTPUTS_LOSSY_COMPRESS_HPP_
@@ -18,7 +18,7 @@
 //! Required parameters that must be specified in an <output[n]> block are:
 //!   - variable  = [list of currently implemented strings for specifing output variables
 //!                  is defined at start of outputs.hpp file]
-//!   - file_type = tab,vtk,hst,bin,rst
+//!   - file_type = tab,vtk,hst,bin,rst,proj,pbin
 //!   - dt        = problem time between outputs
 //!
 //! EXAMPLE of an <output[n]> block for a TAB dump:
@@ -37,6 +37,43 @@
 //! To implement a new output type, write a new BaseTypeOutput derived class and construct
 //! an object of this class in the Outputs constructor at the location indicated by the
 //! comment text: 'NEW_OUTPUT_TYPES'.
+//!
+//! Binary (bin, cbin), restart (rst), Cartesian grid (cart) and spherical surface (sph)
+//! outputs accept 'async = true', in which case the data is copied into a host staging
+//! buffer and the file is written by a dedicated I/O thread while the calculation
+//! continues.  Only one file is written at a time; a new
+//! output waits until the previous write has completed.
+//!
+//! Restart (rst) outputs accept 'packed = true', in which case only the active cells of
+//! each MeshBlock are stored (ghost zones are refilled on restart), as one chunk per
+//! MeshBlock.  With 'compression_level = 1-9' each chunk is also compressed losslessly
+//! using zlib (requires configuring with -D Athena_ENABLE_ZLIB=ON).
+//!
+//! Restart outputs also accept 'local_dir = path', in which case each rank writes its
+//! restart file to a node-local directory and a background thread drains it to rst/.
+//! Fully drained checkpoints are listed in rst/basename.manifest, and running with
+//! '-r rst/basename.manifest' restarts from the newest of them.
+//!
+//! Binary (bin) outputs accept 'indexed = true', in which case an index giving the
+//! offset, logical location, and bounds of every MeshBlock record (and the offset of each
+//! variable within a record) is appended to the file, so that readers can extract single
+//! variables or sub-volumes without scanning the whole file (file format version=1.2).
+//!
+//! Binary outputs also accept 'compression = lossy' with 'error_bound = value' and
+//! 'error_type = relative (default, relative to the range of each variable on each
+//! MeshBlock) or absolute'.  Each variable of each MeshBlock is then quantized and
+//! compressed so that the error of every value is below the bound.  These files are
+//! always indexed (file format version=1.3).
+//!
+//! Particle binary (pbin) outputs accept 'fields = x,vx,...,tag' (default: all real and
+//! integer particle data), and 'tag_min', 'tag_max' and 'stride', in which case only
+//! particles with tag_min <= tag <= tag_max and (tag-tag_min) divisible by stride are
+//! written.  Files can be read with read_particle_binary() in vis/python/bin_convert.py.
+//!
+//! History (hst) outputs accept 'fused = true', in which case the hydro and MHD sums are
+//! accumulated in the NewTimeStep() kernel of the last stage of a cycle at the end of
+//! which output is due, instead of in a separate sweep over the Mesh.  The sum over MPI
+//! ranks is then non-blocking, and each line is written to the file at the next output.
 //========================================================================================
 
 #include <cstdio>
@@ -206,6 +243,7 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
       // set optional boolean to output only user-defined history variables
       if (opar.file_type.compare("hst") == 0) {
         opar.user_hist_only =pin->GetOrAddBoolean(opar.block_name,"user_hist_only",false);
+        opar.fused_hist = pin->GetOrAddBoolean(opar.block_name,"fused",false);
         if (opar.user_hist_only && !(pm->pgen->user_hist)) {
           std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
               << std::endl << "User-history file requested in output block '"
@@ -214,6 +252,46 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
         }
       }
 
+      // set optional flag to write file on I/O thread
+      if (opar.file_type.compare("bin") == 0 || opar.file_type.compare("cbin") == 0 ||
+          opar.file_type.compare("rst") == 0 || opar.file_type.compare("cart") == 0 ||
+          opar.file_type.compare("sph") == 0) {
+        opar.async = pin->GetOrAddBoolean(opar.block_name, "async", false);
+      }
+
+      // set optional ghost-zone-free (and optionally compressed) restart format
+      if (opar.file_type.compare("rst") == 0) {
+        opar.packed = pin->GetOrAddBoolean(opar.block_name, "packed", false);
+        opar.compression_level = pin->GetOrAddInteger(opar.block_name,
+                                                      "compression_level", 0);
+        if (opar.compression_level < 0 || opar.compression_level > 9 ||
+            (opar.compression_level > 0 && !(opar.packed))) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Output block '" << opar.block_name << "' has "
+              << "compression_level=" << opar.compression_level << ", must be in [0,9] "
+              << "and requires packed=true" << std::endl;
+          exit(EXIT_FAILURE);
+        }
+#if !ZLIB_ENABLED
+        if (opar.compression_level > 0) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Output block '" << opar.block_name << "' requests "
+              << "compression, but code was not configured with -D Athena_ENABLE_ZLIB=ON"
+              << std::endl;
+          exit(EXIT_FAILURE);
+        }
+#endif
+
+        // set optional node-local directory, which requires one file per rank
+        opar.local_dir = pin->GetOrAddString(opar.block_name, "local_dir", "");
+        if (!opar.local_dir.empty() && opar.async) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Output block '" << opar.block_name << "' cannot use both "
+              << "async and local_dir" << std::endl;
+          exit(EXIT_FAILURE);
+        }
+      }
+
       // set optional data format string used in formatted writes
       opar.data_format = pin->GetOrAddString(opar.block_name, "data_format", "%12.5e");
       opar.data_format.insert(0, " "); // prepend with blank to separate columns
@@ -238,6 +316,9 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
       } else if (opar.file_type.compare("pvtk") == 0) {
         pnode = new ParticleVTKOutput(pin,pm,opar);
         pout_list.insert(pout_list.begin(),pnode);
+      } else if (opar.file_type.compare("pbin") == 0) {
+        pnode = new ParticleBinaryOutput(pin,pm,opar);
+        pout_list.insert(pout_list.begin(),pnode);
       } else if (opar.file_type.compare("trk") == 0) {
         pnode = new TrackedParticleOutput(pin,pm,opar);
         pout_list.insert(pout_list.begin(),pnode);
@@ -274,11 +355,40 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
       } else if (opar.file_type.compare("bin") == 0) {
         opar.single_file_per_rank = pin->GetOrAddBoolean(opar.block_name,
           "single_file_per_rank", false);
+        opar.indexed = pin->GetOrAddBoolean(opar.block_name, "indexed", false);
+        std::string compression = pin->GetOrAddString(opar.block_name, "compression",
+                                                      "none");
+        if (compression.compare("lossy") == 0) {
+          opar.lossy = true;
+          opar.indexed = true;
+          opar.error_bound = pin->GetReal(opar.block_name, "error_bound");
+          std::string error_type = pin->GetOrAddString(opar.block_name, "error_type",
+                                                       "relative");
+          opar.relative_error = (error_type.compare("relative") == 0);
+          if ((!(opar.relative_error) && error_type.compare("absolute") != 0) ||
+              !(opar.error_bound > 0.0)) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Output block '" << opar.block_name << "' has "
+                << "error_type=" << error_type << " and error_bound="
+                << opar.error_bound << ", error_type must be 'absolute' or 'relative' "
+                << "and error_bound must be > 0" << std::endl;
+            exit(EXIT_FAILURE);
+          }
+        } else if (compression.compare("none") != 0) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Output block '" << opar.block_name << "' has unknown "
+              << "compression=" << compression << ", must be 'none' or 'lossy'"
+              << std::endl;
+          exit(EXIT_FAILURE);
+        }
         pnode = new MeshBinaryOutput(pin,pm,opar);
         pout_list.insert(pout_list.begin(),pnode);
       } else if (opar.file_type.compare("cart") == 0) {
         pnode = new CartesianGridOutput(pin,pm,opar);
         pout_list.insert(pout_list.begin(),pnode);
+      } else if (opar.file_type.compare("proj") == 0) {
+        pnode = new ProjectionOutput(pin,pm,opar);
+        pout_list.insert(pout_list.begin(),pnode);
       } else if (opar.file_type.compare("sph") == 0) {
         pnode = new SphericalSurfaceOutput(pin,pm,opar);
         pout_list.insert(pout_list.begin(),pnode);
@@ -286,8 +396,20 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
       // Add restarts to the tail end of BaseTypeOutput list, so file counters for other
       // output types are up-to-date in restart file
         opar.single_file_per_rank = pin->GetOrAddBoolean(opar.block_name,
-          "single_file_per_rank", false);
-        pnode = new RestartOutput(pin,pm,opar);
+          "single_file_per_rank", !(opar.local_dir.empty()));
+        if (!opar.local_dir.empty() && !opar.single_file_per_rank) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Output block '" << opar.block_name << "' sets local_dir, "
+              << "which requires single_file_per_rank=true" << std::endl;
+          exit(EXIT_FAILURE);
+        }
+        RestartOutput *prst = new RestartOutput(pin,pm,opar);
+        if (!opar.local_dir.empty()) {
+          pdrain = new BurstBuffer("rst/" + opar.file_basename + ".manifest",
+                                   opar.file_number);
+          prst->pdrain = pdrain;
+        }
+        pnode = prst;
         pout_list.push_back(pnode);
         num_rst++;
       } else {
@@ -306,6 +428,14 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
               << "input file" << std::endl;
     exit(EXIT_FAILURE);
   }
+
+  // start I/O thread if any outputs are asynchronous
+  for (BaseTypeOutput* pnode : pout_list) {
+    if (pnode->out_params.async) {
+      if (pasync == nullptr) {pasync = new AsyncOutputWriter();}
+      pnode->pasync_writer = pasync;
+    }
+  }
 }
 
 //----------------------------------------------------------------------------------------
@@ -317,4 +447,8 @@ Outputs::~Outputs() {
     delete pnode;
   }
   pout_list.clear();
+  // finishes any write in progress before stopping I/O thread
+  if (pasync != nullptr) {delete pasync;}
+  // finishes draining any files queued before stopping drain thread
+  if (pdrain != nullptr) {delete pdrain;}
 }
@@ -8,6 +8,7 @@
 //! \file outputs.hpp
 //  \brief provides classes to handle ALL types of data output
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -15,6 +16,8 @@
 
 #include "athena.hpp"
 #include "io_wrapper.hpp"
+#include "burst_buffer.hpp"
+#include "utils/sparse_gather.hpp"
 
 #define NHISTORY_VARIABLES 20
 #if NHISTORY_VARIABLES > NREDUCTION_VARIABLES
@@ -126,6 +129,7 @@ struct OutputParameters {
   bool slice1, slice2, slice3;
   Real slice_x1, slice_x2, slice_x3;
   bool user_hist_only;
+  bool fused_hist=false;      // accumulate history sums in NewTimeStep(), reduce async
   std::string data_format;
   bool contains_derived=false;
   // DBF parameters for coarsened binary:
@@ -144,6 +148,14 @@ struct OutputParameters {
   bool logscale=true, logscale2=true;
   bool mass_weighted=false;
   bool single_file_per_rank=false; // DBF: parameter for single file per rank
+  bool async=false;           // write file on I/O thread (bin, cbin, rst only)
+  bool packed=false;          // rst: store active cells only, one chunk per MeshBlock
+  int compression_level=0;    // rst: zlib level (0-9) of packed chunks, 0=uncompressed
+  bool indexed=false;         // bin: append index of MeshBlock records to end of file
+  bool lossy=false;           // bin: error-bounded lossy compression of each variable
+  Real error_bound=0.0;       // bin: error bound for lossy compression
+  bool relative_error=false;  // bin: error bound is relative to range of values
+  std::string local_dir;      // rst: node-local directory drained to rst/ (if not empty)
 };
 
 //----------------------------------------------------------------------------------------
@@ -218,6 +230,7 @@ class BaseTypeOutput {
   // data
   OutputParameters out_params;   // params read from <output> block for this type
   DvceArray5D<Real> derived_var; // array to store output variables computed from u0/b0
+  AsyncOutputWriter *pasync_writer = nullptr;  // I/O thread used if out_params.async
 
   // function which computes derived output variables like vorticity and current density
   void ComputeDerivedVariable(std::string name, Mesh *pm);
@@ -225,6 +238,14 @@ class BaseTypeOutput {
   // virtual functions may be over-ridden in derived classes
   virtual void LoadOutputData(Mesh *pm);
   virtual void WriteOutputFile(Mesh *pm, ParameterInput *pin) = 0;
+  // called before each cycle, with due=true if output will be made at end of the cycle
+  virtual void PrepareCycle(Mesh *pm, bool due) {}
+  // completes any outstanding work of this output at the end of the run
+  virtual void Finish(Mesh *pm) {}
+  // returns true if output should be made at this time and cycle
+  bool OutputDue(Real time, int ncycle, Real tlim);
+  void SetOutputMeshBlocks(Mesh *pm);
+  void PackOutputData(Mesh *pm, int nhead, bool swap_bytes);
 
   // Functions to detect big endian machine, and to byte-swap 32-bit words.  The vtk
   // legacy format requires data to be stored as big-endian.
@@ -250,6 +271,11 @@ class BaseTypeOutput {
   int noutmbs_min;            // with MPI, minimum number of output MBs across all ranks
   int noutmbs_max;            // with MPI, maximum number of output MBs across all ranks
 
+  // output data converted to float on device, stored as 32-bit words with dims
+  // (m,word), and pinned host copy.  Filled by PackOutputData() (bin and vtk only)
+  DvceArray2D<uint32_t> d_outwords;
+  Kokkos::View<uint32_t **, LayoutWrapper, PinnedMemSpace> h_outwords;
+
   // Following vector will be of length (# output MeshBlocks)
   // With slicing, this may not be same as # of MeshBlocks in calculation
   std::vector<OutputMeshBlockInfo> outmbs;
@@ -285,6 +311,18 @@ class HistoryOutput : public BaseTypeOutput {
   void LoadMHDHistoryData(HistoryData *pdata, Mesh *pm);
   void LoadZ4cHistoryData(HistoryData *pdata, Mesh *pm);
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+  void PrepareCycle(Mesh *pm, bool due) override;
+  void Finish(Mesh *pm) override;
+
+ private:
+  bool fused_due = false;     // sums requested from NewTimeStep() this cycle
+  // with fused=true, data whose (non-blocking) sum over ranks is still outstanding
+  std::vector<HistoryData> pend_data;
+  Real pend_time, pend_dt;
+#if MPI_PARALLEL_ENABLED
+  std::vector<MPI_Request> pend_req;
+#endif
+  void WriteHistoryLines(const std::vector<HistoryData> &data_list, Real time, Real dt);
 };
 
 //----------------------------------------------------------------------------------------
@@ -348,6 +386,7 @@ class PDFOutput : public BaseTypeOutput {
 class MeshVTKOutput : public BaseTypeOutput {
  public:
   MeshVTKOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
+  void LoadOutputData(Mesh *pm) override;
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
 };
 
@@ -367,13 +406,39 @@ class ParticleVTKOutput : public BaseTypeOutput {
   HostArray2D<int>  outpart_idata;
 };
 
+//----------------------------------------------------------------------------------------
+//! \class ParticleBinaryOutput
+//  \brief derived BaseTypeOutput class for particle data in binary format, packed on the
+//  device and written with collective MPI-IO
+
+class ParticleBinaryOutput : public BaseTypeOutput {
+ public:
+  ParticleBinaryOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
+  void LoadOutputData(Mesh *pm) override;
+  void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+ private:
+  std::vector<std::string> field_names;
+  std::vector<int> field_index;   // index in prtcl_rdata (>=0), or -(1+index) in idata
+  int tag_min, tag_max, stride;   // particles output if tag in range and on stride
+  int npout_thisrank;             // number of particles output by this rank
+  std::int64_t npout_total;       // number of particles output by all ranks
+  std::int64_t npout_offset;      // number of particles output by lower ranks
+  // particle data (field,particle) as 4-byte words (float or int), in pinned memory
+  Kokkos::View<uint32_t **, LayoutWrapper, PinnedMemSpace> h_outprtcl;
+};
+
 //----------------------------------------------------------------------------------------
 //! \class MeshBinaryOutput
 //  \brief derived BaseTypeOutput class for binary mesh data (nbf format in pegasus++)
 class MeshBinaryOutput : public BaseTypeOutput {
  public:
   MeshBinaryOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
+  void LoadOutputData(Mesh *pm) override;
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+ private:
+  void WriteIndex(Mesh *pm, IOWrapper &binfile, std::uint64_t index_offset,
+                  const std::vector<std::uint64_t> &rec_offset,
+                  const std::vector<std::uint64_t> &var_offset);
 };
 
 //----------------------------------------------------------------------------------------
@@ -385,6 +450,11 @@ class RestartOutput : public BaseTypeOutput {
   RestartOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
   void LoadOutputData(Mesh *pm) override;
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+  BurstBuffer *pdrain = nullptr;  // drains files written to local_dir (owned by Outputs)
+
+ private:
+  HostArray2D<Real> outarray_chunks;  // active cells of each MB, packed format only
+  void WritePackedData(Mesh *pm, IOWrapper &resfile, IOWrapperSizeT offset);
 };
 
 // Forward declaration
@@ -410,9 +480,37 @@ class CartesianGridOutput : public BaseTypeOutput {
   void LoadOutputData(Mesh *pm) override;
   //! Write the data to file
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+  //! Complete outstanding gather of data
+  void Finish(Mesh *pm) override;
  private:
   CartesianGrid *pcart;
   MetaData md;
+  SparseGather gather;  // collects data at points owned by each rank on root
+};
+
+//----------------------------------------------------------------------------------------
+//! \class ProjectionOutput
+//  \brief derived BaseTypeOutput class for 2D images (column integrals, maxima, or
+//  slices) of mesh data along one coordinate axis, computed on the device
+class ProjectionOutput : public BaseTypeOutput {
+ public:
+  ProjectionOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
+  //! Project data of each MeshBlock into image, and reduce-scatter images over ranks
+  void LoadOutputData(Mesh *pm) override;
+  //! Write the tile of the image owned by each rank to file
+  void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+ private:
+  enum class ProjOp {integral, max, slice};
+  ProjOp proj_op;
+  std::string op_name;
+  int axis;                   // axis along which data is projected (1,2,3)
+  int ax_a, ax_b;             // axes of image (i and j directions of image)
+  int level;                  // physical refinement level of image resolution
+  Real slice_x;               // position of slice along axis (slice only)
+  int nimg_a, nimg_b;         // number of pixels in image
+  int row_start, nrows;       // rows (along ax_b) of image owned by this rank
+  DvceArray3D<Real> d_img;    // image on device with dims (b,n,a)
+  HostArray3D<Real> h_img;    // image on host, reduced over ranks for owned rows only
 };
 
 // Forward declaration
@@ -429,8 +527,11 @@ class SphericalSurfaceOutput : public BaseTypeOutput {
   void LoadOutputData(Mesh *pm) override;
   //! Write the data to file
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+  //! Complete outstanding gather of data
+  void Finish(Mesh *pm) override;
  private:
   SphericalSurface *psurf;
+  SparseGather gather;  // collects data at points owned by each rank on root
 };
 //----------------------------------------------------------------------------------------
 //! \class EventLogOutput
@@ -478,6 +579,10 @@ class Outputs {
 
   // use vector of pointers to BaseTypeOutputs since it is an abstract base class
   std::vector<BaseTypeOutput*> pout_list;
+  // I/O thread shared by all outputs with async=true (nullptr if there are none)
+  AsyncOutputWriter *pasync = nullptr;
+  // drain thread of restart output with local_dir set (nullptr otherwise)
+  BurstBuffer *pdrain = nullptr;
 };
 
 #endif // OUTPUTS_OUTPUTS_HPP_
@@ -0,0 +1,386 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file packed_restart.cpp
+//! \brief packs/unpacks the active cells of each MeshBlock for the ghost-zone-free
+//! restart format, compresses chunks, and reads packed restart files.
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#if ZLIB_ENABLED
+#include <zlib.h>
+#endif
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "mesh/mesh.hpp"
+#include "hydro/hydro.hpp"
+#include "mhd/mhd.hpp"
+#include "coordinates/adm.hpp"
+#include "z4c/z4c.hpp"
+#include "radiation/radiation.hpp"
+#include "srcterms/turb_driver.hpp"
+#include "outputs/io_wrapper.hpp"
+#include "packed_restart.hpp"
+
+namespace packed_restart {
+
+namespace {
+//----------------------------------------------------------------------------------------
+//! \fn void PackCC()
+//! \brief copies cells [kl:ku,jl:ju,il:iu] of variables [0,nvar) of a cell-centered array
+//! into (or, with unpack=true, out of) each row of the chunk buffer starting at offset.
+//! Advances offset past the copied data.
+
+void PackCC(const DvceArray5D<Real> &a, int nmb, int nvar, int il, int iu, int jl,
+            int ju, int kl, int ku, DvceArray2D<Real> &buf, int &offset, bool unpack) {
+  const int ni = iu - il + 1;
+  const int nj = ju - jl + 1;
+  const int nk = ku - kl + 1;
+  const int off = offset;
+  par_for("rst-pack-cc", DevExeSpace(), 0, nmb-1, 0, nvar-1, kl, ku, jl, ju, il, iu,
+  KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+    int indx = off + (((n*nk + (k-kl))*nj + (j-jl))*ni + (i-il));
+    if (unpack) {
+      a(m,n,k,j,i) = buf(m,indx);
+    } else {
+      buf(m,indx) = a(m,n,k,j,i);
+    }
+  });
+  offset += nvar*nk*nj*ni;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void PackFC()
+//! \brief same as PackCC() for one component of a face-centered field
+
+void PackFC(const DvceArray4D<Real> &a, int nmb, int il, int iu, int jl, int ju,
+            int kl, int ku, DvceArray2D<Real> &buf, int &offset, bool unpack) {
+  const int ni = iu - il + 1;
+  const int nj = ju - jl + 1;
+  const int nk = ku - kl + 1;
+  const int off = offset;
+  par_for("rst-pack-fc", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    int indx = off + (((k-kl)*nj + (j-jl))*ni + (i-il));
+    if (unpack) {
+      a(m,k,j,i) = buf(m,indx);
+    } else {
+      buf(m,indx) = a(m,k,j,i);
+    }
+  });
+  offset += nk*nj*ni;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void PackAll()
+//! \brief packs (or unpacks) all dependent variables stored in restart files, in the same
+//! order as the original restart format: hydro, mhd (u0 then b0), rad, turb, z4c or adm.
+
+void PackAll(MeshBlockPack *pmbp, DvceArray2D<Real> &buf, bool unpack) {
+  auto &indcs = pmbp->pmesh->mb_indcs;
+  int is = indcs.is, ie = indcs.ie;
+  int js = indcs.js, je = indcs.je;
+  int ks = indcs.ks, ke = indcs.ke;
+  int nmb = pmbp->nmb_thispack;
+  int offset = 0;
+
+  if (pmbp->phydro != nullptr) {
+    auto &u0 = pmbp->phydro->u0;
+    int nvar = pmbp->phydro->nhydro + pmbp->phydro->nscalars;
+    PackCC(u0, nmb, nvar, is, ie, js, je, ks, ke, buf, offset, unpack);
+  }
+  if (pmbp->pmhd != nullptr) {
+    auto &u0 = pmbp->pmhd->u0;
+    auto &b0 = pmbp->pmhd->b0;
+    int nvar = pmbp->pmhd->nmhd + pmbp->pmhd->nscalars;
+    PackCC(u0, nmb, nvar, is, ie, js, je, ks, ke, buf, offset, unpack);
+    PackFC(b0.x1f, nmb, is, ie+1, js, je, ks, ke, buf, offset, unpack);
+    PackFC(b0.x2f, nmb, is, ie, js, je+1, ks, ke, buf, offset, unpack);
+    PackFC(b0.x3f, nmb, is, ie, js, je, ks, ke+1, buf, offset, unpack);
+  }
+  if (pmbp->prad != nullptr) {
+    auto &i0 = pmbp->prad->i0;
+    int nvar = pmbp->prad->prgeo->nangles;
+    PackCC(i0, nmb, nvar, is, ie, js, je, ks, ke, buf, offset, unpack);
+  }
+  if (pmbp->pturb != nullptr) {
+    auto &force = pmbp->pturb->force;
+    PackCC(force, nmb, 3, is, ie, js, je, ks, ke, buf, offset, unpack);
+  }
+  if (pmbp->pz4c != nullptr) {
+    auto &u0 = pmbp->pz4c->u0;
+    PackCC(u0, nmb, pmbp->pz4c->nz4c, is, ie, js, je, ks, ke, buf, offset, unpack);
+  } else if (pmbp->padm != nullptr) {
+    // ADM variables are not evolved, and their ghost zones are not communicated
+    auto &u_adm = pmbp->padm->u_adm;
+    int ncells1 = indcs.nx1 + 2*(indcs.ng);
+    int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+    int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+    PackCC(u_adm, nmb, pmbp->padm->nadm, 0, ncells1-1, 0, ncells2-1, 0, ncells3-1,
+           buf, offset, unpack);
+  }
+  return;
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn std::size_t ChunkSize()
+//! \brief returns the number of Reals in the (uncompressed) chunk of each MeshBlock
+
+std::size_t ChunkSize(MeshBlockPack *pmbp) {
+  auto &indcs = pmbp->pmesh->mb_indcs;
+  std::size_t nx1 = indcs.nx1, nx2 = indcs.nx2, nx3 = indcs.nx3;
+  std::size_t ncells = nx1*nx2*nx3;
+  std::size_t nreal = 0;
+  if (pmbp->phydro != nullptr) {
+    nreal += (pmbp->phydro->nhydro + pmbp->phydro->nscalars)*ncells;
+  }
+  if (pmbp->pmhd != nullptr) {
+    nreal += (pmbp->pmhd->nmhd + pmbp->pmhd->nscalars)*ncells;
+    nreal += (nx1+1)*nx2*nx3 + nx1*(nx2+1)*nx3 + nx1*nx2*(nx3+1);
+  }
+  if (pmbp->prad != nullptr) {
+    nreal += (pmbp->prad->prgeo->nangles)*ncells;
+  }
+  if (pmbp->pturb != nullptr) {
+    nreal += 3*ncells;
+  }
+  if (pmbp->pz4c != nullptr) {
+    nreal += (pmbp->pz4c->nz4c)*ncells;
+  } else if (pmbp->padm != nullptr) {
+    std::size_t ncells1 = indcs.nx1 + 2*(indcs.ng);
+    std::size_t ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+    std::size_t ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+    nreal += (pmbp->padm->nadm)*ncells1*ncells2*ncells3;
+  }
+  return nreal;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Pack()
+//! \brief packs active cells of all MeshBlocks on device, and copies them into the host
+//! array hbuf, dimensioned (nmb, ChunkSize())
+
+void Pack(MeshBlockPack *pmbp, HostArray2D<Real> &hbuf) {
+  int nmb = pmbp->nmb_thispack;
+  std::size_t nreal = ChunkSize(pmbp);
+  DvceArray2D<Real> buf("rst-chunks", nmb, nreal);
+  PackAll(pmbp, buf, false);
+  Kokkos::realloc(hbuf, nmb, nreal);
+  Kokkos::deep_copy(hbuf, buf);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Unpack()
+//! \brief inverse of Pack().  Ghost zones of the dependent variables are set to zero,
+//! and must be filled by Driver::InitBoundaryValuesAndPrimitives().
+
+void Unpack(MeshBlockPack *pmbp, const HostArray2D<Real> &hbuf) {
+  int nmb = pmbp->nmb_thispack;
+  DvceArray2D<Real> buf("rst-chunks", nmb, hbuf.extent_int(1));
+  Kokkos::deep_copy(buf, hbuf);
+  if (pmbp->phydro != nullptr) {Kokkos::deep_copy(pmbp->phydro->u0, 0.0);}
+  if (pmbp->pmhd != nullptr) {
+    Kokkos::deep_copy(pmbp->pmhd->u0, 0.0);
+    Kokkos::deep_copy(pmbp->pmhd->b0.x1f, 0.0);
+    Kokkos::deep_copy(pmbp->pmhd->b0.x2f, 0.0);
+    Kokkos::deep_copy(pmbp->pmhd->b0.x3f, 0.0);
+  }
+  if (pmbp->prad != nullptr) {Kokkos::deep_copy(pmbp->prad->i0, 0.0);}
+  if (pmbp->pturb != nullptr) {Kokkos::deep_copy(pmbp->pturb->force, 0.0);}
+  if (pmbp->pz4c != nullptr) {Kokkos::deep_copy(pmbp->pz4c->u0, 0.0);}
+  PackAll(pmbp, buf, true);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Compress()
+//! \brief losslessly compresses nreal Reals into out.  The bytes of the Reals are first
+//! shuffled (all first bytes, then all second bytes, ...), which groups the slowly
+//! varying sign/exponent bytes of smooth data and makes them far more compressible.
+
+void Compress(const Real *in, std::size_t nreal, int level, std::vector<char> &out) {
+#if ZLIB_ENABLED
+  const std::size_t nb = sizeof(Real);
+  const unsigned char *bytes = reinterpret_cast<const unsigned char *>(in);
+  std::vector<unsigned char> shuffled(nreal*nb);
+  for (std::size_t b=0; b<nb; ++b) {
+    for (std::size_t n=0; n<nreal; ++n) {
+      shuffled[b*nreal + n] = bytes[n*nb + b];
+    }
+  }
+  uLongf zsize = compressBound(static_cast<uLong>(shuffled.size()));
+  out.resize(zsize);
+  int ierr = compress2(reinterpret_cast<Bytef *>(out.data()), &zsize, shuffled.data(),
+                       static_cast<uLong>(shuffled.size()), level);
+  if (ierr != Z_OK) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "zlib compression of restart data failed with error "
+              << ierr << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  out.resize(zsize);
+#else
+  std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "Compressed restart files require zlib; configure with "
+            << "-D Athena_ENABLE_ZLIB=ON" << std::endl;
+  std::exit(EXIT_FAILURE);
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Decompress()
+//! \brief inverse of Compress()
+
+void Decompress(const char *in, std::size_t nbytes, Real *out, std::size_t nreal) {
+#if ZLIB_ENABLED
+  const std::size_t nb = sizeof(Real);
+  std::vector<unsigned char> shuffled(nreal*nb);
+  uLongf size = static_cast<uLongf>(shuffled.size());
+  int ierr = uncompress(shuffled.data(), &size, reinterpret_cast<const Bytef *>(in),
+                        static_cast<uLong>(nbytes));
+  if (ierr != Z_OK || size != shuffled.size()) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "zlib decompression of restart data failed, restart file "
+              << "is broken." << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  unsigned char *bytes = reinterpret_cast<unsigned char *>(out);
+  for (std::size_t b=0; b<nb; ++b) {
+    for (std::size_t n=0; n<nreal; ++n) {
+      bytes[n*nb + b] = shuffled[b*nreal + n];
+    }
+  }
+#else
+  std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "Restart file is compressed, but code was not configured "
+            << "with -D Athena_ENABLE_ZLIB=ON" << std::endl;
+  std::exit(EXIT_FAILURE);
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ReadData()
+//! \brief reads the chunk header, index and chunks of a packed restart file, and unpacks
+//! them into the dependent variables.  Called by the ProblemGenerator restart constructor
+//! after it has read kTag, so the file pointer (of the root rank, unless
+//! single_file_per_rank) is at the remainder of the chunk header.
+
+void ReadData(Mesh *pm, IOWrapper &resfile, bool single_file_per_rank) {
+  MeshBlockPack *pmbp = pm->pmb_pack;
+  int nmb = pm->nmb_thisrank;
+  bool root = (global_variable::my_rank == 0 || single_file_per_rank);
+
+  // read raw_size, compression_level and nchunks
+  IOWrapperSizeT hdr[kNHeader-1];
+  if (root) {
+    if (resfile.Read_bytes(&hdr[0], sizeof(IOWrapperSizeT), kNHeader-1,
+                           single_file_per_rank) != kNHeader-1) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Chunk header not read correctly from restart file, "
+                << "restart file is broken." << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+  }
+#if MPI_PARALLEL_ENABLED
+  if (!single_file_per_rank) {
+    MPI_Bcast(&hdr[0], sizeof(hdr), MPI_CHAR, 0, MPI_COMM_WORLD);
+  }
+#endif
+  IOWrapperSizeT raw_size = hdr[0];
+  int level = static_cast<int>(hdr[1]);
+  IOWrapperSizeT nchunks = hdr[2];
+  std::size_t nreal = ChunkSize(pmbp);
+  IOWrapperSizeT nchunks_expected = single_file_per_rank ? nmb : pm->nmb_total;
+  if (raw_size != nreal*sizeof(Real) || nchunks != nchunks_expected) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Chunk size or number of chunks in restart file does not "
+              << "match the Mesh and physics of this run, restart file is broken."
+              << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // read chunk index
+  std::vector<IOWrapperSizeT> index(nchunks+1);
+  if (root) {
+    if (resfile.Read_bytes(index.data(), sizeof(IOWrapperSizeT), nchunks+1,
+                           single_file_per_rank) != nchunks+1) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Chunk index not read correctly from restart file, "
+                << "restart file is broken." << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+  }
+  IOWrapperSizeT dataoffset = 0;
+  if (root) {
+    dataoffset = resfile.GetPosition(single_file_per_rank);
+  }
+#if MPI_PARALLEL_ENABLED
+  if (!single_file_per_rank) {
+    MPI_Bcast(index.data(), (nchunks+1)*sizeof(IOWrapperSizeT), MPI_CHAR, 0,
+              MPI_COMM_WORLD);
+    MPI_Bcast(&dataoffset, sizeof(IOWrapperSizeT), MPI_CHAR, 0, MPI_COMM_WORLD);
+  }
+#endif
+
+  // calculate max/min number of MeshBlocks across all ranks
+  int noutmbs_max = pm->nmb_eachrank[0];
+  int noutmbs_min = pm->nmb_eachrank[0];
+  for (int i=0; i<(global_variable::nranks); ++i) {
+    noutmbs_max = std::max(noutmbs_max,pm->nmb_eachrank[i]);
+    noutmbs_min = std::min(noutmbs_min,pm->nmb_eachrank[i]);
+  }
+  if (single_file_per_rank) {
+    noutmbs_max = nmb;
+    noutmbs_min = nmb;
+  }
+
+  // read chunks one MeshBlock at a time, collectively while every rank has one to read
+  HostArray2D<Real> hbuf("rst-chunks-in", nmb, nreal);
+  std::vector<char> zbuf;
+  for (int m=0; m<noutmbs_max; ++m) {
+    if (m >= nmb) continue;   // this rank has no more MeshBlocks to read
+    int n = single_file_per_rank ? m : pm->gids_eachrank[global_variable::my_rank] + m;
+    IOWrapperSizeT nbytes = index[n+1] - index[n];
+    IOWrapperSizeT offset = dataoffset + index[n];
+    char *pdata = reinterpret_cast<char *>(&hbuf(m,0));
+    if (level > 0) {
+      zbuf.resize(nbytes);
+      pdata = zbuf.data();
+    } else if (nbytes != raw_size) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Uncompressed chunk has wrong size, restart file is "
+                << "broken." << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    std::size_t nread;
+    if (m < noutmbs_min) {
+      nread = resfile.Read_bytes_at_all(pdata, 1, nbytes, offset, single_file_per_rank);
+    } else {
+      nread = resfile.Read_bytes_at(pdata, 1, nbytes, offset, single_file_per_rank);
+    }
+    if (nread != nbytes) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Chunk of MeshBlock " << n << " not read correctly "
+                << "from restart file, restart file is broken." << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (level > 0) {
+      Decompress(zbuf.data(), nbytes, &hbuf(m,0), nreal);
+    }
+  }
+  Unpack(pmbp, hbuf);
+  return;
+}
+
+} // namespace packed_restart
@@ -0,0 +1,51 @@
+#ifndef OUTPUTS_PACKED_RESTART_HPP_
+#define OUTPUTS_PACKED_RESTART_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file packed_restart.hpp
+//  \brief functions for the ghost-zone-free ("packed") restart format
+//
+// With <output>/packed=true the dependent variables of each MeshBlock are written to the
+// restart file as one contiguous chunk that contains only the active cells (and active
+// faces of the face-centered magnetic field).  Ghost zones are refilled on restart by
+// Driver::InitBoundaryValuesAndPrimitives().  The exception is the ADM variables when
+// they are not evolved by Z4c, which are never communicated and so are stored with their
+// ghost zones.  Each chunk can optionally be compressed losslessly with zlib.
+//
+// After the header data read by Mesh::BuildTreeFromRestart(), the file contains:
+//   kTag, raw_size, compression_level, nchunks     (4 x IOWrapperSizeT)
+//   index[0..nchunks]                               (IOWrapperSizeT)
+//   chunk data
+// where chunk n occupies bytes [index[n], index[n+1]) measured from the start of the
+// chunk data, and raw_size is the size of a chunk before compression.  Chunks are
+// ordered by MeshBlock gid, or by local MeshBlock index with single_file_per_rank.
+
+#include <cstddef>
+#include <vector>
+
+#include "athena.hpp"
+#include "outputs/io_wrapper.hpp"
+
+class Mesh;
+class MeshBlockPack;
+
+namespace packed_restart {
+
+// Stored in place of the variable data size of the original restart format, which is
+// always much smaller, so the format of a restart file can be detected on reading.
+constexpr IOWrapperSizeT kTag = 0x417468656e614b32ULL;   // "AthenaK2"
+// number of IOWrapperSizeT words (including kTag) before the chunk index
+constexpr int kNHeader = 4;
+
+std::size_t ChunkSize(MeshBlockPack *pmbp);
+void Pack(MeshBlockPack *pmbp, HostArray2D<Real> &hbuf);
+void Unpack(MeshBlockPack *pmbp, const HostArray2D<Real> &hbuf);
+void Compress(const Real *in, std::size_t nreal, int level, std::vector<char> &out);
+void Decompress(const char *in, std::size_t nbytes, Real *out, std::size_t nreal);
+void ReadData(Mesh *pm, IOWrapper &resfile, bool single_file_per_rank);
+
+} // namespace packed_restart
+#endif // OUTPUTS_PACKED_RESTART_HPP_
@@ -0,0 +1,304 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file projection.cpp
+//! \brief writes 2D images of mesh data projected along one coordinate axis.
+//!
+//! Each output variable is either integrated along the axis (operation=integral), its
+//! maximum along the axis is taken (operation=max), or it is sliced at a position along
+//! the axis (operation=slice).  Images have the resolution of the physical refinement
+//! level 'level' (default: finest level in the Mesh).  Data on finer MeshBlocks is
+//! averaged (or for max, maximized) into each pixel, data on coarser MeshBlocks is
+//! copied into every pixel it covers.
+//!
+//! The partial image of each rank is computed on the device, one kernel per array of
+//! output variables, after which the images are summed (or maximized) over ranks with
+//! MPI_Reduce_scatter so that each rank holds a contiguous tile of rows of the final
+//! image, which it then writes to the output file.  The file consists of a text header
+//! followed by each variable as a (nimg_b x nimg_a) array of floats, i.e. with the pixel
+//! index along the first image axis varying fastest.
+
+#include <sys/stat.h>  // mkdir
+
+#include <cstdint>
+#include <cstdio>      // snprintf
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "parameter_input.hpp"
+#include "coordinates/cell_locations.hpp"
+#include "mesh/mesh.hpp"
+#include "outputs.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+//----------------------------------------------------------------------------------------
+// ctor: also calls BaseTypeOutput base class constructor
+
+ProjectionOutput::ProjectionOutput(ParameterInput *pin, Mesh *pm, OutputParameters op) :
+  BaseTypeOutput(pin, pm, op) {
+  mkdir("proj",0775);
+
+  axis = pin->GetOrAddInteger(op.block_name, "axis", 3);
+  op_name = pin->GetOrAddString(op.block_name, "operation", "integral");
+  level = pin->GetOrAddInteger(op.block_name, "level", pm->max_level - pm->root_level);
+  if (op_name.compare("integral") == 0) {
+    proj_op = ProjOp::integral;
+  } else if (op_name.compare("max") == 0) {
+    proj_op = ProjOp::max;
+  } else if (op_name.compare("slice") == 0) {
+    proj_op = ProjOp::slice;
+  } else {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "Output block '" << op.block_name << "' has operation="
+        << op_name << ", must be 'integral', 'max' or 'slice'" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  if (axis < 1 || axis > 3 || level < 0) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "Output block '" << op.block_name << "' has axis=" << axis
+        << " and level=" << level << ", axis must be 1, 2 or 3 and level >= 0"
+        << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  // image axes are the other two axes, in order
+  ax_a = (axis == 1) ? 2 : 1;
+  ax_b = (axis == 3) ? 2 : 3;
+  int mesh_nx[3] = {pm->mesh_indcs.nx1, pm->mesh_indcs.nx2, pm->mesh_indcs.nx3};
+  Real mesh_min[3] = {pm->mesh_size.x1min, pm->mesh_size.x2min, pm->mesh_size.x3min};
+  Real mesh_max[3] = {pm->mesh_size.x1max, pm->mesh_size.x2max, pm->mesh_size.x3max};
+  // dimensions with a single cell are never refined
+  nimg_a = (mesh_nx[ax_a-1] > 1) ? (mesh_nx[ax_a-1] << level) : 1;
+  nimg_b = (mesh_nx[ax_b-1] > 1) ? (mesh_nx[ax_b-1] << level) : 1;
+
+  if (proj_op == ProjOp::slice) {
+    slice_x = pin->GetReal(op.block_name, "slice_position");
+    if (slice_x < mesh_min[axis-1] || slice_x >= mesh_max[axis-1]) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "Output block '" << op.block_name << "' has slice_position="
+          << slice_x << " outside of Mesh" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  // rows of image owned by this rank after reduction
+  int nranks = global_variable::nranks, rank = global_variable::my_rank;
+  row_start = (static_cast<std::int64_t>(nimg_b)*rank)/nranks;
+  nrows = (static_cast<std::int64_t>(nimg_b)*(rank+1))/nranks - row_start;
+
+  int nout_vars = outvars.size();
+  Kokkos::realloc(d_img, nimg_b, nout_vars, nimg_a);
+  Kokkos::realloc(h_img, nimg_b, nout_vars, nimg_a);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ProjectionOutput::LoadOutputData()
+//! \brief projects data on each MeshBlock into image on device, then reduces images
+//! over all ranks so that each rank holds its tile of rows of the final image.
+
+void ProjectionOutput::LoadOutputData(Mesh *pm) {
+  // Calculate derived variables, if required
+  if (out_params.contains_derived) {
+    ComputeDerivedVariable(out_params.variable, pm);
+  }
+
+  auto &indcs = pm->mb_indcs;
+  int nmb = pm->pmb_pack->nmb_thispack;
+  int nout_vars = outvars.size();
+  int nx[3] = {indcs.nx1, indcs.nx2, indcs.nx3};
+  int na = nx[ax_a-1], nb = nx[ax_b-1], nc = nx[axis-1];
+
+  // For each MeshBlock store first cell along image axes (global index at level of MB),
+  // difference in level from image along image axes, and index of cell along projection
+  // axis (slice only, < 0 if slice does not intersect MeshBlock)
+  DualArray2D<int> mbinfo("proj_mbs", nmb, 5);
+  auto &size = pm->pmb_pack->pmb->mb_size;
+  for (int m=0; m<nmb; ++m) {
+    LogicalLocation loc = pm->lloc_eachmb[pm->pmb_pack->pmb->mb_gid.h_view(m)];
+    int lx[3] = {loc.lx1, loc.lx2, loc.lx3};
+    int dlev = loc.level - pm->root_level - level;
+    mbinfo.h_view(m,0) = lx[ax_a-1]*na;
+    mbinfo.h_view(m,1) = lx[ax_b-1]*nb;
+    mbinfo.h_view(m,2) = (na > 1) ? dlev : 0;
+    mbinfo.h_view(m,3) = (nb > 1) ? dlev : 0;
+    mbinfo.h_view(m,4) = 0;
+    if (proj_op == ProjOp::slice) {
+      Real xmin[3] = {size.h_view(m).x1min, size.h_view(m).x2min, size.h_view(m).x3min};
+      Real xmax[3] = {size.h_view(m).x1max, size.h_view(m).x2max, size.h_view(m).x3max};
+      if (slice_x < xmin[axis-1] || slice_x >= xmax[axis-1]) {
+        mbinfo.h_view(m,4) = -1;
+      } else {
+        mbinfo.h_view(m,4) = CellCenterIndex(slice_x, nc, xmin[axis-1], xmax[axis-1]);
+      }
+    }
+  }
+  mbinfo.template modify<HostMemSpace>();
+  mbinfo.template sync<DevExeSpace>();
+
+  Real init = (proj_op == ProjOp::max) ? -std::numeric_limits<Real>::max() : 0.0;
+  Kokkos::deep_copy(d_img, init);
+
+  // launch one kernel for each distinct device array containing output variables
+  std::vector<bool> done(nout_vars, false);
+  auto img = d_img;
+  int is = indcs.is, js = indcs.js, ks = indcs.ks;
+  int ax = axis;
+  ProjOp op_ = proj_op;
+  for (int n0=0; n0<nout_vars; ++n0) {
+    if (done[n0]) continue;
+    std::vector<int> vars;
+    for (int n=n0; n<nout_vars; ++n) {
+      if (outvars[n].data_ptr == outvars[n0].data_ptr) {vars.push_back(n);}
+    }
+    int nvars = vars.size();
+    DualArray2D<int> ovar("proj_vars", nvars, 2);
+    for (int v=0; v<nvars; ++v) {
+      ovar.h_view(v,0) = vars[v];
+      ovar.h_view(v,1) = outvars[vars[v]].data_index;
+      done[vars[v]] = true;
+    }
+    ovar.template modify<HostMemSpace>();
+    ovar.template sync<DevExeSpace>();
+
+    auto src = *(outvars[n0].data_ptr);
+    par_for("proj", DevExeSpace(), 0, nmb-1, 0, nvars-1, 0, nb-1, 0, na-1,
+    KOKKOS_LAMBDA(int m, int v, int jb, int ia) {
+      int cslice = mbinfo.d_view(m,4);
+      if (cslice < 0) return;
+      int cl = (op_ == ProjOp::slice) ? cslice : 0;
+      int cu = (op_ == ProjOp::slice) ? cslice : nc-1;
+
+      // reduce along projection axis within MeshBlock
+      Real val = (op_ == ProjOp::max) ? init : 0.0;
+      for (int c=cl; c<=cu; ++c) {
+        int i = (ax == 1) ? c : ia;
+        int j = (ax == 1) ? ia : ((ax == 2) ? c : jb);
+        int k = (ax == 3) ? c : jb;
+        Real q = src(m, ovar.d_view(v,1), ks+k, js+j, is+i);
+        val = (op_ == ProjOp::max) ? fmax(val, q) : (val + q);
+      }
+      if (op_ == ProjOp::integral) {
+        val *= (ax == 1) ? size.d_view(m).dx1 :
+               ((ax == 2) ? size.d_view(m).dx2 : size.d_view(m).dx3);
+      }
+
+      // deposit into pixels covered by this cell: finer cells are averaged into one
+      // pixel, coarser cells are copied into several pixels
+      int ga = mbinfo.d_view(m,0) + ia, gb = mbinfo.d_view(m,1) + jb;
+      int sa = mbinfo.d_view(m,2), sb = mbinfo.d_view(m,3);
+      int pa0 = (sa >= 0) ? (ga >> sa) : (ga << (-sa));
+      int pa1 = (sa >= 0) ? pa0 : (((ga + 1) << (-sa)) - 1);
+      int pb0 = (sb >= 0) ? (gb >> sb) : (gb << (-sb));
+      int pb1 = (sb >= 0) ? pb0 : (((gb + 1) << (-sb)) - 1);
+      Real weight = 1.0/static_cast<Real>((1 << ((sa > 0) ? sa : 0))*
+                                          (1 << ((sb > 0) ? sb : 0)));
+      int n = ovar.d_view(v,0);
+      for (int pb=pb0; pb<=pb1; ++pb) {
+        for (int pa=pa0; pa<=pa1; ++pa) {
+          if (op_ == ProjOp::max) {
+            Kokkos::atomic_max(&img(pb,n,pa), val);
+          } else {
+            Kokkos::atomic_add(&img(pb,n,pa), weight*val);
+          }
+        }
+      }
+    });
+  }
+
+  // combine partial images of all ranks, leaving owned rows on each rank
+#if MPI_PARALLEL_ENABLED
+  auto h_part = Kokkos::create_mirror_view_and_copy(HostMemSpace(), d_img);
+  std::vector<int> counts(global_variable::nranks);
+  for (int r=0; r<global_variable::nranks; ++r) {
+    int r0 = (static_cast<std::int64_t>(nimg_b)*r)/global_variable::nranks;
+    int r1 = (static_cast<std::int64_t>(nimg_b)*(r+1))/global_variable::nranks;
+    counts[r] = (r1 - r0)*nout_vars*nimg_a;
+  }
+  MPI_Reduce_scatter(h_part.data(), h_img.data(), counts.data(), MPI_ATHENA_REAL,
+                     (proj_op == ProjOp::max) ? MPI_MAX : MPI_SUM, MPI_COMM_WORLD);
+#else
+  Kokkos::deep_copy(h_img, d_img);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ProjectionOutput::WriteOutputFile()
+//! \brief writes header, then each rank writes its rows of the image of each variable
+
+void ProjectionOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
+  // create filename: "proj/file_basename" + "." + "file_id" + "." + XXXXX + ".proj"
+  char number[7];
+  std::snprintf(number, sizeof(number), ".%05d", out_params.file_number);
+  std::string fname = std::string("proj/") + out_params.file_basename + "."
+                    + out_params.file_id + number + ".proj";
+  IOWrapper projfile;
+  projfile.Open(fname.c_str(), IOWrapper::FileMode::write);
+
+  int nout_vars = outvars.size();
+  Real mesh_min[3] = {pm->mesh_size.x1min, pm->mesh_size.x2min, pm->mesh_size.x3min};
+  Real mesh_max[3] = {pm->mesh_size.x1max, pm->mesh_size.x2max, pm->mesh_size.x3max};
+  std::stringstream msg;
+  msg << "Athena projection output version=1.0" << std::endl
+      << std::scientific
+      << std::setprecision(std::numeric_limits<Real>::max_digits10 - 1)
+      << "  time=" << pm->time << std::endl
+      << "  cycle=" << pm->ncycle << std::endl
+      << "  axis=" << axis << std::endl
+      << "  operation=" << op_name << std::endl;
+  if (proj_op == ProjOp::slice) {
+    msg << "  slice position=" << slice_x << std::endl;
+  }
+  msg << "  level=" << level << std::endl
+      << "  image size=" << nimg_a << " " << nimg_b << std::endl
+      << "  image axes=" << ax_a << " " << ax_b << std::endl
+      << "  image extent=" << mesh_min[ax_a-1] << " " << mesh_max[ax_a-1] << " "
+      << mesh_min[ax_b-1] << " " << mesh_max[ax_b-1] << std::endl
+      << "  size of variable=" << sizeof(float) << std::endl
+      << "  number of variables=" << nout_vars << std::endl
+      << "  variables:  ";
+  for (int n=0; n<nout_vars; ++n) {
+    msg << outvars[n].label << "  ";
+  }
+  msg << std::endl;
+  std::string header = msg.str();
+  if (global_variable::my_rank == 0) {
+    projfile.Write_any_type(header.c_str(), header.size(), "byte");
+  }
+
+  // write rows of image owned by this rank
+  std::vector<float> rows(static_cast<std::size_t>(nrows)*nimg_a);
+  for (int n=0; n<nout_vars; ++n) {
+    for (int jb=0; jb<nrows; ++jb) {
+      for (int ia=0; ia<nimg_a; ++ia) {
+        rows[jb*nimg_a + ia] = static_cast<float>(h_img(jb,n,ia));
+      }
+    }
+    std::size_t offset = header.size() + sizeof(float)*nimg_a*
+                         (static_cast<std::size_t>(n)*nimg_b + row_start);
+    projfile.Write_any_type_at_all(rows.data(), rows.size()*sizeof(float), offset,
+                                   "byte");
+  }
+  projfile.Close();
+
+  // increment counters
+  out_params.file_number++;
+  if (out_params.last_time < 0.0) {
+    out_params.last_time = pm->time;
+  } else {
+    out_params.last_time += out_params.dt;
+  }
+  pin->SetInteger(out_params.block_name, "file_number", out_params.file_number);
+  pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
+}
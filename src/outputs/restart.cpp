@@ -16,6 +16,7 @@
 #include <sstream>
 #include <string>
 #include <utility> // make_pair
+#include <vector>
 
 #include "athena.hpp"
 #include "coordinates/cell_locations.hpp"
@@ -29,6 +30,7 @@
 #include "z4c/z4c.hpp"
 #include "radiation/radiation.hpp"
 #include "srcterms/turb_driver.hpp"
+#include "packed_restart.hpp"
 //#include "outputs.hpp"
 
 //----------------------------------------------------------------------------------------
@@ -44,14 +46,35 @@ RestartOutput::RestartOutput(ParameterInput *pin, Mesh *pm, OutputParameters op)
     std::snprintf(rank_dir, sizeof(rank_dir), "rst/rank_%08d/", global_variable::my_rank);
     mkdir(rank_dir, 0775);
   }
+  // node-local directory for restart files that are drained to rst/ in the background
+  if (!op.local_dir.empty()) {
+    char rank_dir[20];
+    std::snprintf(rank_dir, sizeof(rank_dir), "/rank_%08d", global_variable::my_rank);
+    mkdir(op.local_dir.c_str(), 0775);
+    mkdir((op.local_dir + rank_dir).c_str(), 0775);
+  }
 }
 
 //----------------------------------------------------------------------------------------
 // RestartOutput::LoadOutputData()
 // overload of standard load data function specific to restarts.  Loads dependent
-// variables, including ghost zones.
+// variables, including ghost zones unless <output>/packed=true.
 
 void RestartOutput::LoadOutputData(Mesh *pm) {
+  // calculate max/min number of MeshBlocks across all ranks
+  noutmbs_max = pm->nmb_eachrank[0];
+  noutmbs_min = pm->nmb_eachrank[0];
+  for (int i=0; i<(global_variable::nranks); ++i) {
+    noutmbs_max = std::max(noutmbs_max,pm->nmb_eachrank[i]);
+    noutmbs_min = std::min(noutmbs_min,pm->nmb_eachrank[i]);
+  }
+
+  // packed format: active cells of all variables are packed on the device
+  if (out_params.packed) {
+    packed_restart::Pack(pm->pmb_pack, outarray_chunks);
+    return;
+  }
+
   // get spatial dimensions of arrays, including ghost zones
   auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
   int nout1 = indcs.nx1 + 2*(indcs.ng);
@@ -123,13 +146,6 @@ void RestartOutput::LoadOutputData(Mesh *pm) {
                       Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
   }
 
-  // calculate max/min number of MeshBlocks across all ranks
-  noutmbs_max = pm->nmb_eachrank[0];
-  noutmbs_min = pm->nmb_eachrank[0];
-  for (int i=0; i<(global_variable::nranks); ++i) {
-    noutmbs_max = std::max(noutmbs_max,pm->nmb_eachrank[i]);
-    noutmbs_min = std::min(noutmbs_min,pm->nmb_eachrank[i]);
-  }
 }
 
 //----------------------------------------------------------------------------------------
@@ -165,7 +181,8 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     nadm = padm->nadm;
   }
   bool single_file_per_rank = out_params.single_file_per_rank;
-  std::string fname;
+  std::string fname, shared_fname;
+  int file_number = out_params.file_number;
   if (single_file_per_rank) {
     // Generate a directory and filename for each rank
     // create filename: "rst/rank_YYYYYYY/file_basename" + "." + XXXXX + ".rst"
@@ -177,6 +194,12 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     std::snprintf(rank_dir, sizeof(rank_dir), "rank_%08d/", global_variable::my_rank);
     fname = std::string("rst/") + std::string(rank_dir) + out_params.file_basename
       + number + ".rst";
+    // with a node-local directory, file is written there and drained to fname later
+    if (pdrain != nullptr) {
+      shared_fname = fname;
+      fname = out_params.local_dir + "/" + std::string(rank_dir)
+        + out_params.file_basename + number + ".rst";
+    }
 
     // Debugging output to check directory and filename
     // std::cout << "Rank " << global_variable::my_rank << " generated filename: "
@@ -210,6 +233,7 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
 
   // open file and  write the header; this part is serial
   IOWrapper resfile;
+  resfile.SetAsync(pasync_writer);  // nullptr unless <output>/async=true
   resfile.Open(fname.c_str(), IOWrapper::FileMode::write, single_file_per_rank);
   if (global_variable::my_rank == 0 || single_file_per_rank) {
     // output the input parameters (input file)
@@ -267,6 +291,25 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   //--- STEP 4.  All ranks write data over all MeshBlocks (5D arrays) in parallel
   // This data read in ProblemGenerator constructor for restarts
 
+  // calculate size of data written in Steps 1-3 above
+  IOWrapperSizeT step1size = sbuf.size()*sizeof(char) + 3*sizeof(int) + 2*sizeof(Real) +
+                             sizeof(RegionSize) + 2*sizeof(RegionIndcs);
+  IOWrapperSizeT step2size = (pm->nmb_total)*(sizeof(LogicalLocation) + sizeof(float));
+
+  IOWrapperSizeT step3size = 3*nco*sizeof(Real);
+  if (pz4c != nullptr) step3size += sizeof(Real);
+  if (pturb != nullptr) step3size += sizeof(RNG_State);
+
+  if (out_params.packed) {
+    WritePackedData(pm, resfile, step1size + step2size + step3size);
+    resfile.Close(single_file_per_rank);
+    if (pdrain != nullptr) {
+      pdrain->Submit(fname, shared_fname, file_number);
+      pdrain->UpdateManifest(false);
+    }
+    return;
+  }
+
   // total size of all cell-centered variables and face-centered fields to be written by
   // this rank
   IOWrapperSizeT data_size = 0;
@@ -295,15 +338,6 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
                             single_file_per_rank);
   }
 
-  // calculate size of data written in Steps 1-2 above
-  IOWrapperSizeT step1size = sbuf.size()*sizeof(char) + 3*sizeof(int) + 2*sizeof(Real) +
-                             sizeof(RegionSize) + 2*sizeof(RegionIndcs);
-  IOWrapperSizeT step2size = (pm->nmb_total)*(sizeof(LogicalLocation) + sizeof(float));
-
-  IOWrapperSizeT step3size = 3*nco*sizeof(Real);
-  if (pz4c != nullptr) step3size += sizeof(Real);
-  if (pturb != nullptr) step3size += sizeof(RNG_State);
-
   // write cell-centered variables in parallel
   IOWrapperSizeT offset_myrank = (step1size + step2size + step3size
                                   + sizeof(IOWrapperSizeT));
@@ -626,5 +660,87 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   // close file, clean up
   resfile.Close(single_file_per_rank);
 
+  // queue drain of node-local file, and record earlier checkpoints that are now drained
+  if (pdrain != nullptr) {
+    pdrain->Submit(fname, shared_fname, file_number);
+    pdrain->UpdateManifest(false);
+  }
+
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void RestartOutput::WritePackedData()
+//  \brief Writes the chunk header, chunk index, and (optionally compressed) chunk of
+//  active cells of each MeshBlock, starting at 'offset' bytes into the file.  Format is
+//  described in packed_restart.hpp.  Data is read by packed_restart::ReadData().
+
+void RestartOutput::WritePackedData(Mesh *pm, IOWrapper &resfile, IOWrapperSizeT offset) {
+  bool single_file_per_rank = out_params.single_file_per_rank;
+  int level = out_params.compression_level;
+  int nmb = pm->nmb_thisrank;
+  std::size_t nreal = outarray_chunks.extent(1);
+  IOWrapperSizeT raw_size = nreal*sizeof(Real);
+
+  // compress chunks of this rank
+  std::vector<std::vector<char>> zbuf((level > 0)? nmb : 0);
+  for (int m=0; m<static_cast<int>(zbuf.size()); ++m) {
+    packed_restart::Compress(&outarray_chunks(m,0), nreal, level, zbuf[m]);
+  }
+
+  // compute index (offset of each chunk from start of chunk data), which requires the
+  // size of the chunks on all ranks unless each rank writes its own file
+  int nchunks = single_file_per_rank ? nmb : pm->nmb_total;
+  int gids = single_file_per_rank ? 0 : pm->gids_eachrank[global_variable::my_rank];
+  std::vector<IOWrapperSizeT> index(nchunks+1, 0);
+  for (int m=0; m<nmb; ++m) {
+    index[gids + m + 1] = (level > 0)? zbuf[m].size() : raw_size;
+  }
+#if MPI_PARALLEL_ENABLED
+  if (!single_file_per_rank && level > 0) {
+    MPI_Allgatherv(MPI_IN_PLACE, nmb, MPI_UINT64_T, &(index[1]), pm->nmb_eachrank,
+                   pm->gids_eachrank, MPI_UINT64_T, MPI_COMM_WORLD);
+  }
+#endif
+  if (!single_file_per_rank && level == 0) {
+    for (int n=0; n<nchunks; ++n) {index[n+1] = raw_size;}
+  }
+  for (int n=0; n<nchunks; ++n) {index[n+1] += index[n];}
+
+  // root process writes chunk header and index
+  if (global_variable::my_rank == 0 || single_file_per_rank) {
+    IOWrapperSizeT hdr[packed_restart::kNHeader] = {packed_restart::kTag, raw_size,
+        static_cast<IOWrapperSizeT>(level), static_cast<IOWrapperSizeT>(nchunks)};
+    resfile.Write_any_type(&(hdr[0]), sizeof(hdr), "byte", single_file_per_rank);
+    resfile.Write_any_type(index.data(), (nchunks+1)*sizeof(IOWrapperSizeT), "byte",
+                           single_file_per_rank);
+  }
+  IOWrapperSizeT dataoffset = offset + packed_restart::kNHeader*sizeof(IOWrapperSizeT)
+                              + (nchunks+1)*sizeof(IOWrapperSizeT);
+
+  // write one chunk per MeshBlock, collectively while every rank has one to write
+  int nmb_max = single_file_per_rank ? nmb : noutmbs_max;
+  int nmb_min = single_file_per_rank ? nmb : noutmbs_min;
+  for (int m=0; m<nmb_max; ++m) {
+    if (m >= nmb) continue;   // this rank has no more MeshBlocks to write
+    const void *pdata = (level > 0)? static_cast<const void *>(zbuf[m].data()) :
+                                     static_cast<const void *>(&outarray_chunks(m,0));
+    IOWrapperSizeT nbytes = index[gids+m+1] - index[gids+m];
+    IOWrapperSizeT myoffset = dataoffset + index[gids+m];
+    std::size_t nwrite;
+    if (m < nmb_min) {
+      nwrite = resfile.Write_any_type_at_all(pdata, nbytes, myoffset, "byte",
+                                             single_file_per_rank);
+    } else {
+      nwrite = resfile.Write_any_type_at(pdata, nbytes, myoffset, "byte",
+                                         single_file_per_rank);
+    }
+    if (nwrite != nbytes) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "packed data of MeshBlock " << gids+m << " not written "
+                << "correctly to rst file, restart file is broken." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
   return;
 }
@@ -0,0 +1,295 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file restart_redistribute.cpp
+//! \brief reads per-rank restart files written by any number of ranks, and redistributes
+//! the MeshBlock data to the ranks that own them in the current run.
+
+#include <sys/stat.h>  // stat
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "mesh/mesh.hpp"
+#include "hydro/hydro.hpp"
+#include "mhd/mhd.hpp"
+#include "coordinates/adm.hpp"
+#include "z4c/z4c.hpp"
+#include "radiation/radiation.hpp"
+#include "srcterms/turb_driver.hpp"
+#include "outputs/io_wrapper.hpp"
+#include "outputs/packed_restart.hpp"
+#include "restart_redistribute.hpp"
+
+namespace restart_redistribute {
+
+namespace {
+//----------------------------------------------------------------------------------------
+//! \fn void CopyFromRecords()
+//! \brief copies data of one variable (including ghost zones) from the record of each
+//! MeshBlock, starting at byte recoff, into a device array.  Advances recoff.
+
+template <typename ViewType>
+void CopyFromRecords(const ViewType &a, const std::vector<std::vector<char>> &rec,
+                     std::size_t &recoff) {
+  auto h = Kokkos::create_mirror_view(a);
+  std::size_t cnt = a.size()/a.extent(0);   // Reals per MeshBlock
+  for (std::size_t m=0; m<rec.size(); ++m) {
+    std::memcpy(h.data() + m*cnt, rec[m].data() + recoff, cnt*sizeof(Real));
+  }
+  Kokkos::deep_copy(a, h);
+  recoff += cnt*sizeof(Real);
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn std::string RankFileName()
+//! \brief returns name of the restart file written by 'rank', given the name of the file
+//! written by any rank, i.e. "dir/rank_XXXXXXXX/name.NNNNN.rst"
+
+std::string RankFileName(const std::string &fname, int rank) {
+  std::size_t rank_pos = fname.find("/rank_");
+  std::size_t last_slash = fname.rfind('/');
+  std::string base_dir = fname.substr(0, rank_pos);
+  std::string file_name = fname.substr(last_slash + 1);
+  char rank_dir[20];
+  std::snprintf(rank_dir, sizeof(rank_dir), "rank_%08d", rank);
+  return base_dir + "/" + rank_dir + "/" + file_name;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn int CountRankFiles()
+//! \brief returns number of ranks that wrote a per-rank restart file with the same name,
+//! i.e. the number of consecutive rank_XXXXXXXX directories containing the file.
+
+int CountRankFiles(const std::string &fname) {
+  int nfiles = 0;
+  if (global_variable::my_rank == 0) {
+    struct stat sb;
+    while (stat(RankFileName(fname, nfiles).c_str(), &sb) == 0) {nfiles++;}
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Bcast(&nfiles, 1, MPI_INT, 0, MPI_COMM_WORLD);
+#endif
+  if (nfiles == 0) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "No per-rank restart files found matching '" << fname
+              << "'" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  return nfiles;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ReadData()
+//! \brief reads the MeshBlock data from 'nfiles' per-rank restart files, and stores it in
+//! the dependent variables of the MeshBlocks on this rank.  'offset' is the position in
+//! each file just after the variable data size (or packed_restart::kTag) read from the
+//! header by the ProblemGenerator, which is identical in all files.
+//!
+//! File f is read by rank (f % nranks), in a single contiguous read of its data section.
+//! Reading ranks send the record (bytes) of each MeshBlock directly to its new owner, so
+//! no data is funnelled through a single rank.  Ghost zones are stored in the original
+//! restart format, and filled later by Driver::InitBoundaryValuesAndPrimitives() with
+//! the packed format.
+
+void ReadData(Mesh *pm, const std::string &fname, int nfiles, IOWrapperSizeT offset,
+              IOWrapperSizeT data_size) {
+  MeshBlockPack *pmbp = pm->pmb_pack;
+  int my_rank = global_variable::my_rank;
+  int nranks = global_variable::nranks;
+  bool packed = (data_size == packed_restart::kTag);
+  std::size_t nreal = packed_restart::ChunkSize(pmbp);
+
+  //--- STEP 1.  Readers find the number, size, and location of MeshBlock records in each
+  // of their files.  Counts and sizes are then shared with all ranks.
+  std::vector<int> nmb_eachfile(nfiles, 0);
+  std::vector<IOWrapperSizeT> dataoffset(nfiles, 0);
+  std::vector<std::vector<IOWrapperSizeT>> index(nfiles);
+  int level = 0;
+  for (int f=my_rank; f<nfiles; f+=nranks) {
+    std::string rank_fname = RankFileName(fname, f);
+    if (packed) {
+      IOWrapper rankfile;
+      rankfile.Open(rank_fname.c_str(), IOWrapper::FileMode::read, true);
+      IOWrapperSizeT hdr[packed_restart::kNHeader-1];
+      if (rankfile.Read_bytes_at(&hdr[0], sizeof(IOWrapperSizeT),
+                                 packed_restart::kNHeader-1, offset, true)
+          != packed_restart::kNHeader-1 || hdr[0] != nreal*sizeof(Real)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "Chunk header in '" << rank_fname << "' is broken, or "
+                  << "does not match the physics of this run." << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      level = static_cast<int>(hdr[1]);
+      nmb_eachfile[f] = static_cast<int>(hdr[2]);
+      index[f].resize(nmb_eachfile[f]+1);
+      IOWrapperSizeT indexoffset = offset + (packed_restart::kNHeader-1)*
+                                   sizeof(IOWrapperSizeT);
+      if (rankfile.Read_bytes_at(index[f].data(), sizeof(IOWrapperSizeT),
+                                 nmb_eachfile[f]+1, indexoffset, true)
+          != static_cast<std::size_t>(nmb_eachfile[f]+1)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "Chunk index not read correctly from '" << rank_fname
+                  << "', restart file is broken." << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      rankfile.Close(true);
+      dataoffset[f] = indexoffset + (nmb_eachfile[f]+1)*sizeof(IOWrapperSizeT);
+    } else {
+      // records are of fixed size, so number of MeshBlocks follows from the file size
+      struct stat sb;
+      if (stat(rank_fname.c_str(), &sb) != 0 ||
+          static_cast<IOWrapperSizeT>(sb.st_size) < offset ||
+          (static_cast<IOWrapperSizeT>(sb.st_size) - offset) % data_size != 0) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "Size of '" << rank_fname << "' is not consistent "
+                  << "with its header, restart file is broken." << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      nmb_eachfile[f] = (static_cast<IOWrapperSizeT>(sb.st_size) - offset)/data_size;
+      index[f].resize(nmb_eachfile[f]+1);
+      for (int n=0; n<=nmb_eachfile[f]; ++n) {index[f][n] = n*data_size;}
+      dataoffset[f] = offset;
+    }
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Allreduce(MPI_IN_PLACE, nmb_eachfile.data(), nfiles, MPI_INT, MPI_SUM,
+                MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, &level, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+  // files are written in rank order, so gids in each file follow from the counts
+  std::vector<int> gids_eachfile(nfiles+1, 0);
+  for (int f=0; f<nfiles; ++f) {gids_eachfile[f+1] = gids_eachfile[f] + nmb_eachfile[f];}
+  if (gids_eachfile[nfiles] != pm->nmb_total) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Per-rank restart files contain " << gids_eachfile[nfiles]
+              << " MeshBlocks, but Mesh has " << pm->nmb_total << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  std::vector<IOWrapperSizeT> size_eachmb(pm->nmb_total, 0);
+  for (int f=my_rank; f<nfiles; f+=nranks) {
+    for (int n=0; n<nmb_eachfile[f]; ++n) {
+      size_eachmb[gids_eachfile[f] + n] = index[f][n+1] - index[f][n];
+    }
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Allreduce(MPI_IN_PLACE, size_eachmb.data(), pm->nmb_total, MPI_UINT64_T, MPI_SUM,
+                MPI_COMM_WORLD);
+#endif
+
+  //--- STEP 2.  Post receives for records of MeshBlocks on this rank
+  int nmb = pm->nmb_thisrank;
+  int mbgids = pm->gids_eachrank[my_rank];
+  std::vector<std::vector<char>> rec(nmb);
+#if MPI_PARALLEL_ENABLED
+  std::vector<MPI_Request> recv_req;
+#endif
+  for (int m=0; m<nmb; ++m) {
+    rec[m].resize(size_eachmb[mbgids + m]);
+    int f = static_cast<int>(std::upper_bound(gids_eachfile.begin(), gids_eachfile.end(),
+                             mbgids + m) - gids_eachfile.begin()) - 1;
+#if MPI_PARALLEL_ENABLED
+    if ((f % nranks) != my_rank) {
+      recv_req.emplace_back();
+      MPI_Irecv(rec[m].data(), static_cast<int>(rec[m].size()), MPI_BYTE, f % nranks, m,
+                MPI_COMM_WORLD, &(recv_req.back()));
+    }
+#endif
+  }
+
+  //--- STEP 3.  Readers read the data section of each of their files, and send each
+  // record to its owner.  Files are processed one at a time to bound memory use.
+  for (int f=my_rank; f<nfiles; f+=nranks) {
+    std::string rank_fname = RankFileName(fname, f);
+    std::vector<char> buf(index[f][nmb_eachfile[f]]);
+    IOWrapper rankfile;
+    rankfile.Open(rank_fname.c_str(), IOWrapper::FileMode::read, true);
+    if (rankfile.Read_bytes_at(buf.data(), 1, buf.size(), dataoffset[f], true)
+        != buf.size()) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "MeshBlock data not read correctly from '" << rank_fname
+                << "', restart file is broken." << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    rankfile.Close(true);
+#if MPI_PARALLEL_ENABLED
+    std::vector<MPI_Request> send_req;
+#endif
+    for (int n=0; n<nmb_eachfile[f]; ++n) {
+      int gid = gids_eachfile[f] + n;
+      int dest = pm->rank_eachmb[gid];
+      if (dest == my_rank) {
+        std::memcpy(rec[gid - mbgids].data(), &(buf[index[f][n]]), size_eachmb[gid]);
+      } else {
+#if MPI_PARALLEL_ENABLED
+        send_req.emplace_back();
+        MPI_Isend(&(buf[index[f][n]]), static_cast<int>(size_eachmb[gid]), MPI_BYTE, dest,
+                  gid - pm->gids_eachrank[dest], MPI_COMM_WORLD, &(send_req.back()));
+#endif
+      }
+    }
+#if MPI_PARALLEL_ENABLED
+    MPI_Waitall(static_cast<int>(send_req.size()), send_req.data(), MPI_STATUSES_IGNORE);
+#endif
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Waitall(static_cast<int>(recv_req.size()), recv_req.data(), MPI_STATUSES_IGNORE);
+#endif
+
+  //--- STEP 4.  Unpack records into dependent variables
+  if (packed) {
+    HostArray2D<Real> hbuf("rst-chunks-in", nmb, nreal);
+    for (int m=0; m<nmb; ++m) {
+      if (level > 0) {
+        packed_restart::Decompress(rec[m].data(), rec[m].size(), &hbuf(m,0), nreal);
+      } else if (rec[m].size() == nreal*sizeof(Real)) {
+        std::memcpy(&hbuf(m,0), rec[m].data(), rec[m].size());
+      } else {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "Uncompressed chunk has wrong size, restart file is "
+                  << "broken." << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+    packed_restart::Unpack(pmbp, hbuf);
+    return;
+  }
+
+  // original format: each record holds arrays including ghost zones, in the order they
+  // are written in RestartOutput::WriteOutputFile()
+  std::size_t recoff = 0;
+  if (pmbp->phydro != nullptr) {CopyFromRecords(pmbp->phydro->u0, rec, recoff);}
+  if (pmbp->pmhd != nullptr) {
+    CopyFromRecords(pmbp->pmhd->u0, rec, recoff);
+    CopyFromRecords(pmbp->pmhd->b0.x1f, rec, recoff);
+    CopyFromRecords(pmbp->pmhd->b0.x2f, rec, recoff);
+    CopyFromRecords(pmbp->pmhd->b0.x3f, rec, recoff);
+  }
+  if (pmbp->prad != nullptr) {CopyFromRecords(pmbp->prad->i0, rec, recoff);}
+  if (pmbp->pturb != nullptr) {CopyFromRecords(pmbp->pturb->force, rec, recoff);}
+  if (pmbp->pz4c != nullptr) {
+    CopyFromRecords(pmbp->pz4c->u0, rec, recoff);
+  } else if (pmbp->padm != nullptr) {
+    CopyFromRecords(pmbp->padm->u_adm, rec, recoff);
+  }
+  if (recoff != data_size) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "CC data size read from restart file not equal to size "
+              << "of Hydro, MHD, Rad, and/or Z4c arrays, restart file is broken."
+              << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  return;
+}
+
+} // namespace restart_redistribute
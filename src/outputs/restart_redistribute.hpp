@@ -0,0 +1,32 @@
+#ifndef OUTPUTS_RESTART_REDISTRIBUTE_HPP_
+#define OUTPUTS_RESTART_REDISTRIBUTE_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file restart_redistribute.hpp
+//  \brief functions to restart from restart files written with single_file_per_rank=true
+//  by a different number of MPI ranks than the restarted run ("N-to-M" restarts).
+//
+// Every per-rank file contains the full header (input parameters, MeshBlock list, ...),
+// followed by the data of the MeshBlocks on the rank that wrote it, in gid order.  Any
+// file can therefore be used to rebuild the Mesh.  The MeshBlock data are then read in
+// parallel, with each file read by exactly one rank, and sent point-to-point to the rank
+// that owns each MeshBlock in the new LoadBalance() layout.
+
+#include <string>
+
+#include "outputs/io_wrapper.hpp"
+
+class Mesh;
+
+namespace restart_redistribute {
+
+std::string RankFileName(const std::string &fname, int rank);
+int CountRankFiles(const std::string &fname);
+void ReadData(Mesh *pm, const std::string &fname, int nfiles, IOWrapperSizeT offset,
+              IOWrapperSizeT data_size);
+
+} // namespace restart_redistribute
+#endif // OUTPUTS_RESTART_REDISTRIBUTE_HPP_
@@ -11,9 +11,9 @@
 #include <sys/stat.h>  // mkdir
 
 #include <cstdio>  // snprintf
-#include <fstream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -57,34 +57,31 @@ void SphericalSurfaceOutput::LoadOutputData(Mesh *pm) {
     auto v_slice = Kokkos::subview(outarray, n, 0, 0, 0, Kokkos::ALL);
     Kokkos::deep_copy(v_slice, psurf->interp_vals.h_view);
   }
-#if MPI_PARALLEL_ENABLED
-  // Note that InterpolateToSphere will set zero values for points not owned by
-  // current rank
-  int count = nout_vars * psurf->nangles;
-  if (0 == global_variable::my_rank) {
-    MPI_Reduce(MPI_IN_PLACE, outarray.data(), count, MPI_ATHENA_REAL, MPI_SUM,
-               0, MPI_COMM_WORLD);
-  } else {
-    MPI_Reduce(outarray.data(), outarray.data(), count, MPI_ATHENA_REAL,
-               MPI_SUM, 0, MPI_COMM_WORLD);
+
+  // send values at points interpolated on this rank to root as (index, values) pairs.
+  // The gather is completed by root in WriteOutputFile(); other ranks do not wait.
+  std::vector<int> owned;
+  for (int i = 0; i < psurf->nangles; ++i) {
+    if (psurf->interp_indcs.h_view(i, 0) != -1) {owned.push_back(i);}
   }
-#endif
+  gather.Start(outarray.data(), nout_vars, psurf->nangles, owned);
 }
 
 void SphericalSurfaceOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   bool big_end = IsBigEndian();
 
-#if MPI_PARALLEL_ENABLED
   if (0 == global_variable::my_rank) {
-#endif
+    // assemble data received from all ranks
+    gather.Finish(outarray.data());
+
     // Assemble filename
     char fname[BUFSIZ];
     std::snprintf(fname, BUFSIZ, "sph/%s.r=%.2f.%s.%05d.vtk",
                   out_params.file_basename.c_str(), psurf->radius,
                   out_params.file_id.c_str(), out_params.file_number);
 
-    // Open file
-    std::ofstream ofile(fname, std::ios::binary);
+    // Assemble file in memory
+    std::ostringstream ofile;
 
     ofile << "# vtk DataFile Version 3.0" << std::endl;
     ofile << "# AthenaK data at time=" << pm->time
@@ -149,9 +146,14 @@ void SphericalSurfaceOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
       }
     }
 
-#if MPI_PARALLEL_ENABLED
+    // Write file, on I/O thread if async=true
+    std::string buf = ofile.str();
+    IOWrapper sphfile;
+    sphfile.SetAsync(pasync_writer);
+    sphfile.Open(fname, IOWrapper::FileMode::write, true);
+    sphfile.Write_any_type(buf.data(), buf.size(), "byte", true);
+    sphfile.Close(true);
   }
-#endif
 
   // increment counters
   out_params.file_number++;
@@ -163,3 +165,8 @@ void SphericalSurfaceOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   pin->SetInteger(out_params.block_name, "file_number", out_params.file_number);
   pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
 }
+
+// Complete gather of data from last output on ranks other than root
+void SphericalSurfaceOutput::Finish(Mesh *pm) {
+  gather.Finish(outarray.data());
+}
@@ -15,6 +15,7 @@
 #include <sys/stat.h>  // mkdir
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>      // fwrite(), fclose(), fopen(), fnprintf(), snprintf()
 #include <cstdlib>
 #include <iomanip>
@@ -40,6 +41,19 @@ MeshVTKOutput::MeshVTKOutput(ParameterInput *pin, Mesh *pm, OutputParameters op)
   mkdir("vtk",0775);
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void MeshVTKOutput::LoadOutputData(Mesh *pm)
+//! \brief Converts output data of all MeshBlocks to big endian floats on the device, and
+//! copies them to host with a single transfer.
+
+void MeshVTKOutput::LoadOutputData(Mesh *pm) {
+  SetOutputMeshBlocks(pm);
+  if (out_params.contains_derived) {
+    ComputeDerivedVariable(out_params.variable, pm);
+  }
+  PackOutputData(pm, 0, !(IsBigEndian()));
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void MeshVTKOutput:::WriteOutputFile(Mesh *pm)
 //! \brief Cycles over all MeshBlocks and writes output data in (legacy) vtk format.
@@ -53,7 +67,6 @@ MeshVTKOutput::MeshVTKOutput(ParameterInput *pin, Mesh *pm, OutputParameters op)
 //!  5. Data.  An arbitrary number of scalars and vectors can be written
 
 void MeshVTKOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
-  int big_end = IsBigEndian(); // =1 on big endian machine
   const int time_precision = std::numeric_limits<Real>::max_digits10 - 1;
   // create filename: "vtk/file_basename"."file_id"."gid"."XXXXX".vtk
   // where XXXXX = 5-digit file_number, and gid only added if specified
@@ -158,11 +171,11 @@ void MeshVTKOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     }
     size_t header_size = msg.str().size();
 
-    // allocate 1D vector of floats used to convert and output entire 3D data
+    // data of each MeshBlock has already been converted to big endian floats
     int nx1 = outmbs[0].oie - outmbs[0].ois + 1;
     int nx2 = outmbs[0].oje - outmbs[0].ojs + 1;
     int nx3 = outmbs[0].oke - outmbs[0].oks + 1;
-    float *data = new float[nx1*nx2*nx3];
+    uint32_t *data = nullptr;
 
     // create new datatype representing array of cells in MeshBlocks
     MPI_Datatype block;
@@ -205,20 +218,7 @@ void MeshVTKOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
           int jmb = (out_params.slice2 || (out_params.gid >= 0))? 0 : lloc.lx2;
           int kmb = (out_params.slice3 || (out_params.gid >= 0))? 0 : lloc.lx3;
 
-          // convert data to float and byte swap into big endian order
-          for (int k=0; k<nx3; ++k) {
-            for (int j=0; j<nx2; ++j) {
-              for (int i=0; i<nx1; ++i) {
-                int indx = i + j*indcs.nx1 + k*indcs.nx1*indcs.nx2;
-                data[indx] = static_cast<float>(outarray(n,m,k,j,i));
-              }
-            }
-          }
-          if (!big_end) {
-            for (int i=0; i<(nx1*nx2*nx3); ++i) {
-              Swap4Bytes(&data[i]);
-            }
-          }
+          data = &(h_outwords(m, n*nx1*nx2*nx3));
           // create new datatype representing this block in grid of MBs, and set file view
           int strt[3] = {kmb*nx3, jmb*nx2, imb*nx1};   // starting indices of this block
           MPI_Type_create_subarray(3,gridsize,mbsize,strt,MPI_ORDER_C,MPI_FLOAT,&mygrid);
@@ -232,10 +232,10 @@ void MeshVTKOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
 
         // every rank has a MB to write, so write collectively
         if (m < noutmbs_min) {
-          MPI_File_write_all(fh, &(data[0]), 1, block, MPI_STATUS_IGNORE);
+          MPI_File_write_all(fh, data, 1, block, MPI_STATUS_IGNORE);
         // some ranks are finished writing, so use non-collective write
         } else if (m < nout_mbs) {
-          MPI_File_write(fh, &(data[0]), 1, block, MPI_STATUS_IGNORE);
+          MPI_File_write(fh, data, 1, block, MPI_STATUS_IGNORE);
         }
       }  // end loop over MeshBlocks
       MPI_Type_free(&mygrid);
@@ -249,7 +249,6 @@ void MeshVTKOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     MPI_Type_free(&block);
     MPI_Type_free(&grid);
     MPI_File_close(&fh);
-    delete[] data;
     parallel_write=true;
   }
 
@@ -266,8 +265,8 @@ void MeshVTKOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     }
     std::fprintf(pfile,"%s",msg.str().c_str());
 
-    // allocate 1D vector of floats used to convert and output entire 3D data
-    float *data = new float[nout1*nout2*nout3];
+    // allocate 1D vector of (big endian) floats used to output entire 3D data
+    uint32_t *data = new uint32_t[nout1*nout2*nout3];
     // Loop over variables
     int nout_vars = outvars.size();
     for (int n=0; n<nout_vars; ++n) {
@@ -292,24 +291,23 @@ void MeshVTKOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
         int &oje = outmbs[m].oje;
         int &oks = outmbs[m].oks;
         int &oke = outmbs[m].oke;
+        int ncells = (oke-oks+1)*(oje-ojs+1)*(oie-ois+1);
+        const uint32_t *pwords = &(h_outwords(m, n*ncells));
+        int cell = 0;
         for (int k=oks; k<=oke; ++k) {
           for (int j=ojs; j<=oje; ++j) {
             for (int i=ois; i<=oie; ++i) {
               int indx = imb*indcs.nx1 + (i-ois) +
                         (jmb*indcs.nx2 + (j-ojs))*nout1 +
                         (kmb*indcs.nx3 + (k-oks))*nout1*nout2;
-              data[indx] = static_cast<float>(outarray(n,m,k-oks,j-ojs,i-ois));
+              data[indx] = pwords[cell++];
             }
           }
         }
       }  // end loop over MeshBlocks
 
-      // swap data for this variable into big endian order
-      if (!big_end) {
-        for (int i=0; i<(nout1*nout2*nout3); ++i) { Swap4Bytes(&data[i]); }
-      }
       // now write the data as unformatted binary
-      std::fwrite(&(data[0]), sizeof(float), nout1*nout2*nout3, pfile);
+      std::fwrite(&(data[0]), sizeof(uint32_t), nout1*nout2*nout3, pfile);
     }
     // close the output file and clean up
     std::fclose(pfile);
@@ -27,6 +27,8 @@
 #include "z4c/z4c.hpp"
 #include "radiation/radiation.hpp"
 #include "srcterms/turb_driver.hpp"
+#include "outputs/packed_restart.hpp"
+#include "outputs/restart_redistribute.hpp"
 #include "pgen.hpp"
 
 
@@ -89,7 +91,8 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm) :
 // and any data necessary for restart runs to continue correctly.
 
 ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resfile,
-                                   bool single_file_per_rank) :
+                                   bool single_file_per_rank,
+                                   const std::string &rst_fname, int nrst_files) :
     user_bcs(false),
     user_srcs(false),
     user_hist(false),
@@ -212,6 +215,25 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
   IOWrapperSizeT data_size;
   std::memcpy(&data_size, &(variabledata[0]), sizeof(IOWrapperSizeT));
 
+  // packed (ghost-zone-free) restart files store packed_restart::kTag in place of the
+  // data size, followed by a chunk index and one chunk per MeshBlock
+  bool packed = (data_size == packed_restart::kTag);
+  // per-rank files written by a different number of ranks are read in parallel, and
+  // MeshBlocks are sent to the rank that owns them in this run
+  bool redistribute = (single_file_per_rank && nrst_files > 0 &&
+                       nrst_files != global_variable::nranks);
+  if (redistribute) {
+    restart_redistribute::ReadData(pm, rst_fname, nrst_files, resfile.GetPosition(true),
+                                   data_size);
+  } else if (packed) {
+    packed_restart::ReadData(pm, resfile, single_file_per_rank);
+  }
+  bool data_read = (packed || redistribute);
+  if (data_read && pz4c != nullptr) {
+    // ADM ghost zones are recomputed in Driver::Initialize() once Z4c ghosts are set
+    pz4c->Z4cToADM(pmy_mesh_->pmb_pack);
+  }
+
   // calculate total number of CC variables
   IOWrapperSizeT headeroffset=0;
   // master process gets file offset
@@ -247,7 +269,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     data_size_ += nout1*nout2*nout3*nadm*sizeof(Real);   // adm u_adm
   }
 
-  if (data_size_ != data_size) {
+  if (!data_read && data_size_ != data_size) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
               << std::endl << "CC data size read from restart file not equal to size "
               << "of Hydro, MHD, Rad, and/or Z4c arrays, restart file is broken."
@@ -273,7 +295,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     noutmbs_min = std::min(noutmbs_min,pm->nmb_eachrank[i]);
   }
 
-  if (phydro != nullptr) {
+  if (phydro != nullptr && !data_read) {
     Kokkos::realloc(ccin, nmb, nhydro, nout3, nout2, nout1);
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to read, so read collectively
@@ -313,7 +335,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     myoffset = offset_myrank;
   }
 
-  if (pmhd != nullptr) {
+  if (pmhd != nullptr && !data_read) {
     Kokkos::realloc(ccin, nmb, nmhd, nout3, nout2, nout1);
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to read, so read collectively
@@ -453,7 +475,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     myoffset = offset_myrank;
   }
 
-  if (prad != nullptr) {
+  if (prad != nullptr && !data_read) {
     Kokkos::realloc(ccin, nmb, nrad, nout3, nout2, nout1);
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to read, so read collectively
@@ -493,7 +515,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     myoffset = offset_myrank;
   }
 
-  if (pturb != nullptr) {
+  if (pturb != nullptr && !data_read) {
     Kokkos::realloc(ccin, nmb, nforce, nout3, nout2, nout1);
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to read, so read collectively
@@ -533,7 +555,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     myoffset = offset_myrank;
   }
 
-  if (pz4c != nullptr) {
+  if (pz4c != nullptr && !data_read) {
     Kokkos::realloc(ccin, nmb, nz4c, nout3, nout2, nout1);
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to read, so read collectively
@@ -574,7 +596,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
 
     // We also need to reinitialize the ADM data.
     pz4c->Z4cToADM(pmy_mesh_->pmb_pack);
-  } else if (padm != nullptr) {
+  } else if (padm != nullptr && !data_read) {
     Kokkos::realloc(ccin, nmb, nadm, nout3, nout2, nout1);
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to read, so read collectively
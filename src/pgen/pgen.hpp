@@ -10,6 +10,7 @@
 
 #include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "geodesic-grid/spherical_grid.hpp"
@@ -29,8 +30,11 @@ class ProblemGenerator {
   // constructor for new problems
   ProblemGenerator(ParameterInput *pin, Mesh *pmesh);
   // constructor for restarts
+  // with single_file_per_rank, 'nrst_files' is the number of per-rank files and
+  // 'rst_fname' the name of any of them, needed when nrst_files differs from nranks
   ProblemGenerator(ParameterInput *pin, Mesh *pmesh, IOWrapper resfile,
-                   bool single_file_per_rank=false);
+                   bool single_file_per_rank=false, const std::string &rst_fname="",
+                   int nrst_files=0);
   ~ProblemGenerator() = default;
 
   // true if user BCs are specified on any face
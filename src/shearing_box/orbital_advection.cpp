@@ -30,7 +30,10 @@
 OrbitalAdvection::OrbitalAdvection(MeshBlockPack *ppack, ParameterInput *pin) :
     maxjshift(1),
     shearing_box_r_phi(false),     // 2D r-phi not yet implemented
-    pmy_pack(ppack) {
+    send_version(-1),
+    recv_version(-1),
+    pmy_pack(ppack),
+    nmb_req(0) {
   // Read shear rate and orbital frequency
   qshear = pin->GetReal("shearing_box","qshear");
   omega0 = pin->GetReal("shearing_box","omega0");
@@ -40,14 +43,17 @@ OrbitalAdvection::OrbitalAdvection(MeshBlockPack *ppack, ParameterInput *pin) :
   Real xmax = fabs(ppack->pmesh->mesh_size.x1max);
   maxjshift = static_cast<int>((ppack->pmesh->cfl_no)*std::max(xmin,xmax)) + 1;
 
+  // use persistent MPI requests rebuilt only when the mesh changes (if requested)
+  persistent_msgs = pin->GetOrAddBoolean("mesh", "persistent_msgs", false);
+
 #if MPI_PARALLEL_ENABLED
   // For orbital advection, communication is only with x2-face neighbors
   // initialize vectors of MPI request in 2 elements of fixed length arrays
+  nmb_req = std::max((ppack->nmb_thispack), (ppack->pmesh->nmb_maxperrank));
   for (int n=0; n<2; ++n) {
-    int nmb = std::max((ppack->nmb_thispack), (ppack->pmesh->nmb_maxperrank));
-    sendbuf[n].vars_req = new MPI_Request[nmb];
-    recvbuf[n].vars_req = new MPI_Request[nmb];
-    for (int m=0; m<nmb; ++m) {
+    sendbuf[n].vars_req = new MPI_Request[nmb_req];
+    recvbuf[n].vars_req = new MPI_Request[nmb_req];
+    for (int m=0; m<nmb_req; ++m) {
       sendbuf[n].vars_req[m] = MPI_REQUEST_NULL;
       recvbuf[n].vars_req[m] = MPI_REQUEST_NULL;
     }
@@ -62,9 +68,27 @@ OrbitalAdvection::OrbitalAdvection(MeshBlockPack *ppack, ParameterInput *pin) :
 
 OrbitalAdvection::~OrbitalAdvection() {
 #if MPI_PARALLEL_ENABLED
+  FreeRequests(sendbuf);
+  FreeRequests(recvbuf);
   for (int n=0; n<2; ++n) {
     delete [] sendbuf[n].vars_req;
     delete [] recvbuf[n].vars_req;
   }
 #endif
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn void OrbitalAdvection::FreeRequests()
+//! \brief Frees any persistent MPI requests stored in (send or recv) buffers
+
+void OrbitalAdvection::FreeRequests(ShearingBoxBoundaryBuffer *buf) {
+#if MPI_PARALLEL_ENABLED
+  for (int n=0; n<2; ++n) {
+    for (int m=0; m<nmb_req; ++m) {
+      if (buf[n].vars_req[m] != MPI_REQUEST_NULL) {
+        MPI_Request_free(&(buf[n].vars_req[m]));
+      }
+    }
+  }
+#endif
+}
@@ -36,6 +36,10 @@ class OrbitalAdvection {
   MPI_Comm comm_orb_advect;
 #endif
 
+  // with persistent messages, MPI requests are created once and restarted every stage
+  bool persistent_msgs;
+  int send_version, recv_version;  // Mesh::nghbr_version when requests were created
+
   // functions
   TaskStatus InitRecv();
   TaskStatus ClearRecv();
@@ -45,6 +49,8 @@ class OrbitalAdvection {
   // must use pointer to MBPack and not parent physics module since parent can be one of
   // many types (Hydro, MHD, Radiation, etc.)
   MeshBlockPack *pmy_pack;
+  int nmb_req;   // length of arrays of MPI requests in send/recv buffers
+  void FreeRequests(ShearingBoxBoundaryBuffer *buf);
 };
 
 //----------------------------------------------------------------------------------------
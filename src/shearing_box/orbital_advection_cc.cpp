@@ -131,6 +131,9 @@ TaskStatus OrbitalAdvectionCC::PackAndSendCC(DvceArray5D<Real> &a) {
   // Send boundary buffer to neighboring MeshBlocks using MPI
   Kokkos::fence();
   bool no_errors=true;
+  int version = pmy_pack->pmesh->nghbr_version;
+  bool build_reqs = persistent_msgs && (version != send_version);
+  if (build_reqs) {FreeRequests(sendbuf);}
   for (int m=0; m<nmb; ++m) {
     for (int n=0; n<2; ++n) {
       // indices of x2-face buffers in nghbr view
@@ -150,13 +153,25 @@ TaskStatus OrbitalAdvectionCC::PackAndSendCC(DvceArray5D<Real> &a) {
           auto send_ptr = Kokkos::subview(sbuf[n].vars, m, ALL, ALL, ALL, ALL);
           int data_size = send_ptr.size();
 
-          int ierr = MPI_Isend(send_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
-                               comm_orb_advect, &(sbuf[n].vars_req[m]));
+          int ierr;
+          if (persistent_msgs) {
+            // persistent requests only need to be created when the mesh changes
+            if (build_reqs) {
+              ierr = MPI_Send_init(send_ptr.data(), data_size, MPI_ATHENA_REAL, drank,
+                                   tag, comm_orb_advect, &(sbuf[n].vars_req[m]));
+              if (ierr != MPI_SUCCESS) {no_errors=false;}
+            }
+            ierr = MPI_Start(&(sbuf[n].vars_req[m]));
+          } else {
+            ierr = MPI_Isend(send_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
+                             comm_orb_advect, &(sbuf[n].vars_req[m]));
+          }
           if (ierr != MPI_SUCCESS) {no_errors=false;}
         }
       }
     }
   }
+  if (build_reqs) {send_version = version;}
   // Quit if MPI error detected
   if (!(no_errors)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
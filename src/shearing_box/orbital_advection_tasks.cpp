@@ -30,6 +30,9 @@ TaskStatus OrbitalAdvection::InitRecv() {
 
   // Initialize communications of variables
   bool no_errors=true;
+  int version = pmy_pack->pmesh->nghbr_version;
+  bool build_reqs = persistent_msgs && (version != recv_version);
+  if (build_reqs) {FreeRequests(recvbuf);}
   for (int m=0; m<nmb; ++m) {
     for (int n=0; n<2; ++n) {
       // indices of x2-face buffers in nghbr view
@@ -50,13 +53,25 @@ TaskStatus OrbitalAdvection::InitRecv() {
           int data_size = recv_ptr.size();
 
           // Post non-blocking receive for this buffer on this MeshBlock
-          int ierr = MPI_Irecv(recv_ptr.data(), data_size, MPI_ATHENA_REAL, srank, tag,
-                               comm_orb_advect, &(recvbuf[n].vars_req[m]));
+          int ierr;
+          if (persistent_msgs) {
+            // persistent requests only need to be created when the mesh changes
+            if (build_reqs) {
+              ierr = MPI_Recv_init(recv_ptr.data(), data_size, MPI_ATHENA_REAL, srank,
+                                   tag, comm_orb_advect, &(recvbuf[n].vars_req[m]));
+              if (ierr != MPI_SUCCESS) {no_errors=false;}
+            }
+            ierr = MPI_Start(&(recvbuf[n].vars_req[m]));
+          } else {
+            ierr = MPI_Irecv(recv_ptr.data(), data_size, MPI_ATHENA_REAL, srank, tag,
+                             comm_orb_advect, &(recvbuf[n].vars_req[m]));
+          }
           if (ierr != MPI_SUCCESS) {no_errors=false;}
         }
       }
     }
   }
+  if (build_reqs) {recv_version = version;}
   // Quit if MPI error detected
   if (!(no_errors)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
@@ -13,17 +13,21 @@
 // This version includes improvements due to Josh Dolence and the Parthenon dev team, and
 // extensions by J.M.Stone.
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
 #include <iostream>
-#include <bitset>
 #include <functional>
+#include <string>
 #include <vector>
 #include <list>
 #include <iterator>
 
-class Driver;
+#include "utils/profiler.hpp"
 
-// Maximum size of TL
-#define NUMBER_TASKID_BITS 64
+class Driver;
 
 // constants = return codes for functions working on individual Tasks and TaskList
 enum class TaskStatus {fail, complete, incomplete};
@@ -32,66 +36,109 @@ enum class TaskListStatus {running, stuck, complete, nothing_to_do};
 //----------------------------------------------------------------------------------------
 //! \class TaskID
 //  \brief container class for bit fields (used to encode Task IDs) and access functions
+//  The bit field is stored as a vector of 64-bit words that grows as needed, so there is
+//  no limit on the number of Tasks that can be stored in a TaskList.
 
 class TaskID {
  public:
   TaskID() = default;
   // ctor, default id = 0.
   explicit TaskID(unsigned int id) {
-    if (id == 0) {
-      bitfld_.reset();      // set all bits to zero
-    } else {
-      bitfld_.set((--id));  // set [id-1] bit to one
+    if (id != 0) {
+      --id;
+      bitfld_.assign(id/64 + 1, 0);
+      bitfld_[id/64] = (static_cast<std::uint64_t>(1) << (id%64));  // set [id-1] bit
     }
   }
 
   // functions (all implemented here)
-  void Clear() { bitfld_.reset(); }  // set all bits to zero
+  void Clear() { bitfld_.clear(); }  // set all bits to zero
   // return true if input dependencies are clear
   bool CheckDependencies(const TaskID &dep) const {
-    return ((bitfld_ & dep.bitfld_) == dep.bitfld_);
+    for (std::size_t n=0; n<dep.bitfld_.size(); ++n) {
+      if ((Word(n) & dep.bitfld_[n]) != dep.bitfld_[n]) return false;
+    }
+    return true;
   }
   // output ID (useful for debugging)
-  void PrintID() {std::cout << "TaskID = " << bitfld_.to_string() << std::endl;}
+  void PrintID() {
+    std::string str;
+    for (std::size_t n=std::max(bitfld_.size(), static_cast<std::size_t>(1)); n>0; --n) {
+      for (int b=63; b>=0; --b) {str += ((Word(n-1) >> b) & 1) ? '1' : '0';}
+    }
+    std::cout << "TaskID = " << str << std::endl;
+  }
   // mark task with input TaskID as complete
-  void SetComplete(const TaskID &rhs) { bitfld_ |= rhs.bitfld_; }
+  void SetComplete(const TaskID &rhs) { *this = (*this | rhs); }
+  // return (zero-based) indices of all bits that are set
+  std::vector<int> SetBits() const {
+    std::vector<int> bits;
+    for (std::size_t n=0; n<bitfld_.size(); ++n) {
+      for (int b=0; b<64; ++b) {
+        if ((bitfld_[n] >> b) & 1) {bits.push_back(static_cast<int>(64*n) + b);}
+      }
+    }
+    return bits;
+  }
 
   // overload some operators
-  bool operator== (const TaskID &rhs) const {return (bitfld_ == rhs.bitfld_); }
-  bool operator!= (const TaskID &rhs) const {return (bitfld_ != rhs.bitfld_); }
+  bool operator== (const TaskID &rhs) const {
+    std::size_t nw = std::max(bitfld_.size(), rhs.bitfld_.size());
+    for (std::size_t n=0; n<nw; ++n) {
+      if (Word(n) != rhs.Word(n)) return false;
+    }
+    return true;
+  }
+  bool operator!= (const TaskID &rhs) const {return !(*this == rhs); }
   TaskID operator| (const TaskID &rhs) const {
     TaskID ret;
-    ret.bitfld_ = (bitfld_ | rhs.bitfld_);
+    ret.bitfld_.resize(std::max(bitfld_.size(), rhs.bitfld_.size()));
+    for (std::size_t n=0; n<ret.bitfld_.size(); ++n) {
+      ret.bitfld_[n] = (Word(n) | rhs.Word(n));
+    }
     return ret;
   }
   TaskID operator^ (const TaskID &rhs) const {
     TaskID ret;
-    ret.bitfld_ = (bitfld_ ^ rhs.bitfld_);
+    ret.bitfld_.resize(std::max(bitfld_.size(), rhs.bitfld_.size()));
+    for (std::size_t n=0; n<ret.bitfld_.size(); ++n) {
+      ret.bitfld_[n] = (Word(n) ^ rhs.Word(n));
+    }
     return ret;
   }
   TaskID operator& (const TaskID &rhs) const {
     TaskID ret;
-    ret.bitfld_ = (bitfld_ & rhs.bitfld_);
+    ret.bitfld_.resize(std::min(bitfld_.size(), rhs.bitfld_.size()));
+    for (std::size_t n=0; n<ret.bitfld_.size(); ++n) {
+      ret.bitfld_[n] = (Word(n) & rhs.Word(n));
+    }
     return ret;
   }
 
  private:
-  std::bitset<NUMBER_TASKID_BITS> bitfld_;
+  std::vector<std::uint64_t> bitfld_;
+  // returns n-th 64-bit word of bit field, with words beyond end of vector equal to zero
+  std::uint64_t Word(std::size_t n) const {
+    return (n < bitfld_.size())? bitfld_[n] : static_cast<std::uint64_t>(0);
+  }
 };
 
 //----------------------------------------------------------------------------------------
 //! \class Task
 //  \brief data and function pointer for an individual Task
 //  NOTE: Task function must take arguments (Driver*, int)
+//  The (optional) name is used to label the Task in profiling regions and reports.
 
 class Task {
  public:
-  Task(TaskID id, TaskID dep, std::function<TaskStatus(Driver*, int)> func) :
-  myid_(id), dep_(dep), func_(func) {}
+  Task(TaskID id, TaskID dep, std::function<TaskStatus(Driver*, int)> func,
+       const std::string &name) :
+  myid_(id), dep_(dep), func_(func), name_(name) {}
   // overloaded operator() calls task function
   TaskStatus operator()(Driver *d, int s) {return func_(d,s);}
   TaskID GetID() {return myid_;}
   TaskID GetDependency() {return dep_;}
+  const std::string &GetName() {return name_;}
   void SetComplete() {complete_ = true;}
   void SetIncomplete() {complete_ = false;}
   bool IsComplete() {return complete_;}
@@ -106,54 +153,85 @@ class Task {
   // bool lb_time_;   // flag to include this task in timing for automatic load balancing
   bool complete_ = false;
   std::function<TaskStatus(Driver*, int)> func_;  // ptr to Task function
+  std::string name_;                              // label used by profiler
+  std::string label_;                             // "list_name/name" (if profiled)
+  profiler::Entry *pentry_ = nullptr;             // timer of this Task (if profiled)
+  friend class TaskList;
 };
 
 //----------------------------------------------------------------------------------------
 //! \class TaskList
 //  \brief data and function definitions for task list class
+//  Tasks are executed as a directed acyclic graph (DAG).  The graph is built (once) from
+//  the dependencies of each Task the first time the TaskList is Reset() after Tasks are
+//  added.  Each Task stores a counter of dependencies that are not yet complete.  When a
+//  Task completes, the counters of all Tasks that depend on it are decremented, and any
+//  that reach zero are added to a queue of ready Tasks.  Thus DoAvailable() only ever
+//  calls Tasks that can run, and completed Tasks are never checked again.
+//  If <profiling>/task_timing is enabled, each call of a Task is wrapped in a profiling
+//  region named "list_name/task_name", and its wall time is accumulated per stage.
 
 class TaskList {
  public:
   TaskList() = default;
+  explicit TaskList(const std::string &name) : name_(name) {}
   ~TaskList() = default;
 
   // functions (all implemented here)
-  bool IsComplete() {
-    // cycle through task list and check if each task completed
-    for (auto &it : task_list_) {
-      auto id = it.GetID();
-      if (!(tasks_completed_.CheckDependencies(id))) return false;
-    }
-    // everything is done
-    return true;
-  }
+  bool IsComplete() { return (ncomplete_ == static_cast<int>(task_list_.size())); }
   int Size() {return task_list_.size();}
   bool Empty() {return task_list_.empty();}
-  void MarkTaskComplete(TaskID id) { tasks_completed_.SetComplete(id); }
+  void MarkTaskComplete(TaskID id) {
+    if (!graph_built_) {BuildGraph();}
+    for (auto n : id.SetBits()) {
+      if (n < static_cast<int>(tasks_.size()) && !(tasks_[n]->IsComplete())) {
+        for (auto it = ready_.begin(); it != ready_.end(); ++it) {
+          if (*it == n) {ready_.erase(it); break;}
+        }
+        SetTaskComplete(n);
+      }
+    }
+  }
   TaskID GetIDLastTask() {return task_list_.back().GetID();}
   // output diagnostics (useful for debugging)
   void PrintIDs() { for (auto &it : task_list_) {it.GetID().PrintID();} }
   void PrintDependencies() { for (auto &it : task_list_) {it.GetDependency().PrintID();} }
 
-  //
+  // reset counters of incomplete dependencies, and fill queue with Tasks that have no
+  // dependencies (in the order they appear in the list)
   void Reset() {
-    tasks_completed_.Clear();  // TaskID Clear() fn
+    if (!graph_built_) {BuildGraph();}
+    ncomplete_ = 0;
+    ready_.clear();
     for (auto &it : task_list_) { it.SetIncomplete(); }
+    for (std::size_t n=0; n<tasks_.size(); ++n) {ndep_left_[n] = ndep_[n];}
+    for (auto n : initial_) {ready_.push_back(n);}
   }
 
-  // cycle through task list once, do any tasks whose dependencies are clear
+  // cycle through queue of ready tasks, do any that can be completed.  Tasks whose
+  // dependencies are cleared by a completed Task are appended to the queue, and are run
+  // in the same call.  Returns when every Task left in the queue has been tried once
+  // since the last Task completed.  Returns 'stuck' if no Task was completed.
   TaskListStatus DoAvailable(Driver *d, int s) {
-    for (auto &task : task_list_) {
-      auto dep = task.GetDependency();
-      if ( tasks_completed_.CheckDependencies(dep) && !(task.IsComplete()) ) {
-        TaskStatus status = task(d,s);  // calls Task function using overloaded operator()
-        if (status == TaskStatus::complete) {
-          task.SetComplete();              // set bool flag in task
-          MarkTaskComplete(task.GetID());  // add TaskID to tasks_completed_
-        }
+    if (!graph_built_) {Reset();}
+    // record stage for both Task and kernel timers (kernels are timed by stage)
+    if (profiler::task_timing || profiler::kernel_timing) {profiler::current_stage = s;}
+    int nstart = ncomplete_;
+    std::size_t ntried = 0;
+    while (!ready_.empty() && ntried < ready_.size()) {
+      int n = ready_.front();
+      ready_.pop_front();
+      TaskStatus status = (profiler::task_timing)? TimeTask(n, d, s) : (*tasks_[n])(d,s);
+      if (status == TaskStatus::complete) {
+        SetTaskComplete(n);
+        ntried = 0;
+      } else {
+        ready_.push_back(n);
+        ntried++;
       }
     }
     if (IsComplete()) return TaskListStatus::complete;
+    if (ncomplete_ == nstart) return TaskListStatus::stuck;
     return TaskListStatus::running;
   }
 
@@ -162,44 +240,50 @@ class TaskList {
   // arguments (Driver*, int). Usage:
   //     taskid = tl.AddTask(DoSomething, dependency, name);
   template <class F>
-  TaskID AddTask(F func, TaskID &dep) {
+  TaskID AddTask(F func, TaskID &dep, const std::string &name = "") {
     auto size = task_list_.size();
     TaskID id(size+1);
     task_list_.push_back(
-      Task(id, dep, [=](Driver *d, int s) mutable -> TaskStatus {return func(d,s);}));
+      Task(id, dep, [=](Driver *d, int s) mutable -> TaskStatus {return func(d,s);},
+           name));
+    graph_built_ = false;
     return id;
   }
 
   // ADD new Task with ID, given dependency, and a pointer to a member function of
   // class T to the end of task list.  Returns ID of new task. Task function must have
   // arguments (Driver*, int).  Usage:
-  //     taskid = tl.AddTask(&T::DoSomething, T, dependency);
+  //     taskid = tl.AddTask(&T::DoSomething, T, dependency, name);
   template <class F, class T>
-  TaskID AddTask(F func, T *obj, TaskID &dep) {
+  TaskID AddTask(F func, T *obj, TaskID &dep, const std::string &name = "") {
     auto size = task_list_.size();
     TaskID id(size+1);
     task_list_.push_back( Task(id, dep,
-       [=](Driver *d, int s) mutable -> TaskStatus {return (obj->*func)(d,s);}) );
+       [=](Driver *d, int s) mutable -> TaskStatus {return (obj->*func)(d,s);}, name) );
+    graph_built_ = false;
     return id;
   }
 
   // ADD new Task with ID, given dependency, and a std::function to the end of task
   // list. Returns ID of new task. Task function must have arguments (Driver*, int).
   // Usage:
-  //      taskid = tl.AddTask(DoSomething, dependency);
-  TaskID AddTask(std::function<TaskStatus(Driver*, int)> func, TaskID &dep) {
+  //      taskid = tl.AddTask(DoSomething, dependency, name);
+  TaskID AddTask(std::function<TaskStatus(Driver*, int)> func, TaskID &dep,
+                 const std::string &name = "") {
     auto size = task_list_.size();
     TaskID id(size+1);
-    task_list_.push_back(Task(id, dep, func));
+    task_list_.push_back(Task(id, dep, func, name));
+    graph_built_ = false;
     return id;
   }
 
   // INSERT new Task with ID, given dependency, and a pointer to a member function of
   // class T in a position BEFORE the task with ID 'location'.  Returns ID of new task,
   // or taskID(0) if location not found. Usage:
-  //     taskid = tl.InsertTask(&T::DoSomething, T, dependency, location);
+  //     taskid = tl.InsertTask(&T::DoSomething, T, dependency, location, name);
   template <class F, class T>
-  TaskID InsertTask(F func, T *obj, TaskID &dep, TaskID &loc) {
+  TaskID InsertTask(F func, T *obj, TaskID &dep, TaskID &loc,
+                    const std::string &name = "") {
     std::list<Task>::iterator it;
     for (it=task_list_.begin(); it!=task_list_.end(); ++it) {
       if (it->GetID() == loc) {
@@ -207,13 +291,15 @@ class TaskList {
         TaskID id(size+1);
         auto old_dep = it->GetDependency();
         task_list_.insert(it, Task(id, dep,
-           [=](Driver *d, int s) mutable -> TaskStatus {return (obj->*func)(d,s); }));
+           [=](Driver *d, int s) mutable -> TaskStatus {return (obj->*func)(d,s); },
+           name));
         // now change dependencies for all but this newly added Task
         for (auto it2=task_list_.begin(); it2!=task_list_.end(); ++it2) {
           if (it2->GetID() != id) {
             it2->ChangeDependency(old_dep, id);
           }
         }
+        graph_built_ = false;
         return id;
       }
     }
@@ -222,7 +308,90 @@ class TaskList {
 
  protected:
   std::list<Task> task_list_;
-  TaskID tasks_completed_;
+
+ private:
+  std::string name_;                     // name of TaskList, used by profiler
+  bool graph_built_ = false;
+  int ncomplete_ = 0;                    // number of Tasks completed since Reset()
+  std::vector<Task*> tasks_;             // Tasks indexed by (zero-based) bit of TaskID
+  std::vector<int> ndep_;                // number of dependencies of each Task
+  std::vector<int> ndep_left_;           // number of dependencies not yet complete
+  std::vector<std::vector<int>> nexts_;  // Tasks that depend on each Task
+  std::vector<int> initial_;             // Tasks with no dependencies, in list order
+  std::deque<int> ready_;                // Tasks with all dependencies complete
+
+  // call Task n inside a named profiling region and accumulate its wall time.  Device is
+  // fenced so that time of kernels launched by the Task is attributed to it.  Tasks
+  // added without a name are labelled by their (one-based) position in the list.
+  TaskStatus TimeTask(int n, Driver *d, int s) {
+    Task *ptask = tasks_[n];
+    if (ptask->pentry_ == nullptr) {
+      std::string tname = ptask->name_.empty()? ("task" + std::to_string(n+1))
+                                               : ptask->name_;
+      ptask->label_ = name_ + "/" + tname;
+      ptask->pentry_ = profiler::TaskEntry(ptask->label_);
+    }
+    Kokkos::Profiling::pushRegion(ptask->label_);
+    auto start = std::chrono::steady_clock::now();
+    TaskStatus status = (*ptask)(d,s);
+    Kokkos::fence();
+    std::chrono::duration<double> dt = std::chrono::steady_clock::now() - start;
+    ptask->pentry_->Add(s, dt.count());
+    Kokkos::Profiling::popRegion();
+    return status;
+  }
+
+  void SetTaskComplete(int n) {
+    tasks_[n]->SetComplete();
+    ncomplete_++;
+    for (auto next : nexts_[n]) {
+      if (--ndep_left_[next] == 0) {ready_.push_back(next);}
+    }
+  }
+
+  // build DAG from dependencies stored in each Task, and check it is complete/acyclic
+  void BuildGraph() {
+    std::size_t ntask = task_list_.size();
+    tasks_.assign(ntask, nullptr);
+    ndep_.assign(ntask, 0);
+    ndep_left_.assign(ntask, 0);
+    nexts_.assign(ntask, std::vector<int>());
+    initial_.clear();
+    for (auto &it : task_list_) {
+      auto bits = it.GetID().SetBits();
+      tasks_[bits[0]] = &it;
+    }
+    for (auto &it : task_list_) {
+      int n = it.GetID().SetBits()[0];
+      for (auto dep : it.GetDependency().SetBits()) {
+        if (dep >= static_cast<int>(ntask) || dep == n) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                    << std::endl << "Task " << n+1 << " depends on Task " << dep+1
+                    << " which is not in the same TaskList" << std::endl;
+          std::exit(EXIT_FAILURE);
+        }
+        nexts_[dep].push_back(n);
+        ndep_[n]++;
+      }
+      if (ndep_[n] == 0) {initial_.push_back(n);}
+    }
+    // check graph is acyclic by counting Tasks reachable from those with no dependencies
+    std::vector<int> nleft(ndep_);
+    std::vector<int> queue(initial_);
+    for (std::size_t q=0; q<queue.size(); ++q) {
+      for (auto next : nexts_[queue[q]]) {
+        if (--nleft[next] == 0) {queue.push_back(next);}
+      }
+    }
+    if (queue.size() != ntask) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "TaskList contains cyclic dependencies; only "
+                << queue.size() << " of " << ntask << " Tasks can be executed"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    graph_built_ = true;
+  }
 };
 
 #endif  // TASKLIST_TASK_LIST_HPP_
@@ -41,6 +41,10 @@ class CartesianGrid {
   void SetInterpolationIndices();      // set indexing for interpolation
   void SetInterpolationWeights();      // set weights for interpolation
   void ResetCenterAndExtent(Real center[3], Real extent[3]);
+  // true if point (nx,ny,nz) is interpolated from a MeshBlock on this rank
+  bool IsOwned(int nx, int ny, int nz) const {
+    return (interp_indcs.h_view(nx,ny,nz,0) != -1);
+  }
 
  private:
   MeshBlockPack* pmy_pack;  // ptr to MeshBlockPack containing this Hydro
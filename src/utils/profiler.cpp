@@ -0,0 +1,284 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file profiler.cpp
+//  \brief implementation of functions in namespace profiler: storage of accumulated
+//  timers, reduction of timers across MPI ranks, and printing/dumping of reports.
+
+#include <algorithm>
+#include <cstdio>      // snprintf
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "parameter_input.hpp"
+#include "utils/profiler.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+namespace profiler {
+
+bool task_timing = false;
+bool kernel_timing = false;
+int dump_cycles = 0;
+int current_stage = 0;
+
+namespace {
+std::map<std::string, Entry> task_entries;
+std::map<std::string, Entry> kernel_entries;
+
+//----------------------------------------------------------------------------------------
+//! \struct Summary
+//  \brief timers of one map of entries reduced over all ranks.  Per-rank totals are only
+//  stored on rank 0.
+
+struct Summary {
+  int nstage = 0;
+  std::vector<std::string> name;
+  std::vector<double> tmin, tavg, tmax;   // total time over all stages, across ranks
+  std::vector<double> tstage;             // avg time across ranks, [n*nstage + stage]
+  std::vector<double> ncalls;             // avg number of calls per rank
+  std::vector<double> trank;              // total time on each rank, [n*nranks + rank]
+};
+
+//----------------------------------------------------------------------------------------
+//! \fn Summary Reduce()
+//! \brief Reduces timers across ranks.  Ranks may have entered different regions (e.g.
+//! a boundary kernel that only runs on some MeshBlocks), so the union of all names is
+//! formed first, with timers that were never entered on a rank counted as zero.
+
+Summary Reduce(const std::map<std::string, Entry> &entries) {
+  const int nranks = global_variable::nranks;
+  Summary sum;
+  std::set<std::string> names;
+  int nstage = 1;
+  for (auto &it : entries) {
+    names.insert(it.first);
+    nstage = std::max(nstage, static_cast<int>(it.second.time.size()));
+  }
+#if MPI_PARALLEL_ENABLED
+  {
+    std::string local;
+    for (auto &it : entries) {local += it.first + '\n';}
+    int len = static_cast<int>(local.size());
+    std::vector<int> lens(nranks), displs(nranks, 0);
+    MPI_Allgather(&len, 1, MPI_INT, lens.data(), 1, MPI_INT, MPI_COMM_WORLD);
+    for (int r=1; r<nranks; ++r) {displs[r] = displs[r-1] + lens[r-1];}
+    std::vector<char> buf(displs[nranks-1] + lens[nranks-1] + 1);
+    MPI_Allgatherv(local.data(), len, MPI_CHAR, buf.data(), lens.data(), displs.data(),
+                   MPI_CHAR, MPI_COMM_WORLD);
+    std::istringstream all(std::string(buf.data(), buf.size()-1));
+    std::string line;
+    while (std::getline(all, line)) {
+      if (!line.empty()) {names.insert(line);}
+    }
+    MPI_Allreduce(MPI_IN_PLACE, &nstage, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+  }
+#endif
+  sum.nstage = nstage;
+  sum.name.assign(names.begin(), names.end());
+  int nent = static_cast<int>(sum.name.size());
+
+  // load timers on this rank
+  std::vector<double> total(nent, 0.0), calls(nent, 0.0);
+  sum.tstage.assign(nent*nstage, 0.0);
+  for (int n=0; n<nent; ++n) {
+    auto it = entries.find(sum.name[n]);
+    if (it == entries.end()) continue;
+    for (std::size_t s=0; s<it->second.time.size(); ++s) {
+      sum.tstage[n*nstage + s] = it->second.time[s];
+      total[n] += it->second.time[s];
+      calls[n] += static_cast<double>(it->second.ncalls[s]);
+    }
+  }
+  sum.tmin = total;
+  sum.tmax = total;
+  sum.tavg = total;
+  sum.ncalls = calls;
+  sum.trank = total;
+#if MPI_PARALLEL_ENABLED
+  if (nent > 0) {
+    MPI_Allreduce(total.data(), sum.tmin.data(), nent, MPI_DOUBLE, MPI_MIN,
+                  MPI_COMM_WORLD);
+    MPI_Allreduce(total.data(), sum.tmax.data(), nent, MPI_DOUBLE, MPI_MAX,
+                  MPI_COMM_WORLD);
+    MPI_Allreduce(total.data(), sum.tavg.data(), nent, MPI_DOUBLE, MPI_SUM,
+                  MPI_COMM_WORLD);
+    MPI_Allreduce(calls.data(), sum.ncalls.data(), nent, MPI_DOUBLE, MPI_SUM,
+                  MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, sum.tstage.data(), nent*nstage, MPI_DOUBLE, MPI_SUM,
+                  MPI_COMM_WORLD);
+    sum.trank.resize(nent*nranks);
+    MPI_Gather(total.data(), nent, MPI_DOUBLE, sum.trank.data(), nent, MPI_DOUBLE, 0,
+               MPI_COMM_WORLD);
+  }
+#endif
+  // convert sums to averages, and store per-rank totals as [entry][rank]
+  std::vector<double> trank(nent*nranks);
+  double rnranks = static_cast<double>(nranks);
+  for (int n=0; n<nent; ++n) {
+    sum.tavg[n] /= rnranks;
+    sum.ncalls[n] /= rnranks;
+    for (int s=0; s<nstage; ++s) {sum.tstage[n*nstage + s] /= rnranks;}
+    for (int r=0; r<nranks; ++r) {trank[n*nranks + r] = sum.trank[r*nent + n];}
+  }
+  sum.trank = trank;
+  return sum;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void PrintTable()
+//! \brief Prints one table of reduced timers on rank 0, sorted by average time
+
+void PrintTable(const std::string &title, const Summary &sum, double run_time) {
+  int nent = static_cast<int>(sum.name.size());
+  std::vector<int> order(nent);
+  for (int n=0; n<nent; ++n) {order[n] = n;}
+  std::sort(order.begin(), order.end(),
+            [&sum](int a, int b) {return sum.tavg[a] > sum.tavg[b];});
+  int width = static_cast<int>(title.size());
+  for (auto &name : sum.name) {width = std::max(width, static_cast<int>(name.size()));}
+
+  std::cout << std::endl << std::left << std::setw(width) << title << std::right
+            << std::setw(12) << "calls/rank" << std::setw(12) << "min [s]"
+            << std::setw(12) << "avg [s]" << std::setw(12) << "max [s]"
+            << std::setw(10) << "max/avg" << std::setw(9) << "% run";
+  for (int s=0; s<sum.nstage; ++s) {
+    std::cout << std::setw(10) << ("stage" + std::to_string(s));
+  }
+  std::cout << std::endl;
+  for (auto n : order) {
+    double imbalance = (sum.tavg[n] > 0.0)? sum.tmax[n]/sum.tavg[n] : 1.0;
+    double percent = (run_time > 0.0)? 100.0*sum.tavg[n]/run_time : 0.0;
+    std::cout << std::left << std::setw(width) << sum.name[n] << std::right
+              << std::fixed << std::setprecision(0) << std::setw(12) << sum.ncalls[n]
+              << std::scientific << std::setprecision(4)
+              << std::setw(12) << sum.tmin[n] << std::setw(12) << sum.tavg[n]
+              << std::setw(12) << sum.tmax[n] << std::fixed << std::setprecision(3)
+              << std::setw(10) << imbalance << std::setprecision(2) << std::setw(9)
+              << percent << std::scientific << std::setprecision(2);
+    for (int s=0; s<sum.nstage; ++s) {
+      std::cout << std::setw(10) << sum.tstage[n*sum.nstage + s];
+    }
+    std::cout << std::endl;
+  }
+  std::cout << std::defaultfloat << std::setprecision(6);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void WriteJSONArray()
+//! \brief Writes one map of reduced timers as a JSON array of objects
+
+void WriteJSONArray(std::ofstream &os, const Summary &sum) {
+  const int nranks = global_variable::nranks;
+  int nent = static_cast<int>(sum.name.size());
+  os << "[";
+  for (int n=0; n<nent; ++n) {
+    os << ((n == 0)? "\n" : ",\n") << "    {\"name\": \"" << sum.name[n] << "\""
+       << ", \"calls_per_rank\": " << sum.ncalls[n] << ", \"min\": " << sum.tmin[n]
+       << ", \"avg\": " << sum.tavg[n] << ", \"max\": " << sum.tmax[n] << ",\n"
+       << "     \"stage\": [";
+    for (int s=0; s<sum.nstage; ++s) {
+      os << ((s == 0)? "" : ", ") << sum.tstage[n*sum.nstage + s];
+    }
+    os << "],\n     \"rank\": [";
+    for (int r=0; r<nranks; ++r) {
+      os << ((r == 0)? "" : ", ") << sum.trank[n*nranks + r];
+    }
+    os << "]}";
+  }
+  os << "\n  ]";
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn void profiler::Initialize()
+//! \brief Reads parameters in the <profiling> block.  With neither timer enabled, the
+//! only cost of the profiler is testing a flag in each Task and kernel launch.
+
+void Initialize(ParameterInput *pin) {
+  task_timing = pin->GetOrAddBoolean("profiling", "task_timing", false);
+  kernel_timing = pin->GetOrAddBoolean("profiling", "kernel_timing", false);
+  dump_cycles = pin->GetOrAddInteger("profiling", "dump_cycles", 0);
+  if (dump_cycles > 0 && !(task_timing || kernel_timing)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "<profiling>/dump_cycles is set, but neither task_timing "
+              << "nor kernel_timing is enabled" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Entry *profiler::TaskEntry()
+//! \brief Returns pointer to timer of Task with given name, creating it if needed.
+//! Pointers remain valid since elements of a std::map are never moved.
+
+Entry *TaskEntry(const std::string &name) {
+  return &(task_entries[name]);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Entry *profiler::KernelEntry()
+//! \brief Returns pointer to timer of kernel with given name, creating it if needed.
+
+Entry *KernelEntry(const std::string &name) {
+  return &(kernel_entries[name]);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void profiler::Report()
+//! \brief Prints tables of Task and kernel timers (min/avg/max across ranks) to stdout.
+//! Must be called by all ranks.
+
+void Report(double run_time) {
+  if (task_timing) {
+    Summary sum = Reduce(task_entries);
+    if (global_variable::my_rank == 0) {PrintTable("Task", sum, run_time);}
+  }
+  if (kernel_timing) {
+    Summary sum = Reduce(kernel_entries);
+    if (global_variable::my_rank == 0) {PrintTable("Kernel", sum, run_time);}
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void profiler::DumpJSON()
+//! \brief Writes timers accumulated since the start of the run to the JSON file
+//! basename.prof.NNNNN.json, where NNNNN is the cycle.  Must be called by all ranks.
+
+void DumpJSON(const std::string &basename, int ncycle, double time) {
+  Summary tsum, ksum;
+  if (task_timing) {tsum = Reduce(task_entries);}
+  if (kernel_timing) {ksum = Reduce(kernel_entries);}
+  if (global_variable::my_rank != 0) return;
+
+  char number[12];
+  std::snprintf(number, sizeof(number), "%05d", ncycle);
+  std::string fname = basename + ".prof." + std::string(number) + ".json";
+  std::ofstream os(fname);
+  if (!os) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Profiling file '" << fname << "' could not be opened"
+              << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  os << std::setprecision(6);
+  os << "{\n  \"cycle\": " << ncycle << ",\n  \"time\": " << time
+     << ",\n  \"nranks\": " << global_variable::nranks << ",\n  \"tasks\": ";
+  WriteJSONArray(os, tsum);
+  os << ",\n  \"kernels\": ";
+  WriteJSONArray(os, ksum);
+  os << "\n}\n";
+}
+
+} // namespace profiler
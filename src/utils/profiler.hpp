@@ -0,0 +1,95 @@
+#ifndef UTILS_PROFILER_HPP_
+#define UTILS_PROFILER_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file profiler.hpp
+//  \brief built-in timers for Tasks and kernels, controlled by the <profiling> block
+//
+// Every Task executed by TaskList::DoAvailable() and every par_for/par_for_outer can be
+// wrapped in a named Kokkos profiling region, so that any Kokkos Tools library that is
+// loaded sees the same names.  Independent of such a library, the wall time spent in each
+// region is accumulated here, per stage of the integrator, and reported across ranks
+// (min/avg/max) at the end of the run and optionally every 'dump_cycles' cycles to a
+// JSON file.  Timing requires a fence of the device after each timed Task or kernel, so
+// all timers are off by default.
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+class ParameterInput;
+
+namespace profiler {
+
+//----------------------------------------------------------------------------------------
+//! \struct Entry
+//  \brief accumulated wall time and number of calls of one named region, per stage
+
+struct Entry {
+  std::vector<double> time;           // wall time [s] in region, indexed by stage
+  std::vector<std::int64_t> ncalls;   // number of times region was entered, per stage
+  void Add(int stage, double dt) {
+    if (stage < 0) {stage = 0;}
+    if (stage >= static_cast<int>(time.size())) {
+      time.resize(stage+1, 0.0);
+      ncalls.resize(stage+1, 0);
+    }
+    time[stage] += dt;
+    ncalls[stage]++;
+  }
+};
+
+// runtime switches set in Initialize(), and current stage set in TaskList::DoAvailable()
+extern bool task_timing;     // time each Task executed in a TaskList
+extern bool kernel_timing;   // time each par_for and par_for_outer
+extern int dump_cycles;      // cycles between JSON dumps (<=0 disables dumps)
+extern int current_stage;    // stage of TaskList currently being executed
+
+void Initialize(ParameterInput *pin);
+Entry *TaskEntry(const std::string &name);
+Entry *KernelEntry(const std::string &name);
+void Report(double run_time);
+void DumpJSON(const std::string &basename, int ncycle, double time);
+
+//----------------------------------------------------------------------------------------
+//! \class KernelScope
+//  \brief RAII timer wrapped around each par_for/par_for_outer in athena.hpp.  Does
+//  nothing beyond testing a flag unless kernel_timing is enabled.
+
+template <typename ExeSpace>
+class KernelScope {
+ public:
+  KernelScope(const std::string &name, const ExeSpace &exec_space) :
+    exec_space_(exec_space) {
+    if (kernel_timing) {
+      Kokkos::Profiling::pushRegion(name);
+      pentry_ = KernelEntry(name);
+      start_ = std::chrono::steady_clock::now();
+    }
+  }
+  ~KernelScope() {
+    if (pentry_ != nullptr) {
+      exec_space_.fence();
+      std::chrono::duration<double> dt = std::chrono::steady_clock::now() - start_;
+      pentry_->Add(current_stage, dt.count());
+      Kokkos::Profiling::popRegion();
+    }
+  }
+  KernelScope(const KernelScope&) = delete;
+  KernelScope &operator=(const KernelScope&) = delete;
+
+ private:
+  ExeSpace exec_space_;
+  Entry *pentry_ = nullptr;
+  std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace profiler
+#endif // UTILS_PROFILER_HPP_
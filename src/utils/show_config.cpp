@@ -32,6 +32,11 @@ void ShowConfig() {
 #else
   std::cout<<"  OpenMP parallelism:         OFF" << std::endl;
 #endif
+#if ZLIB_ENABLED
+  std::cout<<"  zlib compression:           ON" << std::endl;
+#else
+  std::cout<<"  zlib compression:           OFF" << std::endl;
+#endif
 
   // std::cout<<"  Compiler:                   " << COMPILED_WITH << std::endl;
   // std::cout<<"  Compilation command:        " << COMPILER_COMMAND
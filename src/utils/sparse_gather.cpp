@@ -0,0 +1,126 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file sparse_gather.cpp
+//  \brief implements SparseGather class
+
+#include "sparse_gather.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+
+//----------------------------------------------------------------------------------------
+// destructor: completes any outstanding gather so that no request is left active
+
+SparseGather::~SparseGather() {
+  Complete();
+#if MPI_PARALLEL_ENABLED
+  if (comm_ != MPI_COMM_NULL) {MPI_Comm_free(&comm_);}
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void SparseGather::Start()
+//! \brief packs values at points owned by this rank and starts non-blocking gather of
+//! (index, values) pairs to root.  A gather still outstanding from a previous call is
+//! completed first, since its send buffers are reused.
+
+void SparseGather::Start(const Real *dense, int nvar, int npts,
+                         const std::vector<int> &owned) {
+  Complete();
+  nvar_ = nvar;
+  npts_ = npts;
+  nown_ = owned.size();
+  send_idx_ = owned;
+  send_val_.resize(static_cast<std::size_t>(nown_)*nvar);
+  for (int p=0; p<nown_; ++p) {
+    for (int n=0; n<nvar; ++n) {
+      send_val_[static_cast<std::size_t>(p)*nvar + n] =
+        dense[static_cast<std::size_t>(n)*npts + owned[p]];
+    }
+  }
+
+#if MPI_PARALLEL_ENABLED
+  if (comm_ == MPI_COMM_NULL) {MPI_Comm_dup(MPI_COMM_WORLD, &comm_);}
+  if (global_variable::my_rank == 0) {
+    // root posts gathers of indices and values in Complete(), once counts are known
+    cnt_idx_.resize(global_variable::nranks);
+    MPI_Igather(&nown_, 1, MPI_INT, cnt_idx_.data(), 1, MPI_INT, 0, comm_, &req_[0]);
+    req_[1] = MPI_REQUEST_NULL;
+    req_[2] = MPI_REQUEST_NULL;
+  } else {
+    // counts and displacements are only significant on root
+    MPI_Igather(&nown_, 1, MPI_INT, nullptr, 1, MPI_INT, 0, comm_, &req_[0]);
+    MPI_Igatherv(send_idx_.data(), nown_, MPI_INT, nullptr, nullptr, nullptr, MPI_INT,
+                 0, comm_, &req_[1]);
+    MPI_Igatherv(send_val_.data(), nown_*nvar, MPI_ATHENA_REAL, nullptr, nullptr,
+                 nullptr, MPI_ATHENA_REAL, 0, comm_, &req_[2]);
+  }
+#else
+  recv_idx_.swap(send_idx_);
+  recv_val_.swap(send_val_);
+#endif
+  pending_ = true;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void SparseGather::Complete()
+//! \brief completes communication of a gather started by Start().  On root, waits for
+//! the counts of points owned by each rank, then posts and completes the gathers of
+//! (index, values) pairs.  On other ranks only waits for the sends to complete.  Does
+//! nothing if no gather is outstanding.
+
+void SparseGather::Complete() {
+  if (!pending_) return;
+  pending_ = false;
+#if MPI_PARALLEL_ENABLED
+  if (global_variable::my_rank == 0) {
+    MPI_Wait(&req_[0], MPI_STATUS_IGNORE);
+    int nranks = global_variable::nranks;
+    dsp_idx_.resize(nranks);
+    cnt_val_.resize(nranks);
+    dsp_val_.resize(nranks);
+    int ntot = 0;
+    for (int r=0; r<nranks; ++r) {
+      dsp_idx_[r] = ntot;
+      cnt_val_[r] = cnt_idx_[r]*nvar_;
+      dsp_val_[r] = ntot*nvar_;
+      ntot += cnt_idx_[r];
+    }
+    recv_idx_.resize(ntot);
+    recv_val_.resize(static_cast<std::size_t>(ntot)*nvar_);
+    MPI_Igatherv(send_idx_.data(), nown_, MPI_INT, recv_idx_.data(), cnt_idx_.data(),
+                 dsp_idx_.data(), MPI_INT, 0, comm_, &req_[1]);
+    MPI_Igatherv(send_val_.data(), nown_*nvar_, MPI_ATHENA_REAL, recv_val_.data(),
+                 cnt_val_.data(), dsp_val_.data(), MPI_ATHENA_REAL, 0, comm_, &req_[2]);
+  }
+  MPI_Waitall(3, req_, MPI_STATUSES_IGNORE);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void SparseGather::Finish()
+//! \brief completes gather started by Start(), and on root scatters received values into
+//! dense array.  On other ranks this only waits for the sends to complete.  Does nothing
+//! if no gather is outstanding.
+
+void SparseGather::Finish(Real *dense) {
+  if (!pending_) return;
+  Complete();
+#if MPI_PARALLEL_ENABLED
+  if (global_variable::my_rank != 0) return;
+#endif
+  std::fill(dense, dense + static_cast<std::size_t>(nvar_)*npts_, 0.0);
+  int nrecv = recv_idx_.size();
+  for (int p=0; p<nrecv; ++p) {
+    for (int n=0; n<nvar_; ++n) {
+      dense[static_cast<std::size_t>(n)*npts_ + recv_idx_[p]] =
+        recv_val_[static_cast<std::size_t>(p)*nvar_ + n];
+    }
+  }
+}
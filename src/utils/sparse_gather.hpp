@@ -0,0 +1,61 @@
+#ifndef UTILS_SPARSE_GATHER_HPP_
+#define UTILS_SPARSE_GATHER_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file sparse_gather.hpp
+//  \brief definitions for SparseGather class, which collects data interpolated to the
+//  points of a CartesianGrid or SphericalSurface onto the root rank.
+//
+// Each point of such a grid is interpolated by exactly one rank.  Rather than summing
+// dense arrays (which are zero at points not owned by a rank) over all ranks, each rank
+// sends only its (index, values) pairs to root with non-blocking MPI_Igatherv.  Start()
+// returns immediately, and Finish() must be called before the data are used on root.
+// The number of points owned by each rank is also gathered with non-blocking
+// MPI_Igather, so no rank waits for root in Start().  Root only knows the layout of the
+// received data once these counts arrive, so it posts its MPI_Igatherv in Finish().
+// Since the other ranks post theirs in Start(), the gathers use a private communicator,
+// so that they cannot be matched with other collectives called in between.
+
+#include <vector>
+
+#include "athena.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+//----------------------------------------------------------------------------------------
+//! \class SparseGather
+
+class SparseGather {
+ public:
+  SparseGather() = default;
+  ~SparseGather();
+  SparseGather(const SparseGather&) = delete;
+  SparseGather &operator=(const SparseGather&) = delete;
+
+  // starts gather of values at points in 'owned' (indices in [0,npts) of points
+  // interpolated by this rank) from dense array with dims (nvar,npts)
+  void Start(const Real *dense, int nvar, int npts, const std::vector<int> &owned);
+  // completes gather; on root, fills dense array with dims (nvar,npts).  Points not
+  // owned by any rank are set to zero.  On other ranks 'dense' is not used.  Does
+  // nothing if there is no outstanding gather.
+  void Finish(Real *dense);
+
+ private:
+  void Complete();  // completes outstanding communication
+  int nvar_ = 0, npts_ = 0, nown_ = 0;
+  bool pending_ = false;
+  std::vector<int> send_idx_, recv_idx_;        // indices of owned points
+  std::vector<Real> send_val_, recv_val_;       // values at owned points (point,var)
+#if MPI_PARALLEL_ENABLED
+  std::vector<int> cnt_idx_, dsp_idx_, cnt_val_, dsp_val_;  // root: per-rank layout
+  MPI_Comm comm_ = MPI_COMM_NULL;
+  MPI_Request req_[3];   // gathers of counts, indices, and values
+#endif
+};
+
+#endif // UTILS_SPARSE_GATHER_HPP_
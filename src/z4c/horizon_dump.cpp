@@ -16,6 +16,7 @@
 #include <string>
 #include <cstdio>
 #include <utility>
+#include <vector>
 
 #if MPI_PARALLEL_ENABLED
 #include <mpi.h>
@@ -27,6 +28,7 @@
 #include "mesh/mesh.hpp"
 #include "parameter_input.hpp"
 #include "utils/cart_grid.hpp"
+#include "utils/sparse_gather.hpp"
 #include "coordinates/adm.hpp"
 #include "mhd/mhd.hpp"
 #include "z4c/z4c.hpp"
@@ -114,16 +116,18 @@ void HorizonDump::SetGridAndInterpolate(Real center[NDIM]) {
     }
   }
 
-  // MPI reduce here
-  // Reduction to the master rank for data_out
-  #if MPI_PARALLEL_ENABLED
-  if (0 == global_variable::my_rank) {
-    MPI_Reduce(MPI_IN_PLACE, data_out, count,
-              MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD);
-  } else {
-    MPI_Reduce(data_out, data_out, count, MPI_ATHENA_REAL, MPI_SUM, 0, MPI_COMM_WORLD);
+  // Gather values at points interpolated on each rank to the master rank
+  std::vector<int> owned;
+  for (int nx = 0; nx < horizon_nx; nx ++)
+  for (int ny = 0; ny < horizon_nx; ny ++)
+  for (int nz = 0; nz < horizon_nx; nz ++) {
+    if (pcat_grid->IsOwned(nx, ny, nz)) {
+      owned.push_back(nx * horizon_nx * horizon_nx + ny * horizon_nx + nz);
+    }
   }
-  #endif
+  SparseGather gather;
+  gather.Start(data_out, 16, horizon_nx * horizon_nx * horizon_nx, owned);
+  gather.Finish(data_out);
   // Then write output file
   // Open the file in binary write mode
   std::string foldername = "horizon_"+std::to_string(horizon_ind)
@@ -135,6 +139,7 @@ void HorizonDump::SetGridAndInterpolate(Real center[NDIM]) {
     FILE* etk_output_file = fopen(fname.c_str(), "wb");
     if (etk_output_file == nullptr) {
       perror("Error opening file");
+      delete[] data_out;
       return;
     }
     fwrite(&common_horizon, sizeof(int), 1, etk_output_file);
@@ -150,9 +155,9 @@ void HorizonDump::SetGridAndInterpolate(Real center[NDIM]) {
     // Write input script for Einstein Toolkit
     ETK_setup_parfile();
     output_count++;
-    // delete dataout
-    delete[] data_out;
   }
+  // delete dataout
+  delete[] data_out;
 }
 
 void HorizonDump::ETK_setup_parfile() {
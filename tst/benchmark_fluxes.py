@@ -0,0 +1,127 @@
+#!/usr/bin/env python
+
+"""
+Script to benchmark the hydro and MHD flux kernels for each combination of
+reconstruction method and Riemann solver.
+
+Usage: From this directory, call this script with python, giving one or more AthenaK
+executables built for CPU (serial or OpenMP), e.g. built before and after a change:
+      python benchmark_fluxes.py ../build_old/src/athena ../build/src/athena
+
+Notes:
+  - Each executable is run on a 3D linear wave (no outputs) for a fixed number of
+    cycles, and the zone-cycles/cpu_second reported at the end of the run is tabulated.
+  - With more than one executable, the speedup of each relative to the first is printed.
+  - Use --nx to change the size of the (single MeshBlock) grid, and --nlim to change the
+    number of cycles.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+RECONSTRUCT = ["dc", "plm", "ppm4", "ppmx", "wenoz"]
+RSOLVERS = {"hydro": ["llf", "hlle", "hllc", "roe"], "mhd": ["llf", "hlle", "hlld"]}
+
+INPUT = """<job>
+basename = bench
+
+<mesh>
+nghost = 3
+nx1 = {nx}
+x1min = 0.0
+x1max = 1.0
+ix1_bc = periodic
+ox1_bc = periodic
+nx2 = {nx}
+x2min = 0.0
+x2max = 1.0
+ix2_bc = periodic
+ox2_bc = periodic
+nx3 = {nx}
+x3min = 0.0
+x3max = 1.0
+ix3_bc = periodic
+ox3_bc = periodic
+
+<meshblock>
+nx1 = {nx}
+nx2 = {nx}
+nx3 = {nx}
+
+<time>
+evolution = dynamic
+integrator = rk2
+cfl_number = 0.3
+nlim = {nlim}
+tlim = 1.0e6
+ndiag = {nlim}
+
+<{physics}>
+eos = ideal
+reconstruct = plm
+rsolver = llf
+gamma = 1.66666666667
+
+<problem>
+pgen_name = linear_wave
+wave_flag = 0
+amp = 1.0e-3
+dens = 1.0
+pgas = 0.6
+bx0 = 1.0
+by0 = 1.41421356237
+along_x1 = false
+along_x2 = false
+along_x3 = false
+"""
+
+
+def zone_cycles(exe, inputfile, physics, recon, rsolver):
+    """Run exe once and return the zone-cycles/cpu_second it reports."""
+    command = [exe, "-i", inputfile, f"{physics}/reconstruct={recon}",
+               f"{physics}/rsolver={rsolver}"]
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            text=True)
+    match = re.search(r"zone-cycles/cpu_second = (\S+)", result.stdout)
+    if result.returncode != 0 or match is None:
+        sys.exit(f"Run failed: {' '.join(command)}\n{result.stdout}")
+    return float(match.group(1))
+
+
+def main(args):
+    exes = [os.path.abspath(exe) for exe in args.athena]
+    header = f"{'physics':8s}{'recon':8s}{'rsolver':9s}"
+    header += "".join(f"{'exe' + str(n):>12s}" for n in range(len(exes)))
+    if len(exes) > 1:
+        header += "".join(f"{'speedup' + str(n):>12s}" for n in range(1, len(exes)))
+    for n, exe in enumerate(exes):
+        print(f"exe{n} = {exe}")
+    print(header)
+    with tempfile.TemporaryDirectory() as rundir:
+        os.chdir(rundir)
+        for physics in args.physics:
+            inputfile = os.path.join(rundir, f"bench_{physics}.athinput")
+            with open(inputfile, "w") as f:
+                f.write(INPUT.format(nx=args.nx, nlim=args.nlim, physics=physics))
+            for recon in RECONSTRUCT:
+                for rsolver in RSOLVERS[physics]:
+                    zcps = [zone_cycles(exe, inputfile, physics, recon, rsolver)
+                            for exe in exes]
+                    line = f"{physics:8s}{recon:8s}{rsolver:9s}"
+                    line += "".join(f"{z:12.4e}" for z in zcps)
+                    line += "".join(f"{z/zcps[0]:12.3f}" for z in zcps[1:])
+                    print(line, flush=True)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[1])
+    parser.add_argument("athena", nargs="+", help="AthenaK executable(s) to benchmark")
+    parser.add_argument("--physics", nargs="+", choices=["hydro", "mhd"],
+                        default=["hydro", "mhd"], help="physics modules to benchmark")
+    parser.add_argument("--nx", type=int, default=64, help="cells per direction")
+    parser.add_argument("--nlim", type=int, default=20, help="number of cycles")
+    main(parser.parse_args())
@@ -0,0 +1,146 @@
+#!/usr/bin/env python
+
+"""
+Script to benchmark the optional cache of the stationary Kerr-Schild metric used by the
+GR hydro and MHD kernels (<coord>/metric_cache), measuring the trade-off between memory
+and recomputation of the metric.
+
+Usage: From this directory, call this script with python, giving an AthenaK executable
+built for CPU (serial or OpenMP):
+      python benchmark_metric_cache.py ../build/src/athena
+
+Notes:
+  - For each physics module and GR Riemann solver the executable is run with the metric
+    cache disabled and enabled on a Bondi (hydro) or monopole (MHD) problem with no
+    outputs, and the zone-cycles/cpu_second and peak resident memory of each run are
+    tabulated, together with the size of the cache itself.
+  - Use --nx and --nxb to change the size of the grid and MeshBlocks, and --nlim to
+    change the number of cycles.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+RSOLVERS = ["llf", "hlle"]
+NMETRIC_CC = 16    # values cached per cell center: f, l_i, and their derivatives
+NMETRIC_FC = 4     # values cached per face: f, l_i
+
+INPUT = """<job>
+basename = bench
+
+<mesh>
+nghost = 3
+nx1 = {nx}
+x1min = -10.0
+x1max = 10.0
+ix1_bc = user
+ox1_bc = user
+nx2 = {nx}
+x2min = -10.0
+x2max = 10.0
+ix2_bc = user
+ox2_bc = user
+nx3 = {nx}
+x3min = -10.0
+x3max = 10.0
+ix3_bc = user
+ox3_bc = user
+
+<meshblock>
+nx1 = {nxb}
+nx2 = {nxb}
+nx3 = {nxb}
+
+<coord>
+general_rel = true
+a = 0.5
+excise = true
+dexcise = 1.0e-4
+pexcise = 0.333e-6
+
+<time>
+evolution = dynamic
+integrator = rk2
+cfl_number = 0.3
+nlim = {nlim}
+tlim = 1.0e6
+ndiag = {nlim}
+
+<{physics}>
+eos = ideal
+reconstruct = plm
+rsolver = hlle
+gamma = 1.3333333333333
+dfloor = 1.0e-6
+pfloor = 0.333e-8
+gamma_max = 10.0
+
+<problem>
+pgen_name = {pgen}
+k_adi = 1.0
+r_crit = 8.0
+"""
+
+PGEN = {"hydro": "gr_bondi", "mhd": "gr_monopole"}
+
+
+def run(exe, inputfile, physics, rsolver, cache):
+    """Run exe once and return zone-cycles/cpu_second and peak memory (MB)."""
+    command = [exe, "-i", inputfile, f"{physics}/rsolver={rsolver}",
+               f"coord/metric_cache={'true' if cache else 'false'}"]
+    proc = subprocess.Popen(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            text=True)
+    output = proc.stdout.read()
+    _, status, usage = os.wait4(proc.pid, 0)
+    proc.returncode = os.waitstatus_to_exitcode(status)
+    match = re.search(r"zone-cycles/cpu_second = (\S+)", output)
+    if proc.returncode != 0 or match is None:
+        sys.exit(f"Run failed: {' '.join(command)}\n{output}")
+    return float(match.group(1)), usage.ru_maxrss/1024.0
+
+
+def cache_size(nx, nxb, ng=3):
+    """Size (MB) of metric cache over all MeshBlocks, including ghost zones."""
+    nmb = (nx//nxb)**3
+    nc = nxb + 2*ng
+    ncells = nc**3
+    nfaces = 3*(nc + 1)*nc**2
+    return nmb*(NMETRIC_CC*ncells + NMETRIC_FC*nfaces)*8/1024.0**2
+
+
+def main(args):
+    exe = os.path.abspath(args.athena)
+    print(f"exe = {exe}")
+    print(f"metric cache size = {cache_size(args.nx, args.nxb):.1f} MB (double)")
+    header = f"{'physics':8s}{'rsolver':9s}{'zcps(off)':>12s}{'zcps(on)':>12s}"
+    header += f"{'speedup':>10s}{'MB(off)':>10s}{'MB(on)':>10s}"
+    print(header)
+    with tempfile.TemporaryDirectory() as rundir:
+        os.chdir(rundir)
+        for physics in args.physics:
+            inputfile = os.path.join(rundir, f"bench_{physics}.athinput")
+            with open(inputfile, "w") as f:
+                f.write(INPUT.format(nx=args.nx, nxb=args.nxb, nlim=args.nlim,
+                                     physics=physics, pgen=PGEN[physics]))
+            for rsolver in RSOLVERS:
+                zoff, moff = run(exe, inputfile, physics, rsolver, False)
+                zon, mon = run(exe, inputfile, physics, rsolver, True)
+                line = f"{physics:8s}{rsolver:9s}{zoff:12.4e}{zon:12.4e}"
+                line += f"{zon/zoff:10.3f}{moff:10.1f}{mon:10.1f}"
+                print(line, flush=True)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[1])
+    parser.add_argument("athena", help="AthenaK executable to benchmark")
+    parser.add_argument("--physics", nargs="+", choices=["hydro", "mhd"],
+                        default=["hydro", "mhd"], help="physics modules to benchmark")
+    parser.add_argument("--nx", type=int, default=64, help="cells per direction")
+    parser.add_argument("--nxb", type=int, default=32,
+                        help="cells per direction in each MeshBlock")
+    parser.add_argument("--nlim", type=int, default=20, help="number of cycles")
+    main(parser.parse_args())
@@ -0,0 +1,49 @@
+"""
+Regression test for the two-pass conservative-to-primitive inversion in GRMHD.
+Runs the relativistic MHD shocktube ("test1" from Mignone, Ugliano, & Bodo 2009) in GR
+with the ideal GRMHD EOS and with the PrimitiveSolver used in dynamical spacetimes,
+with and without <mhd>/c2p_fast_iter, and checks that the primitive variables at the
+end of the run are identical, since cells left unconverged by the fast pass are solved
+again from scratch.
+"""
+
+# Modules
+import pytest
+import test_suite.testutils as testutils
+
+_name = ["mub1", "mub1_dyngrmhd"]  # ideal GRMHD and dynamical GRMHD inputs
+_fast_iter = 2  # small enough that shocked cells need the second pass
+
+
+def arguments(name, fast_iter):
+    """Assemble arguments for run command"""
+    return [
+        f"job/basename={name}_{fast_iter}",
+        "mesh/nx1=256",
+        "meshblock/nx1=128",
+        "coord/special_rel=false",
+        "coord/general_rel=true",
+        f"mhd/c2p_fast_iter={fast_iter}",
+    ]
+
+
+@pytest.mark.parametrize("name", _name)
+def test_run(name):
+    """Run with one- and two-pass inversion and compare final outputs."""
+    try:
+        for fast_iter in [0, _fast_iter]:
+            results = testutils.run(
+                f"inputs/{name}.athinput", arguments(name, fast_iter)
+            )
+            assert results, f"Run failed for {name} with c2p_fast_iter={fast_iter}."
+        maxdiff = testutils.max_binary_difference(
+            testutils.last_binary_output(f"{name}_0", "mhd_w"),
+            testutils.last_binary_output(f"{name}_{_fast_iter}", "mhd_w"),
+        )
+        if maxdiff != 0.0:
+            pytest.fail(
+                f"c2p_fast_iter={_fast_iter} changes {name} results, "
+                f"max difference: {maxdiff:g}"
+            )
+    finally:
+        testutils.cleanup()
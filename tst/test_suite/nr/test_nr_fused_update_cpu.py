@@ -0,0 +1,47 @@
+"""
+Regression test for the fused flux-divergence update in non-relativistic hydro/MHD.
+Runs a 2D linear wave with and without <hydro>/fused_update (or <mhd>/fused_update)
+for different reconstruction algorithms, and checks that the primitive variables at
+the end of the run agree to round-off.
+"""
+
+# Modules
+import pytest
+import test_suite.testutils as testutils
+
+_recon = ["plm", "ppm4", "wenoz"]
+maxdiff_allowed = 1.0e-6  # outputs are single precision
+
+
+def arguments(soe, rv, name, fused):
+    """Assemble arguments for run command"""
+    return [
+        f"job/basename={name}",
+        "mesh/nghost=" + repr(2 if rv == "plm" else 3),
+        f"{soe}/reconstruct=" + rv,
+        f"{soe}/fused_update=" + ("true" if fused else "false"),
+    ]
+
+
+@pytest.mark.parametrize("rv", _recon)
+@pytest.mark.parametrize("soe", ["hydro", "mhd"])
+def test_run(soe, rv):
+    """Run with and without fused update and compare final outputs."""
+    try:
+        for fused in [False, True]:
+            name = f"fused_{soe}_{rv}_{fused}"
+            results = testutils.run(
+                f"inputs/lwave2d_{soe}.athinput", arguments(soe, rv, name, fused)
+            )
+            assert results, f"Run failed for {soe}+{rv} with fused_update={fused}."
+        maxdiff = testutils.max_binary_difference(
+            testutils.last_binary_output(f"fused_{soe}_{rv}_False", f"{soe}_w"),
+            testutils.last_binary_output(f"fused_{soe}_{rv}_True", f"{soe}_w"),
+        )
+        if maxdiff > maxdiff_allowed:
+            pytest.fail(
+                f"fused_update changes {soe}+{rv} results, "
+                f"max difference: {maxdiff:g} threshold: {maxdiff_allowed:g}"
+            )
+    finally:
+        testutils.cleanup()
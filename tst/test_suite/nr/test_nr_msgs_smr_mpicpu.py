@@ -0,0 +1,56 @@
+"""
+Regression test for aggregated and persistent boundary messages with SMR.
+Runs a 2D linear wave through a statically refined region on 4 ranks with
+<mesh>/aggregate_msgs and <mesh>/persistent_msgs on and off, and checks that the
+primitive variables at the end of the run are identical to those obtained when every
+boundary buffer is sent as its own message.
+"""
+
+# Modules
+import pytest
+import test_suite.testutils as testutils
+
+# (aggregate_msgs, persistent_msgs) to compare against the per-buffer path
+_msgs = [("true", "false"), ("false", "true"), ("true", "true")]
+
+
+def arguments(name, aggregate, persistent):
+    """Assemble arguments for run command"""
+    return [
+        f"job/basename={name}",
+        "mesh_refinement/refinement=static",
+        f"mesh/aggregate_msgs={aggregate}",
+        f"mesh/persistent_msgs={persistent}",
+    ]
+
+
+@pytest.mark.parametrize("soe", ["hydro", "mhd"])
+def test_run(soe):
+    """Run with each kind of message and compare final outputs."""
+    try:
+        for aggregate, persistent in [("false", "false")] + _msgs:
+            name = f"msgs_{soe}_{aggregate}_{persistent}"
+            results = testutils.mpi_run(
+                f"inputs/lwave2d_{soe}.athinput",
+                arguments(name, aggregate, persistent),
+                threads=4,
+            )
+            assert results, (
+                f"Run failed for {soe} with aggregate_msgs={aggregate}, "
+                f"persistent_msgs={persistent}."
+            )
+        base = testutils.last_binary_output(f"msgs_{soe}_false_false", f"{soe}_w")
+        for aggregate, persistent in _msgs:
+            maxdiff = testutils.max_binary_difference(
+                base,
+                testutils.last_binary_output(
+                    f"msgs_{soe}_{aggregate}_{persistent}", f"{soe}_w"
+                ),
+            )
+            if maxdiff != 0.0:
+                pytest.fail(
+                    f"aggregate_msgs={aggregate}, persistent_msgs={persistent} changes "
+                    f"{soe} results, max difference: {maxdiff:g}"
+                )
+    finally:
+        testutils.cleanup()
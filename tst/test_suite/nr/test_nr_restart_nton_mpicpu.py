@@ -0,0 +1,60 @@
+"""
+Regression test for N-to-M restarts of non-relativistic hydro/MHD.
+Runs a 2D linear wave (8 MeshBlocks) on 4 ranks for a few cycles, writing one restart
+file per rank in the original and packed formats, restarts it on fewer (2) and more
+(8) ranks, and checks that the primitive variables at the end of each restarted run
+are identical to those of an uninterrupted run.
+"""
+
+# Modules
+import pytest
+import test_suite.testutils as testutils
+
+_packed = ["false", "true"]  # original and packed restart formats
+_nranks = [2, 8]  # number of ranks used on restart
+_nranks_rst = 4  # number of ranks that write restart files
+_ncycle = 10  # cycles before restart
+
+
+def arguments(name, nlim, packed):
+    """Assemble arguments for run command"""
+    return [
+        f"job/basename={name}",
+        f"time/nlim={nlim}",
+        "output2/single_file_per_rank=true",
+        f"output2/packed={packed}",
+    ]
+
+
+@pytest.mark.parametrize("packed", _packed)
+@pytest.mark.parametrize("soe", ["hydro", "mhd"])
+def test_run(soe, packed):
+    """Restart on different numbers of ranks and compare with an uninterrupted run."""
+    input_file = f"inputs/lwave2d_{soe}.athinput"
+    try:
+        results = testutils.mpi_run(
+            input_file, arguments("full", -1, packed), threads=_nranks_rst
+        )
+        assert results, f"Uninterrupted run failed for {soe}."
+        results = testutils.mpi_run(
+            input_file, arguments("part", _ncycle, packed), threads=_nranks_rst
+        )
+        assert results, f"Run failed for {soe} writing restart files (packed={packed})."
+        rst_file = testutils.last_restart_file("part", single_file_per_rank=True)
+        for nranks in _nranks:
+            name = f"restart_{nranks}"
+            results = testutils.mpi_run(
+                input_file, ["-r", rst_file, f"job/basename={name}"], threads=nranks
+            )
+            assert results, f"Restart of {soe} on {nranks} ranks failed."
+            maxdiff = testutils.max_binary_difference(
+                testutils.last_binary_output("full", f"{soe}_w"),
+                testutils.last_binary_output(name, f"{soe}_w"),
+            )
+            if maxdiff != 0.0:
+                pytest.fail(
+                    f"restart of {soe} from {_nranks_rst} to {nranks} ranks "
+                    f"(packed={packed}) changes results, max difference: {maxdiff:g}"
+                )
+    finally:
+        testutils.cleanup()
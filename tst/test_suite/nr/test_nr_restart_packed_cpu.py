@@ -0,0 +1,61 @@
+"""
+Regression test for restarts of non-relativistic hydro/MHD from packed restart files.
+Runs a 2D linear wave for a few cycles, restarts it from restart files written with
+and without <output2>/packed (uncompressed and compressed, shared and one file per
+rank), and checks that the primitive variables at the end of each restarted run are
+identical to those of an uninterrupted run.
+"""
+
+# Modules
+import pytest
+import test_suite.testutils as testutils
+
+# (single_file_per_rank, packed, compression_level) of restart files
+_formats = [
+    ("false", "false", "0"),
+    ("true", "false", "0"),
+    ("false", "true", "0"),
+    ("true", "true", "0"),
+    ("false", "true", "6"),
+    ("true", "true", "6"),
+]
+_ncycle = 10  # cycles before restart
+
+
+def arguments(name, nlim, fmt):
+    """Assemble arguments for run command"""
+    per_rank, packed, level = fmt
+    return [
+        f"job/basename={name}",
+        f"time/nlim={nlim}",
+        f"output2/single_file_per_rank={per_rank}",
+        f"output2/packed={packed}",
+        f"output2/compression_level={level}",
+    ]
+
+
+@pytest.mark.parametrize("fmt", _formats)
+@pytest.mark.parametrize("soe", ["hydro", "mhd"])
+def test_run(soe, fmt):
+    """Restart from files in given format and compare with an uninterrupted run."""
+    if fmt[2] != "0" and not testutils.zlib_enabled():
+        pytest.skip("compressed restart files require -D Athena_ENABLE_ZLIB=ON")
+    input_file = f"inputs/lwave2d_{soe}.athinput"
+    try:
+        results = testutils.run(input_file, arguments("full", -1, _formats[0]))
+        assert results, f"Uninterrupted run failed for {soe}."
+        results = testutils.run(input_file, arguments("part", _ncycle, fmt))
+        assert results, f"Run failed for {soe} writing restart files as {fmt}."
+        rst_file = testutils.last_restart_file("part", fmt[0] == "true")
+        results = testutils.run(input_file, ["-r", rst_file, "job/basename=restart"])
+        assert results, f"Restart failed for {soe} from {rst_file}."
+        maxdiff = testutils.max_binary_difference(
+            testutils.last_binary_output("full", f"{soe}_w"),
+            testutils.last_binary_output("restart", f"{soe}_w"),
+        )
+        if maxdiff != 0.0:
+            pytest.fail(
+                f"restart from {fmt} changes {soe} results, max difference: {maxdiff:g}"
+            )
+    finally:
+        testutils.cleanup()
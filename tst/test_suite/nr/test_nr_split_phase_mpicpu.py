@@ -0,0 +1,40 @@
+"""
+Regression test for split-phase updates in non-relativistic hydro/MHD.
+Runs a 2D linear wave on 4 ranks (two MeshBlocks per rank) with and without
+<hydro>/split_phase (or <mhd>/split_phase), and checks that the primitive variables at
+the end of the run are identical.
+"""
+
+# Modules
+import pytest
+import test_suite.testutils as testutils
+
+
+def arguments(soe, name, split):
+    """Assemble arguments for run command"""
+    return [
+        f"job/basename={name}",
+        f"{soe}/split_phase=" + ("true" if split else "false"),
+    ]
+
+
+@pytest.mark.parametrize("soe", ["hydro", "mhd"])
+def test_run(soe):
+    """Run with and without split-phase updates and compare final outputs."""
+    try:
+        for split in [False, True]:
+            name = f"split_{soe}_{split}"
+            results = testutils.mpi_run(
+                f"inputs/lwave2d_{soe}.athinput",
+                arguments(soe, name, split),
+                threads=4,
+            )
+            assert results, f"Run failed for {soe} with split_phase={split}."
+        maxdiff = testutils.max_binary_difference(
+            testutils.last_binary_output(f"split_{soe}_False", f"{soe}_w"),
+            testutils.last_binary_output(f"split_{soe}_True", f"{soe}_w"),
+        )
+        if maxdiff != 0.0:
+            pytest.fail(f"split_phase changes {soe} results, max difference: {maxdiff:g}")
+    finally:
+        testutils.cleanup()
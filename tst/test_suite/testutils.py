@@ -7,12 +7,14 @@ Various utility functions used for automatic testing, including
 
 # Modules
 import os
+import glob
 from subprocess import Popen, PIPE
 from typing import List
 import time
 import pytest
 import logging
 import sys
+import numpy as np
 
 sys.path.insert(0, "../vis/python")
 import athena_read  # noqa: E402
@@ -185,10 +187,109 @@ def cleanup(text=False) -> None:
         logging.info("Cleaning up test environment")
     Popen(["rm -rf tab/"], shell=True, stdout=PIPE).communicate()
     Popen(["rm " + "*.dat"], shell=True, stdout=PIPE).communicate()
+    Popen(["rm -rf bin/ rst/"], shell=True, stdout=PIPE).communicate()
     if text:
         logging.info("Cleanup completed")
 
 
+def last_binary_output(basename: str, file_id: str) -> str:
+    """
+    Returns the name of the last binary output file with the given basename and id.
+
+    Args:
+        basename (str): The <job>/basename of the run.
+        file_id (str): The id of the output (by default the output variable).
+
+    Returns:
+        str: The path to the file with the largest output number.
+
+    Raises:
+        RuntimeError: If no such file exists.
+    """
+    files = sorted(glob.glob(f"bin/{basename}.{file_id}.*.bin"))
+    if len(files) == 0:
+        raise RuntimeError(f"No binary output found for {basename}.{file_id}")
+    return files[-1]
+
+
+def last_restart_file(basename: str, single_file_per_rank: bool = False) -> str:
+    """
+    Returns the name of the last restart file with the given basename.
+
+    Args:
+        basename (str): The <job>/basename of the run.
+        single_file_per_rank (bool): Whether restart files were written by each rank,
+            in which case the file of rank 0 is returned (as expected by -r).
+
+    Returns:
+        str: The path to the file with the largest output number.
+
+    Raises:
+        RuntimeError: If no such file exists.
+    """
+    rst_dir = "rst/rank_00000000" if single_file_per_rank else "rst"
+    files = sorted(glob.glob(f"{rst_dir}/{basename}.*.rst"))
+    if len(files) == 0:
+        raise RuntimeError(f"No restart file found for {basename} in {rst_dir}")
+    return files[-1]
+
+
+def zlib_enabled() -> bool:
+    """
+    Checks whether the AthenaK binary was configured with zlib compression.
+
+    Returns:
+        bool: True if compressed restart files can be written.
+    """
+    process = Popen(["./athena", "-c"], stdout=PIPE, stderr=PIPE, text=True)
+    output, _ = process.communicate()
+    for line in output.splitlines():
+        if "zlib compression:" in line:
+            return line.split(":")[-1].strip() == "ON"
+    return False
+
+
+def max_binary_difference(file1: str, file2: str) -> float:
+    """
+    Returns the maximum absolute difference between two binary outputs of the same Mesh.
+    MeshBlocks are matched by logical location and level, so outputs of runs with a
+    different number of ranks (and so MeshBlocks in a different order) can be compared.
+
+    Args:
+        file1 (str): The path to the first binary output.
+        file2 (str): The path to the second binary output.
+
+    Returns:
+        float: The maximum absolute difference over all variables and cells.
+
+    Raises:
+        RuntimeError: If the outputs are at different times, or contain different
+            variables or MeshBlocks.
+    """
+    import bin_convert  # requires h5py, so only imported by tests that need it
+
+    data = [bin_convert.read_binary(fname) for fname in [file1, file2]]
+    if data[0]["time"] != data[1]["time"]:
+        raise RuntimeError(f"{file1} and {file2} are at different times")
+    if data[0]["var_names"] != data[1]["var_names"]:
+        raise RuntimeError(f"{file1} and {file2} contain different variables")
+    blocks = []
+    for filedata in data:
+        blocks.append(
+            {tuple(loc): m for m, loc in enumerate(filedata["mb_logical"])}
+        )
+    if blocks[0].keys() != blocks[1].keys():
+        raise RuntimeError(f"{file1} and {file2} contain different MeshBlocks")
+
+    maxdiff = 0.0
+    for loc, m in blocks[0].items():
+        for var in data[0]["var_names"]:
+            d1 = data[0]["mb_data"][var][m]
+            d2 = data[1]["mb_data"][var][blocks[1][loc]]
+            maxdiff = max(maxdiff, float(np.max(np.abs(d1 - d2))))
+    return maxdiff
+
+
 def clean() -> None:
     """
     Cleans the build directory.
@@ -27,6 +27,23 @@ the athdf file from the xdmf, so please be aware of this requirement.
 
 ----
 
+Files written with indexed=true (format version 1.2), or with
+compression=lossy (format version 1.3), end with an index of the
+MeshBlock records.  For these, single variables over a sub-volume can
+be read without scanning the whole file:
+
+  filedata = bin_convert.read_binary_subset(
+      binary_fname, variables=["dens"], x1lim=(-0.1, 0.1))
+
+read_binary_index(...) returns only the header and index information.
+
+----
+
+Particle binary (pbin) files are read with read_particle_binary(...),
+which memory-maps each particle field.
+
+----
+
 The read_*(...) functions return a filedata dictionary-like object with
 
     filedata['header'] = array of strings
@@ -124,8 +141,11 @@ def read_binary(filename):
             + '(should be "Athena")'
         )
     version = code_header[-1].split(b"=")[-1]
-    if version != b"1.1":
+    if version not in [b"1.1", b"1.2", b"1.3"]:
         raise TypeError(f"unsupported file format version {version.decode('utf-8')}")
+    if version in [b"1.2", b"1.3"]:
+        # MeshBlock records end where the index starts
+        filesize = _read_index_offset(fp)
 
     pheader_count = int(fp.readline().split(b"=")[-1])
     pheader = {}
@@ -214,6 +234,17 @@ def read_binary(filename):
             )
         )
 
+        if version == b"1.3":
+            # each variable is a separately compressed chunk
+            for var in var_list:
+                chunk = fp.read(32)
+                chunk += fp.read(int(np.frombuffer(chunk[4:8], dtype=np.uint32)[0]))
+                mb_data[var].append(
+                    _decode_lossy_chunk(chunk, (nx3_out, nx2_out, nx1_out))
+                )
+            mb_count += 1
+            continue
+
         data = np.fromfile(
             fp,
             dtype=np.float64 if varfmt == "d" else np.float32,
@@ -230,6 +261,10 @@ def read_binary(filename):
     filedata["time"] = time
     filedata["cycle"] = cycle
     filedata["var_names"] = var_list
+    if version == b"1.3":
+        filedata["error_bound"] = float(pheader["error bound"])
+        filedata["error_type"] = pheader["error type"]
+        filedata["max_error"] = float(pheader["max error"])
 
     filedata["Nx1"] = Nx1
     filedata["Nx2"] = Nx2
@@ -259,6 +294,312 @@ def read_binary(filename):
     return filedata
 
 
+def _read_index_offset(fp):
+    """
+    Returns the offset of the index of an indexed (version 1.2) bin file from
+    its trailer, leaving the file position unchanged.
+    """
+    pos = fp.tell()
+    fp.seek(-16, 2)
+    index_offset = int(np.frombuffer(fp.read(8), dtype=np.uint64)[0])
+    if fp.read(8) != b"AKBINIDX":
+        raise TypeError("bin file index is missing or corrupt")
+    fp.seek(pos, 0)
+    return index_offset
+
+
+def _decode_lossy_chunk(chunk, shape):
+    """
+    Decodes one variable of one MeshBlock compressed with compression=lossy
+    (format version 1.3), see src/outputs/lossy_compress.hpp for the format.
+
+    args:
+      chunk - bytes-like
+          chunk header and payload
+      shape - tuple
+          (nx3, nx2, nx1) shape of decoded data
+
+    returns:
+      data - float32 array with given shape
+    """
+    method, nbytes = [int(x) for x in np.frombuffer(chunk[:8], dtype=np.uint32)]
+    vmin, step = np.frombuffer(chunk[8:24], dtype=np.float64)
+    payload = np.frombuffer(chunk[32 : 32 + nbytes], dtype=np.uint8)
+    ncells = int(np.prod(shape))
+    if method == 0:
+        return payload.view(np.float32).reshape(shape).copy()
+
+    # widths of blocks of 64 values, followed by bits packed least significant first
+    nblocks = (ncells + 63) // 64
+    width = payload[:nblocks].astype(np.int64)
+    bits = np.unpackbits(payload[nblocks:], bitorder="little").astype(np.uint64)
+    w = np.repeat(width, 64)[:ncells]
+    start = np.cumsum(w) - w
+    z = np.zeros(ncells, dtype=np.uint64)
+    for t in range(int(width.max(initial=0))):
+        sel = w > t
+        z[sel] |= bits[start[sel] + t] << np.uint64(t)
+
+    # undo zigzag encoding and Lorenzo prediction, then dequantize
+    q = (z >> np.uint64(1)).astype(np.int64) ^ -((z & np.uint64(1)).astype(np.int64))
+    q = q.reshape(shape)
+    for axis in range(3):
+        q = np.cumsum(q, axis=axis)
+    return (vmin + q * step).astype(np.float32)
+
+
+def read_binary_index(filename):
+    """
+    Reads the header and MeshBlock index of an indexed (version 1.2) bin file,
+    without reading any of the data.
+
+    args:
+      filename - string
+          filename of bin file to read
+
+    returns:
+      fileindex - dict
+          same keys as returned by read_binary(...) except 'mb_data', plus
+          'mb_gid' (array with shape [n_mbs]), 'mb_offset' (array with shape
+          [n_mbs], offset of each MeshBlock record in file), 'var_offset'
+          (array with shape [nvars], offset of each variable in a record, or
+          [n_mbs, nvars] for compressed files), 'varsize_bytes',
+          'locsize_bytes' and 'compressed'; for compressed files also
+          'error_bound', 'error_type' and 'max_error'
+    """
+
+    with open(filename, "rb") as fp:
+        code_header = fp.readline().split()
+        if len(code_header) < 1 or code_header[0] != b"Athena":
+            raise TypeError("unknown file format")
+        version = code_header[-1].split(b"=")[-1]
+        if version not in [b"1.2", b"1.3"]:
+            raise TypeError(
+                f"file format version {version.decode('utf-8')} has no index "
+                + "(write with indexed=true)"
+            )
+        index_offset = _read_index_offset(fp)
+
+        pheader_count = int(fp.readline().split(b"=")[-1])
+        pheader = {}
+        for _ in range(pheader_count - 1):
+            key, val = [x.strip() for x in fp.readline().decode("utf-8").split("=")]
+            pheader[key] = val
+        locsizebytes = int(pheader["size of location"])
+        varsizebytes = int(pheader["size of variable"])
+        fp.readline()  # number of variables, also stored in index
+        var_list = [v.decode("utf-8") for v in fp.readline().split()[1:]]
+        header_size = int(fp.readline().split(b"=")[-1])
+        header = [
+            line.decode("utf-8").split("#")[0].strip()
+            for line in fp.read(header_size).split(b"\n")
+        ]
+        header = [line for line in header if len(line) > 0]
+
+        fp.seek(index_offset, 0)
+        if fp.read(8) != b"AKBINIDX":
+            raise TypeError("bin file index is missing or corrupt")
+        n_mbs, nvars = [int(x) for x in np.frombuffer(fp.read(16), dtype=np.uint64)]
+        # compressed records differ in size, so variable offsets are in each entry
+        compressed = version == b"1.3"
+        if not compressed:
+            var_offset = np.frombuffer(fp.read(8 * nvars), dtype=np.uint64)
+        locdtype = np.float64 if locsizebytes == 8 else np.float32
+        fields = [("offset", np.uint64), ("ints", np.int32, 11), ("bounds", locdtype, 6)]
+        if compressed:
+            fields.append(("var_offset", np.uint64, (nvars,)))
+        entry_dtype = np.dtype(fields)
+        entries = np.frombuffer(
+            fp.read(entry_dtype.itemsize * n_mbs), dtype=entry_dtype
+        )
+        if compressed:
+            var_offset = entries["var_offset"].reshape(n_mbs, nvars)
+
+    def get(blockname, keyname):
+        block = "<none>"
+        for line in header:
+            if line.startswith("<"):
+                block = line
+                continue
+            key, value = line.split("=")
+            if block == blockname and key.strip() == keyname:
+                return value
+        raise KeyError(f"no parameter called {blockname}/{keyname}")
+
+    nghost = int(get("<mesh>", "nghost"))
+    fileindex = {}
+    fileindex["header"] = header
+    fileindex["time"] = float(pheader["time"])
+    fileindex["cycle"] = int(pheader["cycle"])
+    fileindex["var_names"] = var_list
+    fileindex["nvars"] = nvars
+    for key in ["Nx1", "Nx2", "Nx3"]:
+        fileindex[key] = int(get("<mesh>", key.lower()))
+    for key in ["nx1", "nx2", "nx3"]:
+        fileindex[key + "_mb"] = int(get("<meshblock>", key))
+    for key in ["x1min", "x1max", "x2min", "x2max", "x3min", "x3max"]:
+        fileindex[key] = float(get("<mesh>", key))
+    fileindex["n_mbs"] = n_mbs
+    fileindex["mb_gid"] = entries["ints"][:, 0].copy()
+    fileindex["mb_offset"] = entries["offset"].copy()
+    fileindex["mb_index"] = entries["ints"][:, 5:11].astype(np.int64) - nghost
+    # same ordering as in read_binary(...): lx1, lx2, lx3, level
+    fileindex["mb_logical"] = entries["ints"][:, [2, 3, 4, 1]].copy()
+    fileindex["mb_geometry"] = entries["bounds"].copy()
+    fileindex["var_offset"] = var_offset.copy()
+    fileindex["varsize_bytes"] = varsizebytes
+    fileindex["locsize_bytes"] = locsizebytes
+    fileindex["compressed"] = compressed
+    if compressed:
+        fileindex["error_bound"] = float(pheader["error bound"])
+        fileindex["error_type"] = pheader["error type"]
+        fileindex["max_error"] = float(pheader["max error"])
+    if n_mbs > 0:
+        index = fileindex["mb_index"][0]
+        for d in range(3):
+            fileindex[f"nx{d + 1}_out_mb"] = int(index[2 * d + 1] - index[2 * d]) + 1
+    return fileindex
+
+
+def read_binary_subset(
+    filename, variables=None, x1lim=None, x2lim=None, x3lim=None, levels=None
+):
+    """
+    Reads selected variables on the MeshBlocks overlapping a sub-volume from an
+    indexed (version 1.2) bin file.  The file is memory-mapped, and only the
+    requested variables of the selected MeshBlocks are read from disk.
+
+    args:
+      filename - string
+          filename of bin file to read
+      variables - list of strings, optional
+          variables to read (default: all variables)
+      x1lim, x2lim, x3lim - (min, max) tuples, optional
+          only MeshBlocks overlapping this range are read (default: all)
+      levels - list of ints, optional
+          only MeshBlocks on these physical refinement levels are read
+
+    returns:
+      filedata - dict
+          same format as returned by read_binary(...), restricted to the
+          selected MeshBlocks and variables, plus 'mb_gid'
+    """
+
+    filedata = read_binary_index(filename)
+    if variables is None:
+        variables = filedata["var_names"]
+    for var in variables:
+        if var not in filedata["var_names"]:
+            raise KeyError(f"no variable called {var} in {filename}")
+
+    geom = filedata["mb_geometry"]
+    select = np.ones(filedata["n_mbs"], dtype=bool)
+    for d, lim in enumerate([x1lim, x2lim, x3lim]):
+        if lim is not None:
+            select &= (geom[:, 2 * d + 1] >= lim[0]) & (geom[:, 2 * d] <= lim[1])
+    if levels is not None:
+        select &= np.isin(filedata["mb_logical"][:, 3], levels)
+    mbs = np.nonzero(select)[0]
+
+    vardtype = np.float64 if filedata["varsize_bytes"] == 8 else np.float32
+    fmap = np.memmap(filename, dtype=np.uint8, mode="r")
+    mb_data = {var: [] for var in variables}
+    for m in mbs:
+        index = filedata["mb_index"][m]
+        shape = tuple(index[2 * d + 1] - index[2 * d] + 1 for d in [2, 1, 0])
+        ncells = int(np.prod(shape))
+        for var in variables:
+            n = filedata["var_names"].index(var)
+            start = int(filedata["mb_offset"][m])
+            if filedata["compressed"]:
+                start += int(filedata["var_offset"][m, n])
+                nbytes = int(fmap[start + 4 : start + 8].view(np.uint32)[0])
+                chunk = fmap[start : start + 32 + nbytes]
+                mb_data[var].append(_decode_lossy_chunk(chunk, shape))
+                continue
+            start += int(filedata["var_offset"][n])
+            data = fmap[start : start + ncells * filedata["varsize_bytes"]]
+            mb_data[var].append(np.array(data.view(vardtype).reshape(shape)))
+
+    keys = ["mb_gid", "mb_offset", "mb_index", "mb_logical", "mb_geometry"]
+    if filedata["compressed"]:
+        keys.append("var_offset")
+    for key in keys:
+        filedata[key] = filedata[key][mbs]
+    filedata["n_mbs"] = len(mbs)
+    filedata["var_names"] = list(variables)
+    filedata["nvars"] = len(variables)
+    filedata["mb_data"] = mb_data
+    return filedata
+
+
+def read_particle_binary(filename, fields=None):
+    """
+    Reads a particle binary (pbin) file written with collective MPI-IO.
+
+    args:
+      filename - string
+          filename of pbin file to read
+      fields - list of strings (optional)
+          names of fields to read; default is all fields in the file
+
+    returns:
+      prtcldata - dict
+          'header' (array of strings), 'time', 'cycle', 'n_prtcls',
+          'tag_range' ((tag_min, tag_max) used to select particles), 'stride',
+          'field_names', and 'prtcl_data' (dict of arrays with shape [n_prtcls],
+          memory-mapped from the file, float32 for real and int32 for integer
+          fields)
+    """
+
+    with open(filename, "rb") as fp:
+        code_header = fp.readline().split()
+        if len(code_header) < 1 or code_header[0] != b"Athena":
+            raise TypeError("unknown file format")
+        if code_header[-1].split(b"=")[-1] != b"1.0":
+            raise TypeError("unsupported particle file format version")
+        header = []
+        line = fp.readline()
+        while not line.strip().startswith(b"types:"):
+            header.append(line.decode("utf-8").strip())
+            line = fp.readline()
+        header.append(line.decode("utf-8").strip())
+        data_offset = fp.tell()
+
+    pheader = {}
+    for item in header:
+        key, _, val = item.partition("=")
+        if val:
+            pheader[key.strip()] = val.strip()
+    field_names = header[-2].split(":")[-1].split()
+    field_types = header[-1].split(":")[-1].split()
+    n_prtcls = int(pheader["number of particles"])
+    tag_range = tuple(int(t) for t in pheader["tag range"].split())
+
+    if fields is None:
+        fields = field_names
+    prtcl_data = {}
+    for name in fields:
+        if name not in field_names:
+            raise KeyError(f"field {name} not in {filename}")
+        n = field_names.index(name)
+        dtype = np.float32 if field_types[n] == "f" else np.int32
+        prtcl_data[name] = np.memmap(
+            filename, dtype=dtype, mode="r", offset=data_offset + 4 * n * n_prtcls,
+            shape=(n_prtcls,))
+
+    prtcldata = {}
+    prtcldata["header"] = header
+    prtcldata["time"] = float(pheader["time"])
+    prtcldata["cycle"] = int(pheader["cycle"])
+    prtcldata["n_prtcls"] = n_prtcls
+    prtcldata["tag_range"] = tag_range
+    prtcldata["stride"] = int(pheader["stride"])
+    prtcldata["field_names"] = list(fields)
+    prtcldata["prtcl_data"] = prtcl_data
+    return prtcldata
+
+
 def read_coarsened_binary(filename):
     """
     Reads a coarsened bin file from filename to dictionary.